@@ -0,0 +1,20 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef BENCHMARKS_ALLOCATIONCOUNTER_HPP
+#define BENCHMARKS_ALLOCATIONCOUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+
+// Counts every global operator new in the benchmark binary, AllocationCounter.cpp replaces them.
+namespace allocations {
+    extern std::atomic<std::size_t> count;
+
+    inline std::size_t Now() {
+        return count.load(std::memory_order_relaxed);
+    }
+}
+
+#endif //BENCHMARKS_ALLOCATIONCOUNTER_HPP
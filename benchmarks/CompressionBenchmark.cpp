@@ -0,0 +1,95 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <format>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/Compression.hpp"
+#include "common/JsonWriter.hpp"
+#include "common/ResponseCache.hpp"
+
+namespace {
+    // body of GET /tournaments for a page of count tournaments
+    std::string tournamentList(std::size_t count) {
+        std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto tournament = std::make_shared<domain::Tournament>(std::format("Season {} Cup", 2000 + i));
+            tournament->Id() = domain::Uuid::Parse(std::format("0d0e6a42-0000-4000-8000-{:012}", i)).value();
+            tournaments.push_back(std::move(tournament));
+        }
+        return jsonResponse(crow::OK, tournaments).body;
+    }
+
+    // body of GET /tournaments/{id}/groups, in the layout the database aggregates it
+    std::string groupList(std::size_t count, std::size_t teamsPerGroup) {
+        std::string body = "[";
+        for (std::size_t i = 0; i < count; ++i) {
+            body.append(i == 0 ? "" : ", ");
+            body.append(std::format(R"({{"id" : "2b7e1c4a-0000-4000-8000-{:012}", "name" : "Group {}", "teams" : [)", i, i));
+            for (std::size_t team = 0; team < teamsPerGroup; ++team) {
+                body.append(team == 0 ? "" : ", ");
+                body.append(std::format(R"({{"id": "6f1c2b9e-0000-4000-8000-{:012}", "name": "Team {}"}})", i * teamsPerGroup + team, team));
+            }
+            body.append(R"(], "tournamentId" : "0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11"})");
+        }
+        body.push_back(']');
+        return body;
+    }
+
+    // CPU per response against the bytes it saves, the ratio counter is encoded size over body size
+    void encode(benchmark::State& state, const std::string& body, ContentCoding coding) {
+        const ResponseCompression compression(1);
+        std::size_t encodedSize = 0;
+        for (auto _ : state) {
+            const auto encoded = compression.Encode(body, coding);
+            encodedSize = encoded.size();
+            benchmark::DoNotOptimize(encoded.data());
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(body.size() * state.iterations()));
+        state.counters["body"] = static_cast<double>(body.size());
+        state.counters["encoded"] = static_cast<double>(encodedSize);
+        state.counters["ratio"] = static_cast<double>(encodedSize) / static_cast<double>(body.size());
+    }
+
+    void TournamentListEncode(benchmark::State& state) {
+        encode(state, tournamentList(state.range(0)), static_cast<ContentCoding>(state.range(1)));
+    }
+
+    void GroupListEncode(benchmark::State& state) {
+        encode(state, groupList(state.range(0), 16), static_cast<ContentCoding>(state.range(1)));
+    }
+
+    // a hit on a cached group list after its first gzip request, the encoded copy is served as stored
+    void GroupListCachedHit(benchmark::State& state) {
+        ResponseCache cache(64 << 20, {}, ResponseCompression(1024));
+        const auto key = groupsCacheKey(*domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11"));
+        cache.Put(key, 0, groupList(state.range(0), 16), cache.Begin());
+        crow::request request;
+        request.add_header(ACCEPT_ENCODING_HEADER, "gzip, deflate");
+        benchmark::DoNotOptimize(cache.Respond(request, key, *cache.Get(key)));
+        for (auto _ : state) {
+            auto response = cache.Respond(request, key, *cache.Get(key));
+            benchmark::DoNotOptimize(response.body.data());
+        }
+    }
+
+    void codings(benchmark::internal::Benchmark* benchmark, std::initializer_list<std::int64_t> sizes) {
+        for (const auto size : sizes) {
+            for (const auto coding : CONTENT_CODINGS) {
+                if (codingAvailable(coding)) {
+                    benchmark->Args({size, static_cast<std::int64_t>(coding)});
+                }
+            }
+        }
+    }
+}
+
+// tournaments on the page, then the ContentCoding
+BENCHMARK(TournamentListEncode)->Apply([](auto* benchmark) { codings(benchmark, {50, 500}); });
+// groups of 16 teams in the tournament, then the ContentCoding
+BENCHMARK(GroupListEncode)->Apply([](auto* benchmark) { codings(benchmark, {8, 100}); });
+BENCHMARK(GroupListCachedHit)->Arg(8)->Arg(100);
@@ -0,0 +1,93 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <format>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "AllocationCounter.hpp"
+#include "domain/DocumentDecoder.hpp"
+#include "domain/Utilities.hpp"
+
+namespace {
+    // GROUPS.document rows the way GroupRepository::Create writes them
+    std::vector<std::string> groupDocuments(std::size_t rows, std::size_t teamsPerGroup) {
+        std::vector<std::string> documents;
+        for (std::size_t row = 0; row < rows; ++row) {
+            domain::Group group(std::format("Group {}", row));
+            group.TournamentId() = *domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11");
+            for (std::size_t team = 0; team < teamsPerGroup; ++team) {
+                group.Teams().push_back({domain::Uuid::Parse(std::format("6f1c2b9e-0000-4000-8000-{:012}", row * teamsPerGroup + team)).value(), std::format("Team {}", team)});
+            }
+            nlohmann::json document = group;
+            documents.push_back(document.dump());
+        }
+        return documents;
+    }
+
+    std::vector<std::string> tournamentDocuments(std::size_t rows) {
+        std::vector<std::string> documents;
+        for (std::size_t row = 0; row < rows; ++row) {
+            nlohmann::json document = domain::Tournament(std::format("Tournament {}", row), domain::TournamentFormat(4, 8, domain::TournamentType::ROUND_ROBIN));
+            documents.push_back(document.dump());
+        }
+        return documents;
+    }
+
+    template<typename Decode>
+    void decodeRows(benchmark::State& state, const std::vector<std::string>& documents, Decode decode) {
+        std::size_t allocated = 0;
+        for (auto _ : state) {
+            const auto before = allocations::Now();
+            for (const auto& document : documents) {
+                benchmark::DoNotOptimize(decode(document));
+            }
+            allocated += allocations::Now() - before;
+        }
+        const auto rows = static_cast<std::int64_t>(state.iterations() * documents.size());
+        state.SetItemsProcessed(rows);
+        state.counters["allocs/row"] = static_cast<double>(allocated) / static_cast<double>(rows);
+    }
+
+    void GroupRowsDom(benchmark::State& state) {
+        const auto documents = groupDocuments(state.range(0), state.range(1));
+        decodeRows(state, documents, [](const std::string& document) {
+            return std::make_shared<domain::Group>(nlohmann::json::parse(document));
+        });
+    }
+
+    void GroupRowsSax(benchmark::State& state) {
+        const auto documents = groupDocuments(state.range(0), state.range(1));
+        decodeRows(state, documents, [](const std::string& document) {
+            auto group = std::make_shared<domain::Group>();
+            domain::decode(document, *group);
+            return group;
+        });
+    }
+
+    void TournamentRowsDom(benchmark::State& state) {
+        const auto documents = tournamentDocuments(state.range(0));
+        decodeRows(state, documents, [](const std::string& document) {
+            return std::make_shared<domain::Tournament>(nlohmann::json::parse(document));
+        });
+    }
+
+    void TournamentRowsSax(benchmark::State& state) {
+        const auto documents = tournamentDocuments(state.range(0));
+        decodeRows(state, documents, [](const std::string& document) {
+            auto tournament = std::make_shared<domain::Tournament>();
+            domain::decode(document, *tournament);
+            return tournament;
+        });
+    }
+}
+
+// rows in the listing, teams per group
+BENCHMARK(GroupRowsDom)->Args({100, 4})->Args({100, 16});
+BENCHMARK(GroupRowsSax)->Args({100, 4})->Args({100, 16});
+BENCHMARK(TournamentRowsDom)->Arg(100);
+BENCHMARK(TournamentRowsSax)->Arg(100);
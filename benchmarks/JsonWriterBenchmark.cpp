@@ -0,0 +1,63 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <format>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "AllocationCounter.hpp"
+#include "common/JsonWriter.hpp"
+#include "domain/Utilities.hpp"
+
+namespace {
+    // one tournament's groups, the shape list responses are written from
+    std::vector<std::shared_ptr<domain::Group>> groups(std::size_t count, std::size_t teamsPerGroup) {
+        std::vector<std::shared_ptr<domain::Group>> groups;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto group = std::make_shared<domain::Group>(std::format("Group {}", i), domain::Uuid::Parse(std::format("2b7e1c4a-0000-4000-8000-{:012}", i)).value());
+            group->TournamentId() = *domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11");
+            for (std::size_t team = 0; team < teamsPerGroup; ++team) {
+                group->Teams().push_back({domain::Uuid::Parse(std::format("6f1c2b9e-0000-4000-8000-{:012}", i * teamsPerGroup + team)).value(), std::format("Team {}", team)});
+            }
+            groups.push_back(std::move(group));
+        }
+        return groups;
+    }
+
+    template<typename Serialize>
+    void serializeResponse(benchmark::State& state, Serialize serialize) {
+        const auto body = groups(state.range(0), state.range(1));
+        std::size_t allocated = 0;
+        std::size_t bytes = 0;
+        for (auto _ : state) {
+            const auto before = allocations::Now();
+            auto response = serialize(body);
+            allocated += allocations::Now() - before;
+            bytes += response.body.size();
+            benchmark::DoNotOptimize(response.body.data());
+        }
+        state.SetBytesProcessed(static_cast<std::int64_t>(bytes));
+        state.counters["allocs/response"] = static_cast<double>(allocated) / static_cast<double>(state.iterations());
+    }
+
+    void GroupListDom(benchmark::State& state) {
+        serializeResponse(state, [](const auto& groups) {
+            nlohmann::json body = groups;
+            return crow::response(crow::OK, body.dump());
+        });
+    }
+
+    void GroupListWriter(benchmark::State& state) {
+        serializeResponse(state, [](const auto& groups) {
+            return jsonResponse(crow::OK, groups);
+        });
+    }
+}
+
+// groups in the tournament, teams per group
+BENCHMARK(GroupListDom)->Args({8, 4})->Args({100, 16});
+BENCHMARK(GroupListWriter)->Args({8, 4})->Args({100, 16});
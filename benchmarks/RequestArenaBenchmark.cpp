@@ -0,0 +1,83 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <format>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "AllocationCounter.hpp"
+#include "domain/DocumentDecoder.hpp"
+#include "domain/Utilities.hpp"
+#include "persistence/async/QueryResult.hpp"
+#include "persistence/configuration/RequestArena.hpp"
+
+namespace {
+    // the id, version, document cells of a group listing, as the pipeline receives them
+    std::vector<std::string> groupCells(std::size_t rows) {
+        std::vector<std::string> cells;
+        for (std::size_t row = 0; row < rows; ++row) {
+            domain::Group group(std::format("Group {}", row));
+            for (std::size_t team = 0; team < 4; ++team) {
+                group.Teams().push_back({domain::Uuid::Parse(std::format("6f1c2b9e-0000-4000-8000-{:012}", row * 4 + team)).value(), std::format("Team {}", team)});
+            }
+            nlohmann::json document = group;
+            cells.push_back(std::format("2b7e1c4a-0000-4000-8000-{:012}", row));
+            cells.push_back("1");
+            cells.push_back(document.dump());
+        }
+        return cells;
+    }
+
+    // Copies the rows like PipelineQueryExecutor does and reads them back like AsyncGroupRepository, the
+    // allocations counter is what one such request costs the heap.
+    void readGroups(benchmark::State& state, bool inArena) {
+        const auto cells = groupCells(state.range(0));
+        std::size_t allocated = 0;
+        for (auto _ : state) {
+            const auto before = allocations::Now();
+            std::optional<RequestArena> arena;
+            std::pmr::memory_resource* memory = std::pmr::get_default_resource();
+            if (inArena) {
+                memory = &arena.emplace();
+            }
+
+            QueryResult result(memory);
+            result.Reserve(3, state.range(0));
+            result.AddColumn("id");
+            result.AddColumn("version");
+            result.AddColumn("document");
+            for (const auto& cell : cells) {
+                result.AddCell(cell);
+            }
+            std::vector<std::shared_ptr<domain::Group>> groups;
+            groups.reserve(result.Size());
+            for (std::size_t row = 0; row < result.Size(); ++row) {
+                auto group = std::make_shared<domain::Group>();
+                domain::decode(result.Text(row, "document"), *group);
+                group->Id() = result.Uuid(row, "id");
+                groups.push_back(std::move(group));
+            }
+            benchmark::DoNotOptimize(groups.data());
+            allocated += allocations::Now() - before;
+        }
+        state.counters["allocs/request"] = static_cast<double>(allocated) / static_cast<double>(state.iterations());
+    }
+
+    void GroupRowsHeap(benchmark::State& state) {
+        readGroups(state, false);
+    }
+
+    void GroupRowsArena(benchmark::State& state) {
+        readGroups(state, true);
+    }
+}
+
+// groups in the tournament
+BENCHMARK(GroupRowsHeap)->Arg(8)->Arg(100);
+BENCHMARK(GroupRowsArena)->Arg(8)->Arg(100);
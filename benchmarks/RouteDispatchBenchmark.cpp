@@ -0,0 +1,85 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <regex>
+#include <string>
+#include <tuple>
+#include <Hypodermic/Hypodermic.h>
+
+#include "common/Compression.hpp"
+#include "common/ResponseCache.hpp"
+#include "configuration/RouteDefinition.hpp"
+#include "configuration/RoutePath.hpp"
+#include "controller/TeamController.hpp"
+#include "delegate/ITeamDelegate.hpp"
+
+namespace {
+    // the one piece that is not the service's own, it answers without a database
+    class InMemoryTeamDelegate : public ITeamDelegate {
+        std::shared_ptr<domain::Team> team = std::make_shared<domain::Team>(domain::Team{*domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11"), "Team 1"});
+
+    public:
+        std::shared_ptr<domain::Team> GetTeam(const domain::Uuid&) override { return team; }
+        std::optional<std::int64_t> GetTeamVersion(const domain::Uuid&) override { return team->Version; }
+        std::vector<std::shared_ptr<domain::Team>> GetAllTeams() override { return {team}; }
+        std::vector<std::shared_ptr<domain::Team>> GetTeamsPage(const std::optional<domain::Uuid>&, std::size_t) override { return {team}; }
+        bool ExportTeams(const std::function<void(std::string_view)>&, std::size_t) override { return true; }
+        std::expected<domain::Uuid, std::string> SaveTeam(const domain::Team&) override { return team->Id; }
+        BulkImportResult ImportTeams(const std::vector<domain::Team>&) override { return {}; }
+        std::expected<domain::Uuid, std::string> UpdateTeam(const domain::Uuid&, const domain::Team&) override { return team->Id; }
+        std::expected<void, std::string> DeleteTeam(const domain::Uuid&) override { return {}; }
+    };
+
+    using TeamRoute = RoutePath<"/teams/<uuid>">;
+
+    const std::string TEAM_ID = "0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11";
+
+    // registered the way config::containerSetup does, so resolving TeamController autowires its dependencies
+    std::shared_ptr<Hypodermic::Container> serviceContainer() {
+        Hypodermic::ContainerBuilder builder;
+        const auto compression = std::make_shared<ResponseCompression>();
+        builder.registerInstance(compression);
+        builder.registerInstance(std::make_shared<ResponseCache>(1 << 20, std::chrono::milliseconds{0}, *compression));
+        builder.registerType<InMemoryTeamDelegate>().as<ITeamDelegate>().singleInstance();
+        builder.registerType<TeamController>().singleInstance();
+        return builder.build();
+    }
+
+    // what every request paid before: a container lookup, a regex per path parameter in the handler, then the
+    // id parsed again on its way to the statement
+    void DispatchResolvePerRequest(benchmark::State& state) {
+        const auto container = serviceContainer();
+        const std::regex uuidRegex("[a-fA-F0-9]{8}-[a-fA-F0-9]{4}-[a-fA-F0-9]{4}-[a-fA-F0-9]{4}-[a-fA-F0-9]{12}");
+        const crow::request request;
+        for (auto _ : state) {
+            const auto controller = container->resolve<TeamController>();
+            if (!std::regex_match(TEAM_ID, uuidRegex)) {
+                state.SkipWithError("rejected a valid id");
+                break;
+            }
+            auto response = invokeController(controller.get(), &TeamController::getTeam, request, *domain::Uuid::Parse(TEAM_ID));
+            benchmark::DoNotOptimize(response.code);
+        }
+    }
+
+    // the controller resolved when the route was bound, parameters parsed once into their declared type
+    void DispatchBoundRoute(benchmark::State& state) {
+        const auto controller = serviceContainer()->resolve<TeamController>();
+        const crow::request request;
+        for (auto _ : state) {
+            const auto arguments = TeamRoute::Parse(TEAM_ID);
+            if (!arguments) {
+                state.SkipWithError("rejected a valid id");
+                break;
+            }
+            auto response = invokeController(controller.get(), &TeamController::getTeam, request, std::get<0>(*arguments));
+            benchmark::DoNotOptimize(response.code);
+        }
+    }
+}
+
+BENCHMARK(DispatchResolvePerRequest);
+BENCHMARK(DispatchBoundRoute);
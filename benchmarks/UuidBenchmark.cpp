@@ -0,0 +1,78 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include <benchmark/benchmark.h>
+#include <format>
+#include <regex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "domain/Uuid.hpp"
+
+namespace {
+    const std::string ID = "6f1c2b9e-8d6f-4d8e-9a4c-5f0b7c2f3a11";
+
+    std::vector<std::string> ids(std::size_t count) {
+        std::vector<std::string> texts;
+        for (std::size_t i = 0; i < count; ++i) {
+            texts.push_back(std::format("6f1c2b9e-0000-4000-8000-{:012}", i));
+        }
+        return texts;
+    }
+
+    // the check controllers ran on every path id before
+    void ValidateRegex(benchmark::State& state) {
+        const std::regex uuidRegex("[a-fA-F0-9]{8}-[a-fA-F0-9]{4}-[a-fA-F0-9]{4}-[a-fA-F0-9]{4}-[a-fA-F0-9]{12}");
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(std::regex_match(ID, uuidRegex));
+        }
+    }
+
+    void ValidateParse(benchmark::State& state) {
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(domain::isUuid(ID));
+        }
+    }
+
+    void FormatText(benchmark::State& state) {
+        const auto uuid = *domain::Uuid::Parse(ID);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(uuid.ToString());
+        }
+    }
+
+    // membership checks the way GroupDelegate runs them over a group's team ids
+    void LookupString(benchmark::State& state) {
+        const auto texts = ids(state.range(0));
+        const std::unordered_set<std::string> set(texts.begin(), texts.end());
+        for (auto _ : state) {
+            for (const auto& text : texts) {
+                benchmark::DoNotOptimize(set.contains(text));
+            }
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * texts.size()));
+    }
+
+    void LookupUuid(benchmark::State& state) {
+        std::vector<domain::Uuid> uuids;
+        for (const auto& text : ids(state.range(0))) {
+            uuids.push_back(*domain::Uuid::Parse(text));
+        }
+        const std::unordered_set<domain::Uuid> set(uuids.begin(), uuids.end());
+        for (auto _ : state) {
+            for (const auto& uuid : uuids) {
+                benchmark::DoNotOptimize(set.contains(uuid));
+            }
+        }
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * uuids.size()));
+    }
+}
+
+BENCHMARK(ValidateRegex);
+BENCHMARK(ValidateParse);
+BENCHMARK(FormatText);
+// ids in the set
+BENCHMARK(LookupString)->Arg(16)->Arg(4096);
+BENCHMARK(LookupUuid)->Arg(16)->Arg(4096);
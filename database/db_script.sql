@@ -27,6 +27,7 @@ DROP TABLE IF EXISTS TEAMS CASCADE;
 CREATE TABLE TEAMS (
                        id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
                        document JSONB NOT NULL,
+                       VERSION BIGINT NOT NULL DEFAULT 1,
                        last_update_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
                        created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
@@ -36,6 +37,7 @@ DROP TABLE IF EXISTS TOURNAMENTS CASCADE;
 CREATE TABLE TOURNAMENTS (
                              id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
                              document JSONB NOT NULL,
+                             VERSION BIGINT NOT NULL DEFAULT 1,
                              last_update_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
                              created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
@@ -46,19 +48,164 @@ CREATE TABLE GROUPS (
                         id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
                         TOURNAMENT_ID UUID not null references TOURNAMENTS(ID),
                         document JSONB NOT NULL,
+                        VERSION BIGINT NOT NULL DEFAULT 1,
                         last_update_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
                         created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
 CREATE UNIQUE INDEX tournament_group_unique_name_idx ON GROUPS (tournament_id,(document->>'name'));
 
+-- every write to a versioned row bumps VERSION, it is the ETag the service hands out
+CREATE OR REPLACE FUNCTION bump_version()
+RETURNS TRIGGER LANGUAGE plpgsql AS $$
+BEGIN
+    NEW.VERSION = OLD.VERSION + 1;
+    NEW.last_update_date = CURRENT_TIMESTAMP;
+    RETURN NEW;
+END;
+$$;
+
+CREATE TRIGGER teams_version_trg BEFORE UPDATE ON TEAMS FOR EACH ROW EXECUTE FUNCTION bump_version();
+CREATE TRIGGER tournaments_version_trg BEFORE UPDATE ON TOURNAMENTS FOR EACH ROW EXECUTE FUNCTION bump_version();
+CREATE TRIGGER groups_version_trg BEFORE UPDATE ON GROUPS FOR EACH ROW EXECUTE FUNCTION bump_version();
+
+-- one row per team placed in a group, a team can only be in one group of a tournament
+DROP TABLE IF EXISTS GROUP_TEAMS CASCADE;
+CREATE TABLE GROUP_TEAMS (
+                        TOURNAMENT_ID UUID not null references TOURNAMENTS(ID) ON DELETE CASCADE,
+                        TEAM_ID UUID not null references TEAMS(ID) ON DELETE CASCADE,
+                        GROUP_ID UUID not null references GROUPS(ID) ON DELETE CASCADE,
+                        PRIMARY KEY (TOURNAMENT_ID, TEAM_ID)
+);
+CREATE INDEX group_teams_group_idx ON GROUP_TEAMS (GROUP_ID);
+
+-- Adds a team to a group in one call: capacity, team existence and membership are checked while the
+-- group row is locked, so concurrent adds cannot overfill a group or place a team twice.
+CREATE OR REPLACE FUNCTION add_team_to_group(p_tournament_id UUID, p_group_id UUID, p_team_id UUID, p_max_teams INTEGER)
+RETURNS TEXT LANGUAGE plpgsql AS $$
+DECLARE
+    team_count INTEGER;
+    team_document JSONB;
+BEGIN
+    SELECT jsonb_array_length(coalesce(document->'teams', '[]'::jsonb)) INTO team_count
+    FROM GROUPS WHERE id = p_group_id AND tournament_id = p_tournament_id
+    FOR UPDATE;
+    IF NOT FOUND THEN
+        RETURN 'GROUP_NOT_FOUND';
+    END IF;
+    IF team_count >= p_max_teams THEN
+        RETURN 'GROUP_FULL';
+    END IF;
+
+    SELECT jsonb_build_object('id', id, 'name', document->>'name') INTO team_document
+    FROM TEAMS WHERE id = p_team_id;
+    IF NOT FOUND THEN
+        RETURN 'TEAM_NOT_FOUND';
+    END IF;
+
+    INSERT INTO GROUP_TEAMS (tournament_id, group_id, team_id) VALUES (p_tournament_id, p_group_id, p_team_id)
+    ON CONFLICT DO NOTHING;
+    IF NOT FOUND THEN
+        RETURN 'TEAM_ALREADY_GROUPED';
+    END IF;
+
+    UPDATE GROUPS
+    SET document = jsonb_set(document, '{teams}', coalesce(document->'teams', '[]'::jsonb) || jsonb_build_array(team_document))
+    WHERE id = p_group_id;
+    RETURN 'ADDED';
+END;
+$$;
+
+-- every query filters by tournament, so MATCHES is hash partitioned on it and each season lands in one partition
 DROP TABLE IF EXISTS MATCHES CASCADE;
 CREATE TABLE MATCHES (
-                         id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
-                         document JSONB NOT NULL,
+                         id UUID DEFAULT uuid_generate_v4(),
+                         TOURNAMENT_ID UUID not null references TOURNAMENTS(ID) ON DELETE CASCADE,
+                         HOME_TEAM_ID UUID not null references TEAMS(ID),
+                         AWAY_TEAM_ID UUID not null references TEAMS(ID),
+                         HOME_SCORE INTEGER not null,
+                         AWAY_SCORE INTEGER not null,
+                         ROUND TEXT not null,
                          last_update_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
-                         created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
+                         created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
+                         PRIMARY KEY (TOURNAMENT_ID, id)
+) PARTITION BY HASH (TOURNAMENT_ID);
+CREATE TABLE MATCHES_P0 PARTITION OF MATCHES FOR VALUES WITH (MODULUS 8, REMAINDER 0);
+CREATE TABLE MATCHES_P1 PARTITION OF MATCHES FOR VALUES WITH (MODULUS 8, REMAINDER 1);
+CREATE TABLE MATCHES_P2 PARTITION OF MATCHES FOR VALUES WITH (MODULUS 8, REMAINDER 2);
+CREATE TABLE MATCHES_P3 PARTITION OF MATCHES FOR VALUES WITH (MODULUS 8, REMAINDER 3);
+CREATE TABLE MATCHES_P4 PARTITION OF MATCHES FOR VALUES WITH (MODULUS 8, REMAINDER 4);
+CREATE TABLE MATCHES_P5 PARTITION OF MATCHES FOR VALUES WITH (MODULUS 8, REMAINDER 5);
+CREATE TABLE MATCHES_P6 PARTITION OF MATCHES FOR VALUES WITH (MODULUS 8, REMAINDER 6);
+CREATE TABLE MATCHES_P7 PARTITION OF MATCHES FOR VALUES WITH (MODULUS 8, REMAINDER 7);
+CREATE INDEX matches_home_team_idx ON MATCHES (TOURNAMENT_ID, HOME_TEAM_ID);
+CREATE INDEX matches_away_team_idx ON MATCHES (TOURNAMENT_ID, AWAY_TEAM_ID);
+-- lookups by id alone cannot be pruned to one partition, this lets each partition answer them from an index
+CREATE INDEX matches_id_idx ON MATCHES (id);
+
+-- running regular season record per team, kept current by triggers so reads never aggregate MATCHES
+DROP TABLE IF EXISTS STANDINGS CASCADE;
+CREATE TABLE STANDINGS (
+                         TOURNAMENT_ID UUID not null references TOURNAMENTS(ID) ON DELETE CASCADE,
+                         TEAM_ID UUID not null references TEAMS(ID) ON DELETE CASCADE,
+                         WINS INTEGER not null DEFAULT 0,
+                         LOSSES INTEGER not null DEFAULT 0,
+                         TIES INTEGER not null DEFAULT 0,
+                         NET_POINTS INTEGER not null DEFAULT 0,
+                         last_update_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
+                         PRIMARY KEY (TOURNAMENT_ID, TEAM_ID)
 );
 
+-- p_sign is 1 to record a result and -1 to take it back
+CREATE OR REPLACE FUNCTION record_standing(p_tournament_id UUID, p_team_id UUID, p_scored INTEGER, p_allowed INTEGER, p_sign INTEGER)
+RETURNS VOID LANGUAGE sql AS $$
+    INSERT INTO STANDINGS (TOURNAMENT_ID, TEAM_ID, WINS, LOSSES, TIES, NET_POINTS)
+    VALUES (p_tournament_id, p_team_id,
+            p_sign * (p_scored > p_allowed)::integer,
+            p_sign * (p_scored < p_allowed)::integer,
+            p_sign * (p_scored = p_allowed)::integer,
+            p_sign * (p_scored - p_allowed))
+    ON CONFLICT (TOURNAMENT_ID, TEAM_ID) DO UPDATE
+    SET WINS = STANDINGS.WINS + EXCLUDED.WINS,
+        LOSSES = STANDINGS.LOSSES + EXCLUDED.LOSSES,
+        TIES = STANDINGS.TIES + EXCLUDED.TIES,
+        NET_POINTS = STANDINGS.NET_POINTS + EXCLUDED.NET_POINTS,
+        last_update_date = CURRENT_TIMESTAMP;
+$$;
+
+CREATE OR REPLACE FUNCTION apply_match_to_standings()
+RETURNS TRIGGER LANGUAGE plpgsql AS $$
+BEGIN
+    IF TG_OP IN ('UPDATE', 'DELETE') AND OLD.ROUND = 'REGULAR_SEASON' THEN
+        PERFORM record_standing(OLD.TOURNAMENT_ID, OLD.HOME_TEAM_ID, OLD.HOME_SCORE, OLD.AWAY_SCORE, -1);
+        PERFORM record_standing(OLD.TOURNAMENT_ID, OLD.AWAY_TEAM_ID, OLD.AWAY_SCORE, OLD.HOME_SCORE, -1);
+    END IF;
+    IF TG_OP IN ('INSERT', 'UPDATE') AND NEW.ROUND = 'REGULAR_SEASON' THEN
+        PERFORM record_standing(NEW.TOURNAMENT_ID, NEW.HOME_TEAM_ID, NEW.HOME_SCORE, NEW.AWAY_SCORE, 1);
+        PERFORM record_standing(NEW.TOURNAMENT_ID, NEW.AWAY_TEAM_ID, NEW.AWAY_SCORE, NEW.HOME_SCORE, 1);
+    END IF;
+    RETURN NULL;
+END;
+$$;
+
+-- any column the contribution depends on, an update takes back the old row's and records the new one's
+CREATE TRIGGER matches_standings_trg
+AFTER INSERT OR UPDATE OF HOME_SCORE, AWAY_SCORE, ROUND, HOME_TEAM_ID, AWAY_TEAM_ID, TOURNAMENT_ID OR DELETE ON MATCHES
+FOR EACH ROW EXECUTE FUNCTION apply_match_to_standings();
+
+-- a team shows up with a 0-0-0 record as soon as it joins a group
+CREATE OR REPLACE FUNCTION seed_standing()
+RETURNS TRIGGER LANGUAGE plpgsql AS $$
+BEGIN
+    INSERT INTO STANDINGS (TOURNAMENT_ID, TEAM_ID) VALUES (NEW.TOURNAMENT_ID, NEW.TEAM_ID)
+    ON CONFLICT DO NOTHING;
+    RETURN NULL;
+END;
+$$;
+
+CREATE TRIGGER group_teams_standings_trg
+AFTER INSERT ON GROUP_TEAMS
+FOR EACH ROW EXECUTE FUNCTION seed_standing();
+
 GRANT SELECT ON ALL TABLES IN SCHEMA public TO tournament_svc;
 GRANT DELETE ON ALL TABLES IN SCHEMA public TO tournament_svc;
 GRANT UPDATE ON ALL TABLES IN SCHEMA public TO tournament_svc;
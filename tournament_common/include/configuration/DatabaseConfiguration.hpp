@@ -1,15 +1,41 @@
 #ifndef DATA_BASE_CONFIGURATION_HPP
 #define DATA_BASE_CONFIGURATION_HPP
 
+#include <algorithm>
+#include <chrono>
+#include <optional>
 #include <string>
+#include <nlohmann/json.hpp>
+
+#include "persistence/configuration/PoolSettings.hpp"
 
 namespace config {
     struct DatabaseConfiguration{
         std::string connectionString;
+        PoolSettings pool;
+        // replica that serves reads with its own pool, all traffic goes to connectionString when absent
+        std::optional<std::string> readConnectionString;
+        std::chrono::milliseconds readYourWritesWindow{1000};
+        // libpq connections in pipeline mode behind the async repositories
+        std::size_t pipelineConnections = 2;
     };
 
     inline void from_json(const nlohmann::json& json, DatabaseConfiguration& databaseConfiguration) {
         json.at("connectionString").get_to(databaseConfiguration.connectionString);
+
+        // poolSize is kept as the upper bound for configurations written before min/max existed
+        auto& pool = databaseConfiguration.pool;
+        pool.maxSize = json.value("maxPoolSize", json.value("poolSize", pool.maxSize));
+        pool.minSize = std::min(json.value("minPoolSize", pool.minSize), pool.maxSize);
+        pool.checkoutTimeout = std::chrono::milliseconds(json.value("checkoutTimeoutMs", pool.checkoutTimeout.count()));
+        pool.idleTimeout = std::chrono::milliseconds(json.value("idleTimeoutMs", pool.idleTimeout.count()));
+        pool.statementTimeout = std::chrono::milliseconds(json.value("statementTimeoutMs", pool.statementTimeout.count()));
+        if (json.contains("readConnectionString")) {
+            databaseConfiguration.readConnectionString = json.at("readConnectionString").get<std::string>();
+        }
+        databaseConfiguration.readYourWritesWindow = std::chrono::milliseconds(
+            json.value("readYourWritesMs", databaseConfiguration.readYourWritesWindow.count()));
+        databaseConfiguration.pipelineConnections = json.value("pipelineConnections", databaseConfiguration.pipelineConnections);
     }
 }
 #endif
@@ -0,0 +1,256 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef DOMAIN_DOCUMENTDECODER_HPP
+#define DOMAIN_DOCUMENTDECODER_HPP
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <nlohmann/json.hpp>
+
+#include "domain/Utilities.hpp"
+#include "domain/Uuid.hpp"
+
+namespace domain {
+    // Fills a domain object straight from a stored JSONB document with nlohmann's SAX interface, no
+    // intermediate DOM. The documents are the ones to_json wrote, so the decoders read the same fields
+    // the from_json overloads do and skip anything else. A missing field keeps the object's default.
+    namespace detail {
+        // Object or array the parser is currently inside, Skip for everything no field maps to.
+        enum class Scope { Skip, Team, Teams, Group, Tournament, Format };
+
+        class DocumentHandler {
+        public:
+            using json = nlohmann::json;
+            // Where the next scalar goes, monostate discards it.
+            using Target = std::variant<std::monostate, std::string*, Uuid*, int*, TournamentType*>;
+
+        protected:
+            Target target;
+            // scope a start_object/start_array opens, set by the key that precedes it
+            Scope opens = Scope::Skip;
+
+        private:
+            // the documents nest at most three levels (group, teams, team), deeper values are only counted
+            std::array<Scope, 4> scopes{};
+            std::size_t depth = 0;
+            std::size_t skipped = 0;
+
+            bool enter(Scope scope) {
+                if (skipped > 0 || scope == Scope::Skip || depth == scopes.size()) {
+                    ++skipped;
+                } else {
+                    scopes[depth++] = scope;
+                }
+                target = std::monostate{};
+                opens = Scope::Skip;
+                return true;
+            }
+
+            bool leave() {
+                if (skipped > 0) {
+                    --skipped;
+                } else if (depth > 0) {
+                    --depth;
+                }
+                return true;
+            }
+
+            template<typename Value>
+            bool assign(Value value) {
+                std::visit([&]<typename Slot>(Slot slot) {
+                    if constexpr (std::is_same_v<Slot, int*>) {
+                        *slot = static_cast<int>(value);
+                    }
+                }, target);
+                return discard();
+            }
+
+            bool discard() {
+                target = std::monostate{};
+                opens = Scope::Skip;
+                return true;
+            }
+
+        protected:
+            [[nodiscard]] Scope Current() const {
+                return skipped > 0 || depth == 0 ? Scope::Skip : scopes[depth - 1];
+            }
+
+            // First scope, the document itself.
+            void Root(Scope scope) {
+                opens = scope;
+            }
+
+            virtual void Key(Scope scope, std::string_view key) = 0;
+            virtual void Element() {}
+
+        public:
+            virtual ~DocumentHandler() = default;
+
+            bool null() { return discard(); }
+            bool boolean(bool) { return discard(); }
+            bool number_integer(json::number_integer_t value) { return assign(value); }
+            bool number_unsigned(json::number_unsigned_t value) { return assign(value); }
+            bool number_float(json::number_float_t value, const json::string_t&) { return assign(value); }
+            bool binary(json::binary_t&) { return discard(); }
+
+            bool string(json::string_t& value) {
+                if (auto* slot = std::get_if<std::string*>(&target)) {
+                    // copied, not moved, so the lexer keeps its token buffer and short names stay in SSO
+                    **slot = value;
+                } else if (auto* id = std::get_if<Uuid*>(&target)) {
+                    // the empty id a document holds for a team without one stays nil
+                    **id = Uuid::Parse(value).value_or(Uuid());
+                } else if (auto* type = std::get_if<TournamentType*>(&target)) {
+                    **type = fromString(value);
+                }
+                return discard();
+            }
+
+            bool start_object(std::size_t) {
+                if (Current() == Scope::Teams) {
+                    Element();
+                }
+                return enter(opens);
+            }
+
+            bool start_array(std::size_t) {
+                return enter(opens);
+            }
+
+            bool end_object() { return leave(); }
+            bool end_array() { return leave(); }
+
+            bool key(json::string_t& key) {
+                discard();
+                if (const auto scope = Current(); scope != Scope::Skip) {
+                    Key(scope, key);
+                }
+                return true;
+            }
+
+            bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& error) {
+                if (const auto* parse = dynamic_cast<const json::parse_error*>(&error)) {
+                    throw *parse;
+                }
+                throw std::invalid_argument(error.what());
+            }
+        };
+
+        class TeamHandler : public DocumentHandler {
+            Team& team;
+
+        protected:
+            void Key(Scope, std::string_view key) override {
+                if (key == "id") {
+                    target = &team.Id;
+                } else if (key == "name") {
+                    target = &team.Name;
+                }
+            }
+
+        public:
+            explicit TeamHandler(Team& team) : team(team) {
+                Root(Scope::Team);
+            }
+        };
+
+        class GroupHandler : public DocumentHandler {
+            Group& group;
+
+        protected:
+            void Key(Scope scope, std::string_view key) override {
+                if (scope == Scope::Team) {
+                    Team& team = group.Teams().back();
+                    if (key == "id") {
+                        target = &team.Id;
+                    } else if (key == "name") {
+                        target = &team.Name;
+                    }
+                    return;
+                }
+                if (scope != Scope::Group) {
+                    return;
+                }
+                if (key == "name") {
+                    target = &group.Name();
+                } else if (key == "id") {
+                    target = &group.Id();
+                } else if (key == "tournamentId") {
+                    target = &group.TournamentId();
+                } else if (key == "teams") {
+                    opens = Scope::Teams;
+                }
+            }
+
+            void Element() override {
+                group.Teams().emplace_back();
+                opens = Scope::Team;
+            }
+
+        public:
+            explicit GroupHandler(Group& group) : group(group) {
+                Root(Scope::Group);
+            }
+        };
+
+        class TournamentHandler : public DocumentHandler {
+            Tournament& tournament;
+
+        protected:
+            void Key(Scope scope, std::string_view key) override {
+                if (scope == Scope::Format) {
+                    if (key == "maxTeamsPerGroup") {
+                        target = &tournament.Format().MaxTeamsPerGroup();
+                    } else if (key == "numberOfGroups") {
+                        target = &tournament.Format().NumberOfGroups();
+                    } else if (key == "type") {
+                        target = &tournament.Format().Type();
+                    }
+                    return;
+                }
+                if (key == "name") {
+                    target = &tournament.Name();
+                } else if (key == "id") {
+                    target = &tournament.Id();
+                } else if (key == "format") {
+                    opens = Scope::Format;
+                }
+            }
+
+        public:
+            explicit TournamentHandler(Tournament& tournament) : tournament(tournament) {
+                Root(Scope::Tournament);
+            }
+        };
+
+        template<typename Handler>
+        void decode(std::string_view document, Handler& handler) {
+            nlohmann::json::sax_parse(document.begin(), document.end(), &handler);
+        }
+    }
+
+    inline void decode(std::string_view document, Team& team) {
+        detail::TeamHandler handler(team);
+        detail::decode(document, handler);
+    }
+
+    inline void decode(std::string_view document, Group& group) {
+        detail::GroupHandler handler(group);
+        detail::decode(document, handler);
+    }
+
+    inline void decode(std::string_view document, Tournament& tournament) {
+        detail::TournamentHandler handler(tournament);
+        detail::decode(document, handler);
+    }
+}
+
+#endif //DOMAIN_DOCUMENTDECODER_HPP
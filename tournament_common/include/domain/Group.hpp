@@ -1,32 +1,35 @@
 #ifndef DOMAIN_GROUP_HPP
 #define DOMAIN_GROUP_HPP
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include "domain/Team.hpp"
+#include "domain/Uuid.hpp"
 
 namespace domain {
     class Group {
         /* data */
-        std::string id;
+        Uuid id;
         std::string name;
-        std::string tournamentId;
+        Uuid tournamentId;
         std::vector<Team> teams;
+        std::int64_t version = 0;
 
     public:
-        explicit Group(const std::string_view & name = "", const std::string_view&  id = "") : id(id), name(name), tournamentId("") {
+        explicit Group(const std::string_view & name = "", const Uuid& id = {}) : id(id), name(name) {
         }
 
-        [[nodiscard]] std::string Id() const {
+        [[nodiscard]] const Uuid& Id() const {
             return  id;
         }
 
-        std::string& Id() {
+        Uuid& Id() {
             return  id;
         }
 
-        [[nodiscard]] std::string Name() const {
+        [[nodiscard]] const std::string& Name() const {
             return  name;
         }
 
@@ -34,15 +37,23 @@ namespace domain {
             return  name;
         }
 
-        [[nodiscard]] std::string TournamentId() const {
+        [[nodiscard]] const Uuid& TournamentId() const {
             return  tournamentId;
         }
 
-        [[nodiscard]] std::string & TournamentId() {
+        [[nodiscard]] Uuid & TournamentId() {
             return  tournamentId;
         }
 
-        [[nodiscard]] std::vector<Team> Teams() const {
+        [[nodiscard]] std::int64_t Version() const {
+            return version;
+        }
+
+        std::int64_t & Version() {
+            return version;
+        }
+
+        [[nodiscard]] const std::vector<Team>& Teams() const {
             return this->teams;
         }
 
@@ -1,14 +1,90 @@
 #ifndef DOMAIN_MATCH_HPP
 #define DOMAIN_MATCH_HPP
 
+#include <string>
+#include <string_view>
+
 namespace domain {
+    enum class MatchRound {
+        REGULAR_SEASON,
+        WILD_CARD,
+        DIVISIONAL,
+        CONFERENCE_FINAL,
+        BIG_BOWL
+    };
+
     class Match
     {
-    private:
-        /* data */
+        std::string id;
+        std::string tournamentId;
+        std::string homeTeamId;
+        std::string awayTeamId;
+        int homeScore;
+        int awayScore;
+        MatchRound round;
+
     public:
-        Match(/* args */){}
+        explicit Match(const std::string_view& homeTeamId = "", const std::string_view& awayTeamId = "", int homeScore = 0, int awayScore = 0,
+                       MatchRound round = MatchRound::REGULAR_SEASON)
+            : homeTeamId(homeTeamId), awayTeamId(awayTeamId), homeScore(homeScore), awayScore(awayScore), round(round) {
+        }
+
+        [[nodiscard]] std::string Id() const {
+            return id;
+        }
+
+        std::string& Id() {
+            return id;
+        }
+
+        [[nodiscard]] std::string TournamentId() const {
+            return tournamentId;
+        }
+
+        std::string& TournamentId() {
+            return tournamentId;
+        }
+
+        [[nodiscard]] std::string HomeTeamId() const {
+            return homeTeamId;
+        }
+
+        std::string& HomeTeamId() {
+            return homeTeamId;
+        }
+
+        [[nodiscard]] std::string AwayTeamId() const {
+            return awayTeamId;
+        }
+
+        std::string& AwayTeamId() {
+            return awayTeamId;
+        }
+
+        [[nodiscard]] int HomeScore() const {
+            return homeScore;
+        }
+
+        int& HomeScore() {
+            return homeScore;
+        }
+
+        [[nodiscard]] int AwayScore() const {
+            return awayScore;
+        }
+
+        int& AwayScore() {
+            return awayScore;
+        }
+
+        [[nodiscard]] MatchRound Round() const {
+            return round;
+        }
+
+        MatchRound& Round() {
+            return round;
+        }
     };
     
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,36 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef DOMAIN_STANDING_HPP
+#define DOMAIN_STANDING_HPP
+#include <string>
+#include <tuple>
+
+#include "domain/Uuid.hpp"
+
+namespace domain {
+    // Regular season record of one team in a tournament.
+    struct Standing {
+        Uuid TeamId;
+        std::string TeamName;
+        int Wins = 0;
+        int Losses = 0;
+        int Ties = 0;
+        int NetPoints = 0;
+    };
+
+    // Ranking order: win percentage, counting a tie as half a win, then wins, then net points. Teams that
+    // played a different number of games are compared by cross-multiplying (wins * 2 + ties) / games, so
+    // no fractions are involved. A team without games ranks as .000.
+    inline bool RanksAbove(const Standing& left, const Standing& right) {
+        const auto games = [](const Standing& standing) {
+            const long long played = standing.Wins + standing.Losses + standing.Ties;
+            return played == 0 ? 1LL : played;
+        };
+        const long long leftShare = (left.Wins * 2LL + left.Ties) * games(right);
+        const long long rightShare = (right.Wins * 2LL + right.Ties) * games(left);
+        return std::tie(leftShare, left.Wins, left.NetPoints) > std::tie(rightShare, right.Wins, right.NetPoints);
+    }
+}
+#endif //DOMAIN_STANDING_HPP
@@ -4,12 +4,18 @@
 
 #ifndef RESTAPI_DOMAIN_TEAM_HPP
 #define RESTAPI_DOMAIN_TEAM_HPP
+#include <cstdint>
 #include <string>
 
+#include "domain/Uuid.hpp"
+
 namespace domain {
     struct Team {
-        std::string Id;
+        // nil until the database gave the team one
+        Uuid Id;
         std::string Name;
+        // row version, 0 when the team was not read from the database
+        std::int64_t Version = 0;
     };
 }
 #endif //RESTAPI_DOMAIN_TEAM_HPP
\ No newline at end of file
@@ -1,11 +1,13 @@
 #ifndef DOMAIN_TOURNAMENT_HPP
 #define DOMAIN_TOURNAMENT_HPP
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include "domain/Group.hpp"
 #include "domain/Match.hpp"
+#include "domain/Uuid.hpp"
 
 namespace domain
 {
@@ -61,31 +63,31 @@ namespace domain
 
     class Tournament
     {
-        std::string id;
+        Uuid id;
         std::string name;
         TournamentFormat format;
         std::vector<Group> groups;
         std::vector<Match> matches;
+        std::int64_t version = 0;
 
     public:
         explicit Tournament(const std::string &name = "", const TournamentFormat &format = TournamentFormat(8, 4, TournamentType::NFL))
         {
-            this->id = "";
             this->name = name;
             this->format = format;
         }
 
-        [[nodiscard]] std::string Id() const
+        [[nodiscard]] const Uuid &Id() const
         {
             return this->id;
         }
 
-        std::string &Id()
+        Uuid &Id()
         {
             return this->id;
         }
 
-        [[nodiscard]] std::string Name() const
+        [[nodiscard]] const std::string &Name() const
         {
             return this->name;
         }
@@ -105,6 +107,16 @@ namespace domain
             return this->format;
         }
 
+        [[nodiscard]] std::int64_t Version() const
+        {
+            return this->version;
+        }
+
+        std::int64_t &Version()
+        {
+            return this->version;
+        }
+
         [[nodiscard]] std::vector<Group> &Groups()
         {
             return this->groups;
@@ -1,11 +1,14 @@
 #ifndef DOMAIN_UTILITIES_HPP
 #define DOMAIN_UTILITIES_HPP
 
+#include <stdexcept>
 #include <nlohmann/json.hpp>
 #include "domain/Team.hpp"
 #include "domain/Tournament.hpp"
 #include "domain/Group.hpp"
 #include "domain/Match.hpp"
+#include "domain/Standing.hpp"
+#include "domain/Uuid.hpp"
 
 namespace domain {
     struct DuplicateEntryException : public std::runtime_error {
@@ -16,6 +19,29 @@ namespace domain {
         NotFoundException() : std::runtime_error("Entry not found.") {}
     };
 
+    // The row exists but its version is no longer the one the write was conditioned on.
+    struct VersionMismatchException : public std::runtime_error {
+        VersionMismatchException() : std::runtime_error("Entry was modified, version does not match.") {}
+    };
+
+    // A nil id is written and read as the empty string documents always had for an entity without one.
+    inline void to_json(nlohmann::json& json, const Uuid& id) {
+        json = id.IsNil() ? std::string() : id.ToString();
+    }
+
+    inline void from_json(const nlohmann::json& json, Uuid& id) {
+        const auto& text = json.get_ref<const std::string&>();
+        if (text.empty()) {
+            id = Uuid();
+            return;
+        }
+        const auto parsed = Uuid::Parse(text);
+        if (!parsed) {
+            throw std::invalid_argument(std::string(INVALID_ID_MESSAGE));
+        }
+        id = *parsed;
+    }
+
     inline void to_json(nlohmann::json& json, const Team& team) {
         json = {{"id", team.Id}, {"name", team.Name}};
     }
@@ -44,7 +70,7 @@ namespace domain {
         json = nlohmann::basic_json();
         json["name"] = team->Name;
 
-        if (!team->Id.empty()) {
+        if (!team->Id.IsNil()) {
             json["id"] = team->Id;
         }
     }
@@ -83,7 +109,7 @@ namespace domain {
 
     inline void to_json(nlohmann::json& json, const std::shared_ptr<Tournament>& tournament) {
         json = {{"name", tournament->Name()}};
-        if (!tournament->Id().empty()) {
+        if (!tournament->Id().IsNil()) {
             json["id"] = tournament->Id();
         }
         json["format"] = tournament->Format();
@@ -91,7 +117,7 @@ namespace domain {
 
     inline void from_json(const nlohmann::json& json, std::shared_ptr<Tournament>& tournament) {
         if(json.contains("id")) {
-            tournament->Id() = json["id"].get<std::string>();
+            json.at("id").get_to(tournament->Id());
         }
         json["name"].get_to(tournament->Name());
         if (json.contains("format"))
@@ -100,7 +126,7 @@ namespace domain {
 
     inline void to_json(nlohmann::json& json, const Tournament& tournament) {
         json = {{"name", tournament.Name()}};
-        if (!tournament.Id().empty()) {
+        if (!tournament.Id().IsNil()) {
             json["id"] = tournament.Id();
         }
         json["format"] = tournament.Format();
@@ -108,7 +134,7 @@ namespace domain {
 
     inline void from_json(const nlohmann::json& json, Tournament& tournament) {
         if(json.contains("id")) {
-            tournament.Id() = json["id"].get<std::string>();
+            json.at("id").get_to(tournament.Id());
         }
         json["name"].get_to(tournament.Name());
         if (json.contains("format"))
@@ -132,7 +158,7 @@ namespace domain {
     inline void to_json(nlohmann::json& json, const std::shared_ptr<Group>& group) {
         json["name"] = group->Name();
         json["tournamentId"] = group->TournamentId();
-        if (!group->Id().empty()) {
+        if (!group->Id().IsNil()) {
             json["id"] = group->Id();
         }
         json["teams"] = group->Teams();
@@ -144,7 +170,7 @@ namespace domain {
             auto jsonGroup = nlohmann::json();
             jsonGroup["name"] = group->Name();
             jsonGroup["tournamentId"] = group->TournamentId();
-            if (!group->Id().empty()) {
+            if (!group->Id().IsNil()) {
                 jsonGroup["id"] = group->Id();
             }
             jsonGroup["teams"] = group->Teams();
@@ -155,11 +181,79 @@ namespace domain {
     inline void to_json(nlohmann::json& json, const Group& group) {
         json["name"] = group.Name();
         json["tournamentId"] = group.TournamentId();
-        if (!group.Id().empty()) {
+        if (!group.Id().IsNil()) {
             json["id"] = group.Id();
         }
         json["teams"] = group.Teams();
     }
+
+    inline std::string_view toString(MatchRound round) {
+        switch (round) {
+            case MatchRound::WILD_CARD:
+                return "WILD_CARD";
+            case MatchRound::DIVISIONAL:
+                return "DIVISIONAL";
+            case MatchRound::CONFERENCE_FINAL:
+                return "CONFERENCE_FINAL";
+            case MatchRound::BIG_BOWL:
+                return "BIG_BOWL";
+            default:
+                return "REGULAR_SEASON";
+        }
+    }
+
+    inline MatchRound matchRoundFromString(std::string_view round) {
+        if (round == "WILD_CARD")
+            return MatchRound::WILD_CARD;
+        if (round == "DIVISIONAL")
+            return MatchRound::DIVISIONAL;
+        if (round == "CONFERENCE_FINAL")
+            return MatchRound::CONFERENCE_FINAL;
+        if (round == "BIG_BOWL")
+            return MatchRound::BIG_BOWL;
+        return MatchRound::REGULAR_SEASON;
+    }
+
+    inline void to_json(nlohmann::json& json, const Match& match) {
+        json = {
+            {"tournamentId", match.TournamentId()},
+            {"homeTeamId", match.HomeTeamId()},
+            {"awayTeamId", match.AwayTeamId()},
+            {"homeScore", match.HomeScore()},
+            {"awayScore", match.AwayScore()},
+            {"round", toString(match.Round())}
+        };
+        if (!match.Id().empty()) {
+            json["id"] = match.Id();
+        }
+    }
+
+    inline void from_json(const nlohmann::json& json, Match& match) {
+        if (json.contains("id")) {
+            json.at("id").get_to(match.Id());
+        }
+        if (json.contains("tournamentId")) {
+            json.at("tournamentId").get_to(match.TournamentId());
+        }
+        json.at("homeTeamId").get_to(match.HomeTeamId());
+        json.at("awayTeamId").get_to(match.AwayTeamId());
+        json.at("homeScore").get_to(match.HomeScore());
+        json.at("awayScore").get_to(match.AwayScore());
+        if (json.contains("round")) {
+            match.Round() = matchRoundFromString(json["round"].get<std::string>());
+        }
+    }
+
+    inline void to_json(nlohmann::json& json, const Standing& standing) {
+        json = {
+            {"teamId", standing.TeamId},
+            {"teamName", standing.TeamName},
+            {"wins", standing.Wins},
+            {"losses", standing.Losses},
+            {"ties", standing.Ties},
+            {"netPoints", standing.NetPoints}
+        };
+    }
 }
 
 #endif /* FC7CD637_41CC_48DE_8D8A_BC2CFC528D72 */
\ No newline at end of file
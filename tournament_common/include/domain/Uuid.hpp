@@ -0,0 +1,146 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef DOMAIN_UUID_HPP
+#define DOMAIN_UUID_HPP
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace domain {
+    namespace detail {
+        // 0-15 for a hex digit in either case, 0xFF for anything else
+        inline constexpr std::array<std::uint8_t, 256> HEX_VALUES = [] {
+            std::array<std::uint8_t, 256> values{};
+            values.fill(0xFF);
+            for (int digit = 0; digit < 10; ++digit) {
+                values['0' + digit] = static_cast<std::uint8_t>(digit);
+            }
+            for (int digit = 0; digit < 6; ++digit) {
+                values['a' + digit] = static_cast<std::uint8_t>(10 + digit);
+                values['A' + digit] = static_cast<std::uint8_t>(10 + digit);
+            }
+            return values;
+        }();
+
+        inline constexpr std::string_view HEX_DIGITS = "0123456789abcdef";
+
+        // where the 32 digits sit in the 8-4-4-4-12 text form
+        inline constexpr std::array<std::uint8_t, 32> DIGIT_OFFSETS = [] {
+            std::array<std::uint8_t, 32> offsets{};
+            std::uint8_t offset = 0;
+            for (std::size_t digit = 0; digit < offsets.size(); ++digit) {
+                if (offset == 8 || offset == 13 || offset == 18 || offset == 23) {
+                    ++offset;
+                }
+                offsets[digit] = offset++;
+            }
+            return offsets;
+        }();
+    }
+
+    // A UUID in its 16 bytes rather than 36 characters of text. Trivially copyable, ordered and hashed as
+    // plain memory, parsed and printed through lookup tables without a branch per digit.
+    class Uuid {
+        std::array<std::uint8_t, 16> bytes{};
+
+    public:
+        static constexpr std::size_t TEXT_SIZE = 36;
+
+        constexpr Uuid() = default;
+
+        // The 8-4-4-4-12 hex form in either case, empty for anything else. Every digit is decoded before the
+        // one check at the end, so the loop has no early exit and the compiler is free to vectorize it.
+        [[nodiscard]] static constexpr std::optional<Uuid> Parse(std::string_view text) {
+            if (text.size() != TEXT_SIZE || text[8] != '-' || text[13] != '-' || text[18] != '-' || text[23] != '-') {
+                return std::nullopt;
+            }
+            Uuid uuid;
+            std::uint8_t invalid = 0;
+            for (std::size_t i = 0; i < uuid.bytes.size(); ++i) {
+                const std::uint8_t high = detail::HEX_VALUES[static_cast<unsigned char>(text[detail::DIGIT_OFFSETS[2 * i]])];
+                const std::uint8_t low = detail::HEX_VALUES[static_cast<unsigned char>(text[detail::DIGIT_OFFSETS[2 * i + 1]])];
+                invalid |= high | low;
+                uuid.bytes[i] = static_cast<std::uint8_t>(high << 4 | low);
+            }
+            if ((invalid & 0xF0) != 0) {
+                return std::nullopt;
+            }
+            return uuid;
+        }
+
+        // Writes the lower case text form, TEXT_SIZE characters.
+        constexpr void Format(char* out) const {
+            out[8] = out[13] = out[18] = out[23] = '-';
+            for (std::size_t i = 0; i < bytes.size(); ++i) {
+                out[detail::DIGIT_OFFSETS[2 * i]] = detail::HEX_DIGITS[bytes[i] >> 4];
+                out[detail::DIGIT_OFFSETS[2 * i + 1]] = detail::HEX_DIGITS[bytes[i] & 0x0F];
+            }
+        }
+
+        [[nodiscard]] std::string ToString() const {
+            std::string text(TEXT_SIZE, '\0');
+            Format(text.data());
+            return text;
+        }
+
+        [[nodiscard]] constexpr const std::array<std::uint8_t, 16>& Bytes() const {
+            return bytes;
+        }
+
+        // All zero, the id of an entity the database has not stored yet.
+        [[nodiscard]] constexpr bool IsNil() const {
+            return bytes == std::array<std::uint8_t, 16>{};
+        }
+
+        // Version 4 ids are random, folding the two halves is as good a hash as any.
+        [[nodiscard]] std::size_t Hash() const {
+            std::uint64_t high = 0;
+            std::uint64_t low = 0;
+            std::memcpy(&high, bytes.data(), sizeof(high));
+            std::memcpy(&low, bytes.data() + sizeof(high), sizeof(low));
+            return static_cast<std::size_t>(high ^ low * 0x9E3779B97F4A7C15ULL);
+        }
+
+        constexpr auto operator<=>(const Uuid&) const = default;
+    };
+
+    static_assert(std::is_trivially_copyable_v<Uuid> && sizeof(Uuid) == 16);
+
+    // What the API answers for an id isUuid rejects, wherever it was given.
+    inline constexpr std::string_view INVALID_ID_MESSAGE = "Invalid ID format";
+
+    // True for a well formed id, what path and query parameters are checked with before any lookup.
+    constexpr bool isUuid(std::string_view text) {
+        return Uuid::Parse(text).has_value();
+    }
+}
+
+template<>
+struct std::hash<domain::Uuid> {
+    std::size_t operator()(const domain::Uuid& uuid) const noexcept {
+        return uuid.Hash();
+    }
+};
+
+// Formats as the lower case text form, so messages and headers take an id as they took its string.
+template<>
+struct std::formatter<domain::Uuid> : std::formatter<std::string_view> {
+    auto format(const domain::Uuid& uuid, std::format_context& context) const {
+        char text[domain::Uuid::TEXT_SIZE];
+        uuid.Format(text);
+        return std::formatter<std::string_view>::format(std::string_view(text, sizeof(text)), context);
+    }
+};
+
+#endif //DOMAIN_UUID_HPP
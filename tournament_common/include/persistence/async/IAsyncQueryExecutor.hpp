@@ -0,0 +1,126 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_IASYNCQUERYEXECUTOR_HPP
+#define TOURNAMENTS_IASYNCQUERYEXECUTOR_HPP
+
+#include <concepts>
+#include <coroutine>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "QueryResult.hpp"
+#include "domain/Uuid.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/ReadYourWrites.hpp"
+#include "persistence/configuration/RequestArena.hpp"
+#include "persistence/configuration/RequestDeadline.hpp"
+#include "persistence/configuration/StatementCatalog.hpp"
+
+// One parameter as libpq sends it, an empty value is NULL. Binary values are taken by the server as they
+// are, the statement must give the parameter its type.
+struct QueryParam {
+    std::optional<std::string> value;
+    bool binary = false;
+
+    QueryParam() = default;
+    QueryParam(std::string value, bool binary = false) : value(std::move(value)), binary(binary) {}
+};
+
+// One query on its way through an executor, it lives in the awaiting coroutine's frame until resumed.
+struct PendingQuery {
+    PreparedStatement statement;
+    std::vector<QueryParam> params;
+    QueryResult result;
+    std::optional<QueryException> error;
+    std::coroutine_handle<> continuation;
+    // deadline of the request that issued the query, restored around the continuation wherever it resumes
+    std::optional<RequestDeadline::Clock::time_point> deadline;
+    // arena of the request, the result is copied into it and it is current again once the continuation runs
+    RequestArena* arena = nullptr;
+    // whether the statement writes, an executor may send reads to a replica
+    ConnectionIntent intent = ConnectionIntent::Read;
+    // read-your-writes state of the request, current again once the continuation runs
+    ReadYourWrites* readYourWrites = nullptr;
+};
+
+class IAsyncQueryExecutor {
+public:
+    virtual ~IAsyncQueryExecutor() = default;
+    // Queues the query and returns at once, the continuation is resumed once result or error is set.
+    virtual void Submit(PendingQuery& query) = 0;
+};
+
+inline QueryParam toQueryParam(std::string_view value) { return std::string(value); }
+inline QueryParam toQueryParam(const std::string& value) { return value; }
+inline QueryParam toQueryParam(const char* value) { return std::string(value); }
+template<std::integral T>
+QueryParam toQueryParam(T value) { return std::to_string(value); }
+// the 16 bytes of the id in binary format, the server does not parse them
+inline QueryParam toQueryParam(const domain::Uuid& value) {
+    const auto& bytes = value.Bytes();
+    return {std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size()), true};
+}
+// text form of an array parameter, e.g. for $1::uuid[], ids need no quoting
+inline QueryParam toQueryParam(const std::vector<domain::Uuid>& values) {
+    std::string literal;
+    literal.reserve(2 + values.size() * (domain::Uuid::TEXT_SIZE + 1));
+    literal += '{';
+    char text[domain::Uuid::TEXT_SIZE];
+    for (const auto& value : values) {
+        if (literal.size() > 1) {
+            literal += ',';
+        }
+        value.Format(text);
+        literal.append(text, sizeof(text));
+    }
+    literal += '}';
+    return literal;
+}
+// an empty optional is sent as NULL
+template<typename T>
+QueryParam toQueryParam(const std::optional<T>& value) {
+    return value ? toQueryParam(*value) : QueryParam();
+}
+
+class QueryAwaiter {
+    IAsyncQueryExecutor& executor;
+    PendingQuery query;
+
+public:
+    QueryAwaiter(IAsyncQueryExecutor& executor, ConnectionIntent intent, const PreparedStatement& statement, std::vector<QueryParam> params)
+        : executor(executor), query{statement, std::move(params), QueryResult(RequestArena::Current()), std::nullopt, nullptr,
+                RequestDeadline::Current(), RequestArena::Active(), intent, ReadYourWrites::Active()} {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        query.continuation = handle;
+        // the executor may resume us on another thread before Submit returns, nothing may follow it
+        executor.Submit(query);
+    }
+
+    QueryResult await_resume() {
+        if (query.error) {
+            throw *query.error;
+        }
+        return std::move(query.result);
+    }
+};
+
+// co_await Query(executor, statement, args...) suspends until the row set arrives without holding a thread.
+template<typename... Args>
+QueryAwaiter Query(IAsyncQueryExecutor& executor, const PreparedStatement& statement, Args&&... args) {
+    return QueryAwaiter(executor, ConnectionIntent::Read, statement, {toQueryParam(std::forward<Args>(args))...});
+}
+
+// Like Query for a statement that writes, it always runs on the primary.
+template<typename... Args>
+QueryAwaiter Execute(IAsyncQueryExecutor& executor, const PreparedStatement& statement, Args&&... args) {
+    return QueryAwaiter(executor, ConnectionIntent::Write, statement, {toQueryParam(std::forward<Args>(args))...});
+}
+
+#endif //TOURNAMENTS_IASYNCQUERYEXECUTOR_HPP
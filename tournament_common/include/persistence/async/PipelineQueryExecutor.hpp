@@ -0,0 +1,73 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_PIPELINEQUERYEXECUTOR_HPP
+#define TOURNAMENTS_PIPELINEQUERYEXECUTOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "IAsyncQueryExecutor.hpp"
+
+typedef struct pg_conn PGconn;
+
+// Runs queries over a few libpq connections in pipeline mode. Each connection has one thread that
+// sends whatever was submitted without waiting for earlier results and resumes the awaiting coroutines
+// as their results stream back in order, so a handful of threads keep hundreds of queries in flight.
+class PipelineQueryExecutor : public IAsyncQueryExecutor {
+    class Pipeline {
+        enum class Step { Prepare, Query, Sync };
+
+        struct InFlight {
+            Step step;
+            PendingQuery* query;
+            std::size_t statement;
+        };
+
+        std::string connectionString;
+        std::chrono::milliseconds statementTimeout;
+        PGconn* connection = nullptr;
+        int wakeFd = -1;
+        // statements prepared on this connection, indexed by catalog position
+        std::vector<bool> prepared;
+
+        std::mutex submittedMutex;
+        std::deque<PendingQuery*> submitted;
+        // touched by the pipeline thread only
+        std::deque<InFlight> inFlight;
+
+        // declared last so it stops before the state it uses is destroyed
+        std::jthread worker;
+
+        void connect();
+        void run(std::stop_token stopToken);
+        void send();
+        void receive();
+        void failAll(const std::string& message);
+        void wake() const;
+
+    public:
+        Pipeline(std::string connectionString, std::chrono::milliseconds statementTimeout);
+        ~Pipeline();
+        void Submit(PendingQuery& query);
+    };
+
+    std::vector<std::unique_ptr<Pipeline>> pipelines;
+    std::atomic<std::size_t> next{0};
+
+public:
+    // statementTimeout is set on each connection as its session statement_timeout, 0 keeps the server default
+    PipelineQueryExecutor(std::string_view connectionString, std::size_t connections, std::chrono::milliseconds statementTimeout = {});
+
+    void Submit(PendingQuery& query) override;
+};
+
+#endif //TOURNAMENTS_PIPELINEQUERYEXECUTOR_HPP
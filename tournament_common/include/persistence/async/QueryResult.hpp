@@ -0,0 +1,118 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_QUERYRESULT_HPP
+#define TOURNAMENTS_QUERYRESULT_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "domain/Uuid.hpp"
+
+// A failed asynchronous query, repositories map the SQLSTATE to domain exceptions like they do for pqxx errors.
+struct QueryException : public std::runtime_error {
+    std::string sqlState;
+
+    QueryException(const std::string& message, std::string sqlState) : std::runtime_error(message), sqlState(std::move(sqlState)) {}
+
+    [[nodiscard]] bool IsUniqueViolation() const { return sqlState == "23505"; }
+};
+
+// Rows of one asynchronous query copied out of the libpq result in text format, so nothing ties it to the connection.
+// Cells are kept row after row in one vector and allocated from the memory resource given, the request arena
+// when the query ran inside a request, so a result costs a few bump allocations and no frees.
+class QueryResult {
+    std::pmr::vector<std::pmr::string> columns;
+    std::pmr::vector<std::optional<std::pmr::string>> cells;
+    std::size_t affectedRows = 0;
+
+public:
+    QueryResult() = default;
+    explicit QueryResult(std::pmr::memory_resource* memory) : columns(memory), cells(memory) {}
+
+    void Reserve(std::size_t columnCount, std::size_t rowCount) {
+        columns.reserve(columnCount);
+        cells.reserve(columnCount * rowCount);
+    }
+
+    void AddColumn(std::string_view name) {
+        columns.emplace_back(name);
+    }
+
+    // The next cell, filling the rows in order. An empty optional is NULL.
+    void AddCell(std::optional<std::string_view> value) {
+        if (value) {
+            cells.emplace_back(std::pmr::string(*value, cells.get_allocator()));
+        } else {
+            cells.emplace_back(std::nullopt);
+        }
+    }
+
+    void SetAffectedRows(std::size_t rows) {
+        affectedRows = rows;
+    }
+
+    [[nodiscard]] std::size_t Size() const { return columns.empty() ? 0 : cells.size() / columns.size(); }
+    [[nodiscard]] bool Empty() const { return Size() == 0; }
+    [[nodiscard]] std::size_t AffectedRows() const { return affectedRows; }
+
+    [[nodiscard]] bool IsNull(std::size_t row, std::string_view column) const {
+        return !Cell(row, column).has_value();
+    }
+
+    // Valid as long as the result, copy it into a std::string to keep it past the request.
+    [[nodiscard]] std::string_view Text(std::size_t row, std::string_view column) const {
+        const auto& value = Cell(row, column);
+        return value ? std::string_view(*value) : std::string_view{};
+    }
+
+    [[nodiscard]] int Int(std::size_t row, std::string_view column) const {
+        const std::string_view text = Text(row, column);
+        int value = 0;
+        std::from_chars(text.data(), text.data() + text.size(), value);
+        return value;
+    }
+
+    [[nodiscard]] std::int64_t BigInt(std::size_t row, std::string_view column) const {
+        const std::string_view text = Text(row, column);
+        std::int64_t value = 0;
+        std::from_chars(text.data(), text.data() + text.size(), value);
+        return value;
+    }
+
+    // A NULL or malformed cell reads as the nil id.
+    [[nodiscard]] domain::Uuid Uuid(std::size_t row, std::string_view column) const {
+        return domain::Uuid::Parse(Text(row, column)).value_or(domain::Uuid());
+    }
+
+    [[nodiscard]] bool Bool(std::size_t row, std::string_view column) const {
+        return Text(row, column) == "t";
+    }
+
+    [[nodiscard]] std::size_t Column(std::string_view column) const {
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            if (columns[i] == column) {
+                return i;
+            }
+        }
+        throw std::out_of_range("Unknown column " + std::string(column));
+    }
+
+private:
+    [[nodiscard]] const std::optional<std::pmr::string>& Cell(std::size_t row, std::string_view column) const {
+        if (row >= Size()) {
+            throw std::out_of_range("Row " + std::to_string(row) + " out of range");
+        }
+        return cells[row * columns.size() + Column(column)];
+    }
+};
+
+#endif //TOURNAMENTS_QUERYRESULT_HPP
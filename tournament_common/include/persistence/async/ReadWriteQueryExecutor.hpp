@@ -0,0 +1,40 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_READWRITEQUERYEXECUTOR_HPP
+#define TOURNAMENTS_READWRITEQUERYEXECUTOR_HPP
+
+#include <chrono>
+#include <memory>
+
+#include "IAsyncQueryExecutor.hpp"
+#include "persistence/configuration/ReadYourWrites.hpp"
+
+// ReadWriteConnectionProvider for the async repositories: writes go to the primary executor, reads to the
+// replica one unless the client that issued them wrote within readYourWritesWindow. Submit runs on the
+// thread the coroutine is on, where the executor that resumed it put the request's ReadYourWrites in place.
+class ReadWriteQueryExecutor : public IAsyncQueryExecutor {
+    std::shared_ptr<IAsyncQueryExecutor> primary;
+    std::shared_ptr<IAsyncQueryExecutor> replica;
+    std::chrono::milliseconds readYourWritesWindow;
+
+public:
+    ReadWriteQueryExecutor(std::shared_ptr<IAsyncQueryExecutor> primary,
+                           std::shared_ptr<IAsyncQueryExecutor> replica,
+                           std::chrono::milliseconds readYourWritesWindow)
+        : primary(std::move(primary)), replica(std::move(replica)), readYourWritesWindow(readYourWritesWindow) {}
+
+    void Submit(PendingQuery& query) override {
+        if (query.intent == ConnectionIntent::Write) {
+            ReadYourWrites::RecordWrite(readYourWritesWindow);
+            primary->Submit(query);
+        } else if (ReadYourWrites::Pinned()) {
+            primary->Submit(query);
+        } else {
+            replica->Submit(query);
+        }
+    }
+};
+
+#endif //TOURNAMENTS_READWRITEQUERYEXECUTOR_HPP
@@ -0,0 +1,183 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_TASK_HPP
+#define TOURNAMENTS_TASK_HPP
+
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// Lazily started coroutine, it runs when awaited and resumes its awaiter when done.
+// Where it resumes depends on the last thing it awaited, a query resumes on the pipeline thread.
+template<typename T = void>
+class Task;
+
+namespace detail {
+    struct TaskPromiseBase {
+        std::coroutine_handle<> continuation = std::noop_coroutine();
+        std::exception_ptr exception;
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+                return handle.promise().continuation;
+            }
+
+            void await_resume() noexcept {}
+        };
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        FinalAwaiter final_suspend() noexcept { return {}; }
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+    };
+
+    template<typename T>
+    struct TaskPromise : TaskPromiseBase {
+        std::optional<T> value;
+
+        Task<T> get_return_object() noexcept;
+
+        template<typename U>
+        void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+
+        T result() {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            return std::move(*value);
+        }
+    };
+
+    template<>
+    struct TaskPromise<void> : TaskPromiseBase {
+        Task<void> get_return_object() noexcept;
+
+        void return_void() noexcept {}
+
+        void result() {
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+    };
+}
+
+template<typename T>
+class [[nodiscard]] Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle) {
+                handle.destroy();
+            }
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept {
+        handle.promise().continuation = awaiter;
+        return handle;
+    }
+
+    T await_resume() { return handle.promise().result(); }
+
+private:
+    std::coroutine_handle<promise_type> handle;
+};
+
+namespace detail {
+    template<typename T>
+    Task<T> TaskPromise<T>::get_return_object() noexcept {
+        return Task<T>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+    }
+
+    inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+        return Task<void>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+    }
+
+    // Eagerly started and self destroying, the bridge out of coroutine land.
+    struct Detached {
+        struct promise_type {
+            Detached get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { std::terminate(); }
+        };
+    };
+
+    template<typename T, typename OnDone, typename OnError>
+    Detached run(Task<T> task, OnDone onDone, OnError onError) {
+        std::exception_ptr error;
+        if constexpr (std::is_void_v<T>) {
+            try {
+                co_await std::move(task);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            if (!error) {
+                onDone();
+            }
+        } else {
+            std::optional<T> result;
+            try {
+                result.emplace(co_await std::move(task));
+            } catch (...) {
+                error = std::current_exception();
+            }
+            if (!error) {
+                onDone(std::move(*result));
+            }
+        }
+        if (error) {
+            onError(error);
+        }
+    }
+}
+
+// Starts the task without waiting for it, exactly one of the callbacks runs when it finishes.
+template<typename T, typename OnDone, typename OnError>
+void Spawn(Task<T> task, OnDone onDone, OnError onError) {
+    detail::run(std::move(task), std::move(onDone), std::move(onError));
+}
+
+// Blocks the calling thread until the task finishes, for synchronous callers only, never from a pipeline thread.
+template<typename T>
+T SyncWait(Task<T> task) {
+    std::promise<T> promise;
+    auto future = promise.get_future();
+    if constexpr (std::is_void_v<T>) {
+        Spawn(std::move(task),
+              [&promise] { promise.set_value(); },
+              [&promise](std::exception_ptr error) { promise.set_exception(error); });
+    } else {
+        Spawn(std::move(task),
+              [&promise](T result) { promise.set_value(std::move(result)); },
+              [&promise](std::exception_ptr error) { promise.set_exception(error); });
+    }
+    return future.get();
+}
+
+#endif //TOURNAMENTS_TASK_HPP
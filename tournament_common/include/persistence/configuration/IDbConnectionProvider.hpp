@@ -7,6 +7,9 @@
 
 #include <memory>
 #include <functional>
+#include <stdexcept>
+
+#include "PoolMetrics.hpp"
 
 class IDbConnection {
 public:
@@ -33,9 +36,21 @@ public:
 };
 
 
+// Thrown when no pooled connection could be checked out before the checkout deadline.
+struct ConnectionUnavailableException : public std::runtime_error {
+    ConnectionUnavailableException() : std::runtime_error("Database connection unavailable.") {}
+};
+
+// What a repository call will do with the connection, a provider may route reads to a replica.
+enum class ConnectionIntent {
+    Read,
+    Write
+};
+
 class IDbConnectionProvider {
 public:
     virtual ~IDbConnectionProvider() = default;
-    virtual PooledConnection Connection() = 0;
+    virtual PooledConnection Connection(ConnectionIntent intent) = 0;
+    virtual PoolMetrics Metrics() = 0;
 };
 #endif //TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
\ No newline at end of file
@@ -0,0 +1,97 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_POOLMETRICS_HPP
+#define TOURNAMENTS_POOLMETRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+// Upper bounds (microseconds) of the checkout wait-time histogram buckets, the last bucket is open ended.
+inline constexpr std::array<std::uint64_t, 7> POOL_WAIT_BUCKETS_US{50, 250, 1'000, 5'000, 25'000, 100'000, 500'000};
+
+// Point in time copy of the pool counters.
+struct PoolMetrics {
+    std::size_t poolSize = 0;
+    std::size_t openConnections = 0;
+    std::size_t inUse = 0;
+    std::size_t waiters = 0;
+    std::uint64_t checkouts = 0;
+    std::uint64_t timeouts = 0;
+    // statements cancelled because their request deadline passed
+    std::uint64_t cancellations = 0;
+    double checkoutsPerSecond = 0;
+    std::array<std::uint64_t, POOL_WAIT_BUCKETS_US.size() + 1> waitHistogram{};
+    // connections opened at startup, how long that took and what one connect cost on average and at most
+    std::size_t warmUpConnections = 0;
+    double warmUpMillis = 0;
+    double warmUpConnectAvgMillis = 0;
+    double warmUpConnectMaxMillis = 0;
+};
+
+// Live counters updated by the pool on every checkout, readable without taking the pool lock.
+class PoolStatistics {
+    std::atomic<std::size_t> inUse{0};
+    std::atomic<std::size_t> waiters{0};
+    std::atomic<std::uint64_t> checkouts{0};
+    std::atomic<std::uint64_t> timeouts{0};
+    std::atomic<std::uint64_t> cancellations{0};
+    std::array<std::atomic<std::uint64_t>, POOL_WAIT_BUCKETS_US.size() + 1> waitHistogram{};
+
+    std::mutex rateMutex;
+    std::chrono::steady_clock::time_point lastSampleTime = std::chrono::steady_clock::now();
+    std::uint64_t lastSampleCheckouts = 0;
+    double lastRate = 0;
+
+public:
+    void CheckedOut(std::chrono::steady_clock::duration waited) {
+        const auto micros = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(waited).count());
+        std::size_t bucket = 0;
+        while (bucket < POOL_WAIT_BUCKETS_US.size() && micros > POOL_WAIT_BUCKETS_US[bucket]) {
+            ++bucket;
+        }
+        waitHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+        checkouts.fetch_add(1, std::memory_order_relaxed);
+        inUse.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Returned() { inUse.fetch_sub(1, std::memory_order_relaxed); }
+    void TimedOut() { timeouts.fetch_add(1, std::memory_order_relaxed); }
+    void Cancelled() { cancellations.fetch_add(1, std::memory_order_relaxed); }
+
+    void WaitStarted() { waiters.fetch_add(1); }
+    void WaitFinished() { waiters.fetch_sub(1); }
+    [[nodiscard]] std::size_t Waiters() const { return waiters.load(); }
+
+    // The checkout rate is averaged over the window since the previous snapshot (at least one second).
+    PoolMetrics Snapshot(std::size_t poolSize) {
+        PoolMetrics metrics;
+        metrics.poolSize = poolSize;
+        metrics.inUse = inUse.load(std::memory_order_relaxed);
+        metrics.waiters = waiters.load(std::memory_order_relaxed);
+        metrics.checkouts = checkouts.load(std::memory_order_relaxed);
+        metrics.timeouts = timeouts.load(std::memory_order_relaxed);
+        metrics.cancellations = cancellations.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < waitHistogram.size(); ++i) {
+            metrics.waitHistogram[i] = waitHistogram[i].load(std::memory_order_relaxed);
+        }
+
+        std::lock_guard lock(rateMutex);
+        const auto now = std::chrono::steady_clock::now();
+        const std::chrono::duration<double> elapsed = now - lastSampleTime;
+        if (elapsed.count() >= 1.0) {
+            lastRate = static_cast<double>(metrics.checkouts - lastSampleCheckouts) / elapsed.count();
+            lastSampleTime = now;
+            lastSampleCheckouts = metrics.checkouts;
+        }
+        metrics.checkoutsPerSecond = lastRate;
+
+        return metrics;
+    }
+};
+
+#endif //TOURNAMENTS_POOLMETRICS_HPP
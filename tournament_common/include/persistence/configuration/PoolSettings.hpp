@@ -0,0 +1,23 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_POOLSETTINGS_HPP
+#define TOURNAMENTS_POOLSETTINGS_HPP
+
+#include <chrono>
+#include <cstddef>
+
+struct PoolSettings {
+    // connections opened at startup and never reaped
+    std::size_t minSize = 1;
+    // upper bound for connections opened on demand
+    std::size_t maxSize = 1;
+    std::chrono::milliseconds checkoutTimeout{5000};
+    // an idle connection above minSize is closed after this long without a checkout
+    std::chrono::milliseconds idleTimeout{60000};
+    // session statement_timeout of every pooled connection, 0 keeps the server default
+    std::chrono::milliseconds statementTimeout{0};
+};
+
+#endif //TOURNAMENTS_POOLSETTINGS_HPP
@@ -4,17 +4,162 @@
 
 #ifndef TOURNAMENTS_POSTGRES_CONNECTION_HPP
 #define TOURNAMENTS_POSTGRES_CONNECTION_HPP
+#include <concepts>
+#include <cstddef>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 #include <pqxx/pqxx>
 #include "IDbConnectionProvider.hpp"
+#include "StatementCatalog.hpp"
+#include "domain/Uuid.hpp"
 
+// Text conversion of an id, what result fields are read with (field.as<domain::Uuid>()) and array parameters
+// such as $1::uuid[] are written with. A single id parameter goes through toParam instead.
+template<>
+struct pqxx::nullness<domain::Uuid> : pqxx::no_null<domain::Uuid> {};
+
+template<>
+struct pqxx::string_traits<domain::Uuid> {
+    static constexpr bool converts_to_string{true};
+    static constexpr bool converts_from_string{true};
+
+    static domain::Uuid from_string(std::string_view text) {
+        const auto id = domain::Uuid::Parse(text);
+        if (!id) {
+            throw pqxx::conversion_error("'" + std::string(text) + "' is not a uuid");
+        }
+        return *id;
+    }
+
+    static char* into_buf(char* begin, char* end, const domain::Uuid& value) {
+        if (end - begin < static_cast<std::ptrdiff_t>(size_buffer(value))) {
+            throw pqxx::conversion_overrun("Buffer too small for a uuid");
+        }
+        value.Format(begin);
+        begin[domain::Uuid::TEXT_SIZE] = '\0';
+        return begin + domain::Uuid::TEXT_SIZE + 1;
+    }
+
+    static pqxx::zview to_buf(char* begin, char* end, const domain::Uuid& value) {
+        into_buf(begin, end, value);
+        return {begin, domain::Uuid::TEXT_SIZE};
+    }
+
+    static constexpr std::size_t size_buffer(const domain::Uuid&) noexcept {
+        return domain::Uuid::TEXT_SIZE + 1;
+    }
+};
+
+// An id parameter is sent as its 16 bytes in binary format, which the server stores as they are instead of
+// parsing 36 characters of text. The statement must give the parameter its type, e.g. id = $1 or $1::uuid.
+inline pqxx::bytes_view toParam(const domain::Uuid& id) {
+    return {reinterpret_cast<const std::byte*>(id.Bytes().data()), id.Bytes().size()};
+}
+
+// Anything else goes as pqxx converts it.
+template<typename T>
+    requires (!std::same_as<std::remove_cvref_t<T>, domain::Uuid>)
+T&& toParam(T&& value) {
+    return std::forward<T>(value);
+}
+
+// The parameters of one execution, every domain::Uuid among them bound in binary. The bytes are not copied,
+// the ids must outlive the execution.
+template<typename... Args>
+pqxx::params bindParams(Args&&... args) {
+    return pqxx::params{toParam(std::forward<Args>(args))...};
+}
+
+// How a repository read is wrapped, chosen per call.
+enum class ReadConsistency {
+    // a single statement already sees one consistent snapshot, it runs without BEGIN/COMMIT
+    Statement,
+    // the statements of one read share a read-only repeatable read transaction, so they agree with each
+    // other, and the server rejects any write they attempt
+    ReadOnly
+};
+
+struct PostgresConnection;
+
+// The statements of one multi-statement Read, all executed on its transaction.
+struct ReadSession {
+    PostgresConnection& connection;
+    pqxx::transaction_base& tx;
+
+    template<typename... Args>
+    pqxx::result Exec(const PreparedStatement& statement, Args&&... args);
+};
 
 struct PostgresConnection final : IDbConnection{
     std::unique_ptr<pqxx::connection> connection;
+    // statements already prepared on this connection, indexed by catalog position
+    std::vector<bool> prepared;
+
     explicit PostgresConnection(std::unique_ptr<pqxx::connection> connection) : connection(std::move(connection)) {
     }
+
+    // Swaps the underlying connection, statements prepared on the old one are forgotten.
+    void Reset(std::unique_ptr<pqxx::connection> replacement) {
+        connection = std::move(replacement);
+        prepared.clear();
+    }
+
+    // Prepares the statement on first use and returns the name to execute it with.
+    pqxx::zview Prepare(const PreparedStatement& statement) {
+        StatementCatalog& catalog = StatementCatalog::Instance();
+        if (statement.index >= prepared.size()) {
+            prepared.resize(catalog.Size(), false);
+        }
+        if (prepared[statement.index]) {
+            catalog.Hit(statement);
+        } else {
+            connection->prepare(catalog.Name(statement), catalog.Sql(statement));
+            prepared[statement.index] = true;
+            catalog.Miss(statement);
+        }
+        return catalog.Name(statement);
+    }
+
+    // Runs a read-only statement, mutations keep using their own pqxx::work.
+    template<typename... Args>
+    pqxx::result Read(ReadConsistency consistency, const PreparedStatement& statement, Args&&... args) {
+        const auto name = Prepare(statement);
+        if (consistency == ReadConsistency::ReadOnly) {
+            pqxx::read_transaction tx(*connection);
+            pqxx::result result = tx.exec(pqxx::prepped{name}, bindParams(std::forward<Args>(args)...));
+            tx.commit();
+            return result;
+        }
+        pqxx::nontransaction tx(*connection);
+        return tx.exec(pqxx::prepped{name}, bindParams(std::forward<Args>(args)...));
+    }
+
+    // Runs reads that go together, such as a listing and the lookup telling an empty one from a missing
+    // parent. Under Statement each statement still sees its own snapshot.
+    template<typename Reads>
+        requires std::invocable<Reads&, ReadSession&>
+    auto Read(ReadConsistency consistency, Reads&& reads) {
+        if (consistency == ReadConsistency::ReadOnly) {
+            pqxx::transaction<pqxx::isolation_level::repeatable_read, pqxx::write_policy::read_only> tx(*connection);
+            ReadSession session{*this, tx};
+            auto result = reads(session);
+            tx.commit();
+            return result;
+        }
+        pqxx::nontransaction tx(*connection);
+        ReadSession session{*this, tx};
+        return reads(session);
+    }
 };
 
+template<typename... Args>
+pqxx::result ReadSession::Exec(const PreparedStatement& statement, Args&&... args) {
+    return tx.exec(pqxx::prepped{connection.Prepare(statement)}, bindParams(std::forward<Args>(args)...));
+}
+
 
 
-#endif //TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
\ No newline at end of file
+#endif //TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
@@ -4,87 +4,74 @@
 
 #ifndef TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
 #define TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
-#include <queue>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 #include <pqxx/pqxx>
 
 #include "IDbConnectionProvider.hpp"
+#include "PoolMetrics.hpp"
+#include "PoolSettings.hpp"
 #include "PostgresConnection.hpp"
+#include "RequestDeadline.hpp"
 
 class PostgresConnectionProvider : public IDbConnectionProvider{
-    std::string_view connectionString;
-    size_t poolSize = 1;
-    std::queue<std::unique_ptr<pqxx::connection>> connectionPool;
-    std::mutex connectionPoolMutex;
-    std::condition_variable connectionPoolCondition;
-
-public:
-    PostgresConnectionProvider(std::string_view connectionString, size_t poolSize) : connectionString(connectionString), poolSize(poolSize) {
-        for (size_t i = 0; i < poolSize; i++) {
-            connectionPool.push(std::make_unique<pqxx::connection>(connectionString.data()));
-            connectionPool.back()->prepare("insert_tournament", "insert into TOURNAMENTS (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("select_tournament_by_id", "select * from TOURNAMENTS where id = $1");
+    enum class SlotState : int { Empty, Idle, InUse, Transition };
 
-            connectionPool.back()->prepare("insert_team", "insert into TEAMS (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("select_team_by_id", "select * from TEAMS where id = $1");
-            connectionPool.back()->prepare(
-            "update_team_name",
-                "UPDATE teams SET document = jsonb_set(document, '{name}', to_jsonb($1::text)) WHERE id = $2 RETURNING id"
-            );
-            connectionPool.back()->prepare("delete_team", "delete from TEAMS where id = $1");
+    // A slot owns one connection and its IDbConnection wrapper, both are reused across checkouts.
+    // Empty slots have no open connection and are filled on demand up to maxSize.
+    struct Slot {
+        std::atomic<SlotState> state{SlotState::Empty};
+        std::atomic<std::chrono::steady_clock::rep> lastReleased{0};
+        // request deadline of the current holder, 0 when it has none, CANCELLING while the watchdog cancels its statement
+        std::atomic<std::chrono::steady_clock::rep> deadline{0};
+        PostgresConnection connection{nullptr};
+    };
 
-            connectionPool.back()->prepare("insert_group", "insert into GROUPS (tournament_id, document) values($1, $2) RETURNING id");
-            connectionPool.back()->prepare("delete_group", "DELETE FROM groups WHERE id = $1");
-            connectionPool.back()->prepare("select_group_by_id", "SELECT id, document FROM groups WHERE id = $1");
-            connectionPool.back()->prepare("update_group_name", "UPDATE groups SET document = jsonb_set(document, '{name}', to_jsonb($1::text)) WHERE id = $2 AND tournament_id = $3 RETURNING id");
-            connectionPool.back()->prepare("select_groups_by_tournament", "select * from GROUPS where tournament_id = $1");
-            connectionPool.back()->prepare("select_group_in_tournament", R"(
-                select * from groups
-                where  tournament_id = $1
-                and document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', $2::text)))
-            )");
-
-            connectionPool.back()->prepare("select_group_by_tournamentid_groupid", "select * from GROUPS where tournament_id = $1 and id = $2");
-            // connectionPool.back()->prepare("update_group", "update GROUPS set name = $2, last_update_date = CURRENT_TIMESTAMP where id = $1  RETURNING id");
-            connectionPool.back()->prepare("update_group_add_team", R"(
-                update groups
-                    set document = jsonb_insert(
-                            document, '{teams,-1}', $2
-                                   ),
-                    last_update_date = CURRENT_TIMESTAMP
-                where id = $1
-            )");
-        }
-    }
+    std::string connectionString;
+    PoolSettings settings;
+    std::vector<Slot> slots;
+    std::atomic<size_t> openConnections{0};
+    std::mutex connectionPoolMutex;
+    std::condition_variable connectionPoolCondition;
+    PoolStatistics statistics;
+    // set once by warmUp(), reported with the pool metrics
+    PoolMetrics warmUpMetrics;
 
-    PooledConnection Connection() override {
-        std::unique_lock lock(connectionPoolMutex);
+    std::mutex reaperMutex;
+    std::condition_variable_any reaperCondition;
 
-        // wait until a connection is available
-        connectionPoolCondition.wait(lock, [this] { return !connectionPool.empty(); });
+    static constexpr std::chrono::steady_clock::rep CANCELLING = -1;
 
-        // take one out
-        auto conn = std::move(connectionPool.front());
-        connectionPool.pop();
+    // guards slot deadlines, a holder whose statement is being cancelled waits on cancelCondition before
+    // giving its slot back. The cancels themselves are sent without it.
+    std::mutex watchdogMutex;
+    std::condition_variable_any watchdogCondition;
+    std::condition_variable cancelCondition;
+    std::size_t watchedCheckouts = 0;
 
-        // build PostgresConnection wrapper (adapts pqxx::connection -> IDbConnection)
-        auto dbc = new PostgresConnection(std::move(conn));
+    // declared last so they are stopped before the slots they walk are destroyed
+    std::jthread reaper;
+    std::jthread watchdog;
 
-        // return a RAII PooledConnection
-        return PooledConnection(
-            dbc,
-            [this](IDbConnection* dbc) {
-                auto pc = dynamic_cast<PostgresConnection*>(dbc);
+    void warmUp();
+    std::chrono::steady_clock::duration open(Slot& slot) const;
+    Slot* tryAcquire();
+    Slot* tryGrow();
+    void release(Slot* slot);
+    void reapIdle(std::stop_token stopToken);
+    void watch(Slot* slot, RequestDeadline::Clock::time_point deadline);
+    void cancelExpired(std::stop_token stopToken);
 
-                {
-                    std::lock_guard<std::mutex> lock(connectionPoolMutex);
-                    connectionPool.push(std::move(pc->connection));
-                }
+public:
+    PostgresConnectionProvider(std::string_view connectionString, const PoolSettings& settings);
 
-                delete pc;
-                connectionPoolCondition.notify_one();
-            }
-        );
-    }
+    // one pool serves both intents, ReadWriteConnectionProvider splits them across two of these
+    PooledConnection Connection(ConnectionIntent intent) override;
+    PoolMetrics Metrics() override;
 };
-#endif //TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
\ No newline at end of file
+#endif //TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
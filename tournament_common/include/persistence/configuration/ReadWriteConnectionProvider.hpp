@@ -0,0 +1,67 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_READWRITECONNECTIONPROVIDER_HPP
+#define TOURNAMENTS_READWRITECONNECTIONPROVIDER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+#include "IDbConnectionProvider.hpp"
+#include "ReadYourWrites.hpp"
+
+// Sends writes to the primary pool and reads to the replica pool. A client that wrote keeps reading
+// from the primary for readYourWritesWindow, a zero window always reads from the replica.
+class ReadWriteConnectionProvider : public IDbConnectionProvider {
+    std::shared_ptr<IDbConnectionProvider> primary;
+    std::shared_ptr<IDbConnectionProvider> replica;
+    std::chrono::milliseconds readYourWritesWindow;
+
+public:
+    ReadWriteConnectionProvider(std::shared_ptr<IDbConnectionProvider> primary,
+                                std::shared_ptr<IDbConnectionProvider> replica,
+                                std::chrono::milliseconds readYourWritesWindow)
+        : primary(std::move(primary)), replica(std::move(replica)), readYourWritesWindow(readYourWritesWindow) {}
+
+    PooledConnection Connection(ConnectionIntent intent) override {
+        if (intent == ConnectionIntent::Write) {
+            ReadYourWrites::RecordWrite(readYourWritesWindow);
+            return primary->Connection(intent);
+        }
+        if (ReadYourWrites::Pinned()) {
+            return primary->Connection(intent);
+        }
+        return replica->Connection(intent);
+    }
+
+    // Both pools added together, /metrics/db-pool keeps reporting one pool.
+    PoolMetrics Metrics() override {
+        PoolMetrics metrics = primary->Metrics();
+        const PoolMetrics replicaMetrics = replica->Metrics();
+        metrics.poolSize += replicaMetrics.poolSize;
+        metrics.openConnections += replicaMetrics.openConnections;
+        metrics.inUse += replicaMetrics.inUse;
+        metrics.waiters += replicaMetrics.waiters;
+        metrics.checkouts += replicaMetrics.checkouts;
+        metrics.timeouts += replicaMetrics.timeouts;
+        metrics.cancellations += replicaMetrics.cancellations;
+        metrics.checkoutsPerSecond += replicaMetrics.checkoutsPerSecond;
+        for (std::size_t i = 0; i < metrics.waitHistogram.size(); ++i) {
+            metrics.waitHistogram[i] += replicaMetrics.waitHistogram[i];
+        }
+        // the pools warm up one after the other
+        const auto connections = metrics.warmUpConnections + replicaMetrics.warmUpConnections;
+        if (connections > 0) {
+            metrics.warmUpConnectAvgMillis = (metrics.warmUpConnectAvgMillis * static_cast<double>(metrics.warmUpConnections)
+                + replicaMetrics.warmUpConnectAvgMillis * static_cast<double>(replicaMetrics.warmUpConnections)) / static_cast<double>(connections);
+        }
+        metrics.warmUpConnections = connections;
+        metrics.warmUpMillis += replicaMetrics.warmUpMillis;
+        metrics.warmUpConnectMaxMillis = std::max(metrics.warmUpConnectMaxMillis, replicaMetrics.warmUpConnectMaxMillis);
+        return metrics;
+    }
+};
+
+#endif //TOURNAMENTS_READWRITECONNECTIONPROVIDER_HPP
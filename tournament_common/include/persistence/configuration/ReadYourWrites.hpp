@@ -0,0 +1,66 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_READYOURWRITES_HPP
+#define TOURNAMENTS_READYOURWRITES_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+
+// Until when the reads of one client stay on the primary, so they see its writes before the replicas
+// catch up. A write pins the client for the window, the route hands the pin back to the client in a cookie
+// and restores it from there on the client's next request. Wall clock time, the cookie may come back to
+// another instance. Like RequestArena the state in use is per thread, a Scope sets it around each request
+// and the async executor restores it wherever a query resumes.
+class ReadYourWrites {
+public:
+    using Clock = std::chrono::system_clock;
+
+private:
+    static inline thread_local ReadYourWrites* current = nullptr;
+
+    std::optional<Clock::time_point> pinnedUntil;
+    bool wrote = false;
+
+public:
+    explicit ReadYourWrites(std::optional<Clock::time_point> pinnedUntil = std::nullopt) : pinnedUntil(pinnedUntil) {}
+
+    ReadYourWrites(const ReadYourWrites&) = delete;
+    ReadYourWrites& operator=(const ReadYourWrites&) = delete;
+
+    struct Scope {
+        ReadYourWrites* previous;
+
+        explicit Scope(ReadYourWrites* state) : previous(current) { current = state; }
+        ~Scope() { current = previous; }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    // The state of the request running on this thread, null outside of one.
+    [[nodiscard]] static ReadYourWrites* Active() {
+        return current;
+    }
+
+    // Outside of a request there is no client to pin, the write is not remembered.
+    static void RecordWrite(std::chrono::milliseconds window) {
+        if (current == nullptr || window.count() <= 0) {
+            return;
+        }
+        const auto until = Clock::now() + window;
+        current->pinnedUntil = std::max(current->pinnedUntil.value_or(until), until);
+        current->wrote = true;
+    }
+
+    [[nodiscard]] static bool Pinned() {
+        return current != nullptr && current->pinnedUntil.has_value() && Clock::now() < *current->pinnedUntil;
+    }
+
+    // Set once this request wrote, the pin then has to reach the client.
+    [[nodiscard]] bool Wrote() const { return wrote; }
+    [[nodiscard]] std::optional<Clock::time_point> PinnedUntil() const { return pinnedUntil; }
+};
+
+#endif //TOURNAMENTS_READYOURWRITES_HPP
@@ -0,0 +1,147 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_REQUESTARENA_HPP
+#define TOURNAMENTS_REQUESTARENA_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+// Memory for the rows and cells of a request's async queries, the one thing it builds and drops again
+// before it answers. Allocations are bumped out of a few blocks and the whole arena is released at once
+// when the response is finished. Like RequestDeadline the arena in use is per thread, a Scope sets it
+// around each request and the async executor restores it wherever a query resumes. Domain objects,
+// decoded requests and response bodies are not allocated from it: they outlive the request in the
+// response cache, the producer and crow. An arena is not locked, a request runs on one thread at a time
+// and awaits one query at a time. Builds counting heap allocations also charge to it every one made while
+// its Scope is set.
+class RequestArena final : public std::pmr::memory_resource {
+public:
+    struct Stats {
+        std::uint64_t requests = 0;
+        // allocations served by arenas, and their bytes
+        std::uint64_t allocations = 0;
+        std::uint64_t bytes = 0;
+        // blocks the arenas took from the heap for them
+        std::uint64_t blocks = 0;
+        // global operator new calls made while a request's arena was set, zero unless the build counts them
+        std::uint64_t heapAllocations = 0;
+    };
+
+private:
+    // Heap under the bump allocator, counting how often the arena had to grow.
+    class Upstream final : public std::pmr::memory_resource {
+    public:
+        std::size_t blocks = 0;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++blocks;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    static inline thread_local RequestArena* current = nullptr;
+    static inline thread_local std::uint64_t threadHeapAllocations = 0;
+    static inline std::atomic<std::uint64_t> totalRequests{0};
+    static inline std::atomic<std::uint64_t> totalAllocations{0};
+    static inline std::atomic<std::uint64_t> totalBytes{0};
+    static inline std::atomic<std::uint64_t> totalBlocks{0};
+    static inline std::atomic<std::uint64_t> totalHeapAllocations{0};
+
+    Upstream upstream;
+    std::pmr::monotonic_buffer_resource buffer;
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+    std::size_t heapAllocations = 0;
+
+    void* do_allocate(std::size_t size, std::size_t alignment) override {
+        ++allocations;
+        bytes += size;
+        return buffer.allocate(size, alignment);
+    }
+
+    // Freed with the arena, single deallocations are no-ops.
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    // The first block is only taken once something is allocated, requests that never query cost nothing.
+    explicit RequestArena(std::size_t initialBytes = 8 * 1024) : buffer(initialBytes, &upstream) {}
+
+    ~RequestArena() override {
+        totalRequests.fetch_add(1, std::memory_order_relaxed);
+        totalAllocations.fetch_add(allocations, std::memory_order_relaxed);
+        totalBytes.fetch_add(bytes, std::memory_order_relaxed);
+        totalBlocks.fetch_add(upstream.blocks, std::memory_order_relaxed);
+        totalHeapAllocations.fetch_add(heapAllocations, std::memory_order_relaxed);
+    }
+
+    RequestArena(const RequestArena&) = delete;
+    RequestArena& operator=(const RequestArena&) = delete;
+
+    // Heap allocations made on the thread while the scope is set go to its arena, once: a scope setting
+    // the arena that is already in place, as a query resuming inline does, leaves them to the outer one.
+    struct Scope {
+        RequestArena* previous;
+        std::uint64_t heapStart;
+
+        explicit Scope(RequestArena* arena) : previous(current), heapStart(threadHeapAllocations) { current = arena; }
+        ~Scope() {
+            if (current != nullptr && current != previous) {
+                current->heapAllocations += threadHeapAllocations - heapStart;
+            }
+            current = previous;
+        }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    // The arena of the request running on this thread, null outside of one.
+    [[nodiscard]] static RequestArena* Active() {
+        return current;
+    }
+
+    // Where request scoped containers allocate, the default resource outside of a request.
+    [[nodiscard]] static std::pmr::memory_resource* Current() {
+        return current != nullptr ? static_cast<std::pmr::memory_resource*>(current) : std::pmr::get_default_resource();
+    }
+
+    [[nodiscard]] std::size_t Allocations() const { return allocations; }
+    [[nodiscard]] std::size_t Bytes() const { return bytes; }
+    [[nodiscard]] std::size_t Blocks() const { return upstream.blocks; }
+    [[nodiscard]] std::size_t HeapAllocations() const { return heapAllocations; }
+
+    // Called for each allocation on this thread by the replacement of the global operator new that builds
+    // with COUNT_HEAP_ALLOCATIONS link. Must not allocate.
+    static void CountHeapAllocation() noexcept {
+        ++threadHeapAllocations;
+    }
+
+    // Counters of every arena released so far in this process.
+    [[nodiscard]] static Stats Totals() {
+        return Stats{
+            totalRequests.load(std::memory_order_relaxed),
+            totalAllocations.load(std::memory_order_relaxed),
+            totalBytes.load(std::memory_order_relaxed),
+            totalBlocks.load(std::memory_order_relaxed),
+            totalHeapAllocations.load(std::memory_order_relaxed)
+        };
+    }
+};
+
+#endif //TOURNAMENTS_REQUESTARENA_HPP
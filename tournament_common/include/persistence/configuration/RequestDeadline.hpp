@@ -0,0 +1,53 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_REQUESTDEADLINE_HPP
+#define TOURNAMENTS_REQUESTDEADLINE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+
+// Thrown when the request deadline passed before the database work it needed could finish.
+struct DeadlineExceededException : public std::runtime_error {
+    DeadlineExceededException() : std::runtime_error("Request deadline exceeded.") {}
+};
+
+// The point in time the current request must be answered by. Pool checkouts wait no longer than it
+// and statements still running when it passes are cancelled. Like ReadYourWrites the state is per
+// thread, a Scope sets it around each request and restores whatever was there before.
+class RequestDeadline {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    static inline thread_local std::optional<Clock::time_point> deadline;
+
+public:
+    struct Scope {
+        std::optional<Clock::time_point> previous;
+
+        explicit Scope(std::optional<Clock::time_point> until) : previous(deadline) { deadline = until; }
+        ~Scope() { deadline = previous; }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    [[nodiscard]] static std::optional<Clock::time_point> Current() {
+        return deadline;
+    }
+
+    [[nodiscard]] static bool Expired() {
+        return deadline.has_value() && Clock::now() >= *deadline;
+    }
+
+    // Earliest of the deadline and now + limit, the bound a wait of at most limit may use.
+    [[nodiscard]] static Clock::time_point Bound(Clock::duration limit) {
+        const auto bound = Clock::now() + limit;
+        return deadline.has_value() ? std::min(*deadline, bound) : bound;
+    }
+};
+
+#endif //TOURNAMENTS_REQUESTDEADLINE_HPP
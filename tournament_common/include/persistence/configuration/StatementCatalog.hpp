@@ -0,0 +1,73 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_STATEMENTCATALOG_HPP
+#define TOURNAMENTS_STATEMENTCATALOG_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Handle to a statement declared in the catalog, repositories keep one per query.
+struct PreparedStatement {
+    std::size_t index;
+};
+
+struct StatementStats {
+    std::string name;
+    std::uint64_t hits;
+    std::uint64_t misses;
+};
+
+// Every SQL statement the repositories run is declared here once, by name, during static initialization.
+// Connections prepare a statement the first time they execute it, a miss, and reuse it afterwards, a hit.
+class StatementCatalog {
+    struct Entry {
+        std::string name;
+        std::string sql;
+        std::atomic<std::uint64_t> hits{0};
+        std::atomic<std::uint64_t> misses{0};
+    };
+
+    // a deque keeps entries in place while later declarations are appended
+    std::deque<Entry> entries;
+    mutable std::mutex mutex;
+
+public:
+    static StatementCatalog& Instance() {
+        static StatementCatalog catalog;
+        return catalog;
+    }
+
+    static PreparedStatement Declare(std::string_view name, std::string_view sql) {
+        StatementCatalog& catalog = Instance();
+        std::lock_guard lock(catalog.mutex);
+        Entry& entry = catalog.entries.emplace_back();
+        entry.name = name;
+        entry.sql = sql;
+        return PreparedStatement{catalog.entries.size() - 1};
+    }
+
+    [[nodiscard]] const std::string& Name(const PreparedStatement& statement) const { return entries[statement.index].name; }
+    [[nodiscard]] const std::string& Sql(const PreparedStatement& statement) const { return entries[statement.index].sql; }
+    [[nodiscard]] std::size_t Size() const { return entries.size(); }
+
+    void Hit(const PreparedStatement& statement) { entries[statement.index].hits.fetch_add(1, std::memory_order_relaxed); }
+    void Miss(const PreparedStatement& statement) { entries[statement.index].misses.fetch_add(1, std::memory_order_relaxed); }
+
+    [[nodiscard]] std::vector<StatementStats> Stats() const {
+        std::lock_guard lock(mutex);
+        std::vector<StatementStats> stats;
+        stats.reserve(entries.size());
+        for (const auto& entry : entries) {
+            stats.push_back({entry.name, entry.hits.load(std::memory_order_relaxed), entry.misses.load(std::memory_order_relaxed)});
+        }
+        return stats;
+    }
+};
+
+#endif //TOURNAMENTS_STATEMENTCATALOG_HPP
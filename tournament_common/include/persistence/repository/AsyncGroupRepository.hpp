@@ -0,0 +1,30 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_ASYNCGROUPREPOSITORY_HPP
+#define TOURNAMENTS_ASYNCGROUPREPOSITORY_HPP
+
+#include <memory>
+#include <string>
+
+#include "IAsyncGroupRepository.hpp"
+#include "persistence/async/IAsyncQueryExecutor.hpp"
+
+class AsyncGroupRepository : public IAsyncGroupRepository {
+    std::shared_ptr<IAsyncQueryExecutor> executor;
+public:
+    explicit AsyncGroupRepository(std::shared_ptr<IAsyncQueryExecutor> executor);
+    Task<std::shared_ptr<domain::Group>> ReadById(domain::Uuid id) override;
+    Task<domain::Uuid> Create(domain::Group entity) override;
+    Task<domain::Uuid> Update(domain::Group entity) override;
+    Task<void> Delete(domain::Uuid id) override;
+    Task<std::vector<std::shared_ptr<domain::Group>>> ReadAll() override;
+    Task<std::vector<std::shared_ptr<domain::Group>>> FindByTournamentId(domain::Uuid tournamentId) override;
+    Task<std::optional<std::string>> FindJsonByTournamentId(domain::Uuid tournamentId) override;
+    Task<std::shared_ptr<domain::Group>> FindByTournamentIdAndGroupId(domain::Uuid tournamentId, domain::Uuid groupId) override;
+    Task<std::optional<std::int64_t>> FindVersion(domain::Uuid tournamentId, domain::Uuid groupId) override;
+    Task<AddTeamStatus> AddTeamToGroup(domain::Uuid tournamentId, domain::Uuid groupId, domain::Uuid teamId, std::size_t maxTeams) override;
+};
+
+#endif //TOURNAMENTS_ASYNCGROUPREPOSITORY_HPP
@@ -0,0 +1,27 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_ASYNCTOURNAMENTREPOSITORY_HPP
+#define TOURNAMENTS_ASYNCTOURNAMENTREPOSITORY_HPP
+
+#include <memory>
+#include <string>
+
+#include "IAsyncRepository.hpp"
+#include "domain/Tournament.hpp"
+#include "domain/Uuid.hpp"
+#include "persistence/async/IAsyncQueryExecutor.hpp"
+
+class AsyncTournamentRepository : public IAsyncRepository<domain::Tournament, domain::Uuid> {
+    std::shared_ptr<IAsyncQueryExecutor> executor;
+public:
+    explicit AsyncTournamentRepository(std::shared_ptr<IAsyncQueryExecutor> executor);
+    Task<std::shared_ptr<domain::Tournament>> ReadById(domain::Uuid id) override;
+    Task<domain::Uuid> Create(domain::Tournament entity) override;
+    Task<domain::Uuid> Update(domain::Tournament entity) override;
+    Task<void> Delete(domain::Uuid id) override;
+    Task<std::vector<std::shared_ptr<domain::Tournament>>> ReadAll() override;
+};
+
+#endif //TOURNAMENTS_ASYNCTOURNAMENTREPOSITORY_HPP
@@ -17,15 +17,16 @@ class GroupRepository : public IGroupRepository {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
 public:
     explicit GroupRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
-    std::shared_ptr<domain::Group> ReadById(std::string id) override;
-    std::string Create (const domain::Group & entity) override;
-    std::string Update (const domain::Group & entity) override;
-    void Delete(std::string id) override;
+    std::shared_ptr<domain::Group> ReadById(domain::Uuid id) override;
+    domain::Uuid Create (const domain::Group & entity) override;
+    domain::Uuid Update (const domain::Group & entity) override;
+    void Delete(domain::Uuid id) override;
     std::vector<std::shared_ptr<domain::Group>> ReadAll() override;
-    std::vector<std::shared_ptr<domain::Group>> FindByTournamentId(const std::string_view& tournamentId) override;
-    std::shared_ptr<domain::Group> FindByTournamentIdAndGroupId(const std::string_view& tournamentId, const std::string_view& groupId) override;
-    std::shared_ptr<domain::Group> FindByTournamentIdAndTeamId(const std::string_view& tournamentId, const std::string_view& teamId) override;
-    void UpdateGroupAddTeam(std::string_view groupId, const domain::Team & team) override;
+    std::vector<std::shared_ptr<domain::Group>> FindByTournamentId(const domain::Uuid& tournamentId) override;
+    std::shared_ptr<domain::Group> FindByTournamentIdAndGroupId(const domain::Uuid& tournamentId, const domain::Uuid& groupId) override;
+    std::shared_ptr<domain::Group> FindByTournamentIdAndTeamId(const domain::Uuid& tournamentId, const domain::Uuid& teamId) override;
+    std::vector<domain::Uuid> FindGroupedTeamIds(const domain::Uuid& tournamentId, const std::vector<domain::Uuid>& teamIds) override;
+    AddTeamStatus AddTeamToGroup(const domain::Uuid& tournamentId, const domain::Uuid& groupId, const domain::Uuid& teamId, std::size_t maxTeams) override;
     virtual ~GroupRepository() = default;
 };
 
@@ -0,0 +1,30 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef COMMON_IASYNCGROUPREPOSITORY_HPP
+#define COMMON_IASYNCGROUPREPOSITORY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "domain/Group.hpp"
+#include "domain/Uuid.hpp"
+#include "IAsyncRepository.hpp"
+#include "IGroupRepository.hpp"
+
+// Arguments are taken by value, a suspended call must not point into its caller's frame.
+class IAsyncGroupRepository : public IAsyncRepository<domain::Group, domain::Uuid> {
+public:
+    virtual Task<std::vector<std::shared_ptr<domain::Group>>> FindByTournamentId(domain::Uuid tournamentId) = 0;
+    // The tournament's groups as the JSON array GET /tournaments/{id}/groups answers with, built by the database
+    // so the service forwards it untouched. Empty when the tournament does not exist.
+    virtual Task<std::optional<std::string>> FindJsonByTournamentId(domain::Uuid tournamentId) = 0;
+    virtual Task<std::shared_ptr<domain::Group>> FindByTournamentIdAndGroupId(domain::Uuid tournamentId, domain::Uuid groupId) = 0;
+    // Current version of the group without reading its document, empty when the group is not in the tournament.
+    virtual Task<std::optional<std::int64_t>> FindVersion(domain::Uuid tournamentId, domain::Uuid groupId) = 0;
+    virtual Task<AddTeamStatus> AddTeamToGroup(domain::Uuid tournamentId, domain::Uuid groupId, domain::Uuid teamId, std::size_t maxTeams) = 0;
+};
+#endif //COMMON_IASYNCGROUPREPOSITORY_HPP
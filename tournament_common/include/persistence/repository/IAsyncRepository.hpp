@@ -0,0 +1,24 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef COMMON_IASYNCREPOSITORY_HPP
+#define COMMON_IASYNCREPOSITORY_HPP
+
+#include <memory>
+#include <vector>
+
+#include "persistence/async/Task.hpp"
+
+// Same operations as IRepository, each one suspends the caller instead of blocking a thread on the round trip.
+template<typename Type, typename Id>
+class IAsyncRepository {
+public:
+    virtual ~IAsyncRepository() = default;
+    virtual Task<std::shared_ptr<Type>> ReadById(Id id) = 0;
+    virtual Task<Id> Create(Type entity) = 0;
+    virtual Task<Id> Update(Type entity) = 0;
+    virtual Task<void> Delete(Id id) = 0;
+    virtual Task<std::vector<std::shared_ptr<Type>>> ReadAll() = 0;
+};
+#endif //COMMON_IASYNCREPOSITORY_HPP
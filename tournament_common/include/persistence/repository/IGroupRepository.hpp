@@ -5,15 +5,45 @@
 #ifndef COMMON_IGROUPREPOSITORY_HPP
 #define COMMON_IGROUPREPOSITORY_HPP
 
+#include <cstddef>
+#include <format>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
 #include "domain/Group.hpp"
+#include "domain/Uuid.hpp"
 #include "IRepository.hpp"
 
+// Outcome of IGroupRepository::AddTeamToGroup, every check runs in the same statement as the insert.
+enum class AddTeamStatus {
+    Added,
+    GroupNotFound,
+    GroupFull,
+    TeamNotFound,
+    TeamAlreadyGrouped
+};
+
+// Maps the text add_team_to_group returns. Any other value means the database function and this enum
+// disagree, which is reported rather than taken for success.
+inline AddTeamStatus parseAddTeamStatus(std::string_view status) {
+    if (status == "ADDED") return AddTeamStatus::Added;
+    if (status == "GROUP_NOT_FOUND") return AddTeamStatus::GroupNotFound;
+    if (status == "GROUP_FULL") return AddTeamStatus::GroupFull;
+    if (status == "TEAM_NOT_FOUND") return AddTeamStatus::TeamNotFound;
+    if (status == "TEAM_ALREADY_GROUPED") return AddTeamStatus::TeamAlreadyGrouped;
+    throw std::runtime_error(std::format("unknown add_team_to_group status '{}'", status));
+}
 
-class IGroupRepository : public IRepository<domain::Group, std::string> {
+class IGroupRepository : public IRepository<domain::Group, domain::Uuid> {
 public:
-    virtual std::vector<std::shared_ptr<domain::Group>> FindByTournamentId(const std::string_view& tournamentId) = 0;
-    virtual std::shared_ptr<domain::Group> FindByTournamentIdAndGroupId(const std::string_view& tournamentId, const std::string_view& groupId) = 0;
-    virtual std::shared_ptr<domain::Group> FindByTournamentIdAndTeamId(const std::string_view& tournamentId, const std::string_view& teamId) = 0;
-    virtual void UpdateGroupAddTeam(std::string_view groupId, const domain::Team & team) = 0;
+    virtual std::vector<std::shared_ptr<domain::Group>> FindByTournamentId(const domain::Uuid& tournamentId) = 0;
+    virtual std::shared_ptr<domain::Group> FindByTournamentIdAndGroupId(const domain::Uuid& tournamentId, const domain::Uuid& groupId) = 0;
+    virtual std::shared_ptr<domain::Group> FindByTournamentIdAndTeamId(const domain::Uuid& tournamentId, const domain::Uuid& teamId) = 0;
+    // Returns which of teamIds already belong to a group of the tournament, in one statement.
+    virtual std::vector<domain::Uuid> FindGroupedTeamIds(const domain::Uuid& tournamentId, const std::vector<domain::Uuid>& teamIds) = 0;
+    // Appends the team to the group unless the group is full, the team does not exist or is already grouped.
+    // The group row is locked for the check, so concurrent adds cannot overfill it.
+    virtual AddTeamStatus AddTeamToGroup(const domain::Uuid& tournamentId, const domain::Uuid& groupId, const domain::Uuid& teamId, std::size_t maxTeams) = 0;
 };
 #endif //COMMON_IGROUPREPOSITORY_HPP
\ No newline at end of file
@@ -0,0 +1,27 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef COMMON_IMATCHREPOSITORY_HPP
+#define COMMON_IMATCHREPOSITORY_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "domain/Match.hpp"
+#include "IRepository.hpp"
+
+class IMatchRepository : public IRepository<domain::Match, std::string> {
+public:
+    // Inserts every match in a single statement and returns their ids in input order.
+    virtual std::vector<std::string> CreateMany(const std::vector<domain::Match>& matches) = 0;
+    // Looks the match up inside its tournament's partition. Prefer these over ReadById and Delete, which
+    // only know the id and have to consult every partition's id index.
+    virtual std::shared_ptr<domain::Match> FindByTournamentIdAndId(std::string_view tournamentId, std::string_view id) = 0;
+    virtual void DeleteByTournamentIdAndId(std::string_view tournamentId, std::string_view id) = 0;
+    virtual std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(std::string_view tournamentId) = 0;
+    // Matches the team played in the tournament, home or away.
+    virtual std::vector<std::shared_ptr<domain::Match>> FindByTournamentIdAndTeamId(std::string_view tournamentId, std::string_view teamId) = 0;
+};
+#endif //COMMON_IMATCHREPOSITORY_HPP
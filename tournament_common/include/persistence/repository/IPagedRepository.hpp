@@ -0,0 +1,28 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef COMMON_IPAGEDREPOSITORY_HPP
+#define COMMON_IPAGEDREPOSITORY_HPP
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "domain/Uuid.hpp"
+
+template<typename Type>
+class IPagedRepository {
+public:
+    virtual ~IPagedRepository() = default;
+    // Up to limit entities ordered by id, starting right after the given id, walked through the primary key index.
+    virtual std::vector<std::shared_ptr<Type>> ReadPage(const std::optional<domain::Uuid>& after, std::size_t limit) = 0;
+    // Hands every entity in id order to writeRow, each already serialized as a JSON object, as the rows
+    // arrive rather than as one result set. False, with nothing written, when there are more than limit:
+    // only their ids are counted before anything is serialized.
+    virtual bool ExportAll(const std::function<void(std::string_view)>& writeRow, std::size_t limit) = 0;
+};
+#endif //COMMON_IPAGEDREPOSITORY_HPP
@@ -0,0 +1,22 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef COMMON_ISTANDINGREPOSITORY_HPP
+#define COMMON_ISTANDINGREPOSITORY_HPP
+
+#include <optional>
+#include <vector>
+
+#include "domain/Standing.hpp"
+#include "domain/Uuid.hpp"
+
+// STANDINGS is written by the database alongside every match change, this side only reads it.
+class IStandingRepository {
+public:
+    virtual ~IStandingRepository() = default;
+    // One row per team in no particular order, callers rank them with domain::RanksAbove. Empty when the
+    // tournament does not exist, which a tournament without teams yet is told apart from.
+    virtual std::optional<std::vector<domain::Standing>> FindByTournamentId(const domain::Uuid& tournamentId) = 0;
+};
+#endif //COMMON_ISTANDINGREPOSITORY_HPP
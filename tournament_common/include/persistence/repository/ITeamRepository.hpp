@@ -0,0 +1,35 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef COMMON_ITEAMREPOSITORY_HPP
+#define COMMON_ITEAMREPOSITORY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "domain/Team.hpp"
+#include "domain/Uuid.hpp"
+#include "IPagedRepository.hpp"
+#include "IRepository.hpp"
+
+// Outcome of a bulk import, rows keep the position they had in the request.
+struct BulkImportResult {
+    // id given to each row, nil when the row was rejected
+    std::vector<domain::Uuid> ids;
+    // rows whose name already exists or repeats an earlier row of the same import
+    std::vector<std::size_t> conflicts;
+};
+
+class ITeamRepository : public IRepository<domain::Team, domain::Uuid>, public IPagedRepository<domain::Team> {
+public:
+    // Reads every existing team among ids in one statement, ids that do not exist are left out.
+    virtual std::vector<std::shared_ptr<domain::Team>> ReadByIds(const std::vector<domain::Uuid>& ids) = 0;
+    // Inserts all teams in one transaction, conflicting names are reported instead of aborting the import.
+    virtual BulkImportResult CreateMany(const std::vector<domain::Team>& teams) = 0;
+    // Current version of the team without reading its document, empty when the team does not exist.
+    virtual std::optional<std::int64_t> ReadVersion(domain::Uuid id) = 0;
+};
+#endif //COMMON_ITEAMREPOSITORY_HPP
@@ -0,0 +1,21 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef COMMON_ITOURNAMENTREPOSITORY_HPP
+#define COMMON_ITOURNAMENTREPOSITORY_HPP
+
+#include <cstdint>
+#include <optional>
+
+#include "domain/Tournament.hpp"
+#include "domain/Uuid.hpp"
+#include "IPagedRepository.hpp"
+#include "IRepository.hpp"
+
+class ITournamentRepository : public IRepository<domain::Tournament, domain::Uuid>, public IPagedRepository<domain::Tournament> {
+public:
+    // Current version of the tournament without reading its document, empty when the tournament does not exist.
+    virtual std::optional<std::int64_t> ReadVersion(domain::Uuid id) = 0;
+};
+#endif //COMMON_ITOURNAMENTREPOSITORY_HPP
@@ -0,0 +1,32 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_MATCHREPOSITORY_HPP
+#define TOURNAMENTS_MATCHREPOSITORY_HPP
+
+#include <string>
+#include <memory>
+
+#include "IMatchRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "domain/Match.hpp"
+
+class MatchRepository : public IMatchRepository {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+public:
+    explicit MatchRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider);
+    std::shared_ptr<domain::Match> ReadById(std::string id) override;
+    std::string Create (const domain::Match & entity) override;
+    std::string Update (const domain::Match & entity) override;
+    void Delete(std::string id) override;
+    std::vector<std::shared_ptr<domain::Match>> ReadAll() override;
+    std::vector<std::string> CreateMany(const std::vector<domain::Match>& matches) override;
+    std::shared_ptr<domain::Match> FindByTournamentIdAndId(std::string_view tournamentId, std::string_view id) override;
+    void DeleteByTournamentIdAndId(std::string_view tournamentId, std::string_view id) override;
+    std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(std::string_view tournamentId) override;
+    std::vector<std::shared_ptr<domain::Match>> FindByTournamentIdAndTeamId(std::string_view tournamentId, std::string_view teamId) override;
+    virtual ~MatchRepository() = default;
+};
+
+#endif //TOURNAMENTS_MATCHREPOSITORY_HPP
@@ -0,0 +1,21 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_STANDINGREPOSITORY_HPP
+#define TOURNAMENTS_STANDINGREPOSITORY_HPP
+
+#include <memory>
+
+#include "IStandingRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+
+class StandingRepository : public IStandingRepository {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+public:
+    explicit StandingRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider);
+    std::optional<std::vector<domain::Standing>> FindByTournamentId(const domain::Uuid& tournamentId) override;
+    virtual ~StandingRepository() = default;
+};
+
+#endif //TOURNAMENTS_STANDINGREPOSITORY_HPP
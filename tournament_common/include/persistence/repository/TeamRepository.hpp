@@ -4,20 +4,59 @@
 
 #ifndef RESTAPI_TEAMREPOSITORY_HPP
 #define RESTAPI_TEAMREPOSITORY_HPP
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <memory>
+#include <unordered_map>
 #include <nlohmann/json.hpp>
 
 
 #include "persistence/configuration/IDbConnectionProvider.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
-#include "IRepository.hpp"
+#include "ITeamRepository.hpp"
 #include "domain/Team.hpp"
+#include "domain/Uuid.hpp"
+#include "domain/DocumentDecoder.hpp"
 #include "domain/Utilities.hpp"
 
 
-class TeamRepository : public IRepository<domain::Team, std::string> {
+class TeamRepository : public ITeamRepository {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
+
+    static inline const PreparedStatement selectAllTeams = StatementCatalog::Declare("select_all_teams", "select id, document->>'name' as name from teams");
+    static inline const PreparedStatement selectTeamById = StatementCatalog::Declare("select_team_by_id", "select * from TEAMS where id = $1");
+    static inline const PreparedStatement selectTeamsByIds = StatementCatalog::Declare("select_teams_by_ids", "select id, document from TEAMS where id = any($1::uuid[])");
+    static inline const PreparedStatement selectTeamsFirstPage = StatementCatalog::Declare("select_teams_first_page",
+        "select id, document from TEAMS order by id limit $1");
+    static inline const PreparedStatement selectTeamsPageAfter = StatementCatalog::Declare("select_teams_page_after",
+        "select id, document from TEAMS where id > $1 order by id limit $2");
+    // walks at most $1 entries of the primary key index, however large TEAMS is
+    static inline const PreparedStatement countTeamsUpTo = StatementCatalog::Declare("count_teams_up_to",
+        "select count(*) from (select 1 from TEAMS limit $1) capped");
+    static inline const PreparedStatement insertTeam = StatementCatalog::Declare("insert_team", "insert into TEAMS (document) values($1) RETURNING id");
+    // rows staged by CreateMany, the first row carrying a name wins and names already in TEAMS are skipped
+    static inline const PreparedStatement mergeStagedTeams = StatementCatalog::Declare("merge_staged_teams", R"(
+        insert into TEAMS (document)
+        select jsonb_build_object('name', staged.name)
+        from (select distinct on (name) row_number, name from teams_staging order by name, row_number) staged
+        where not exists (select 1 from TEAMS where document->>'name' = staged.name)
+        order by staged.row_number
+        on conflict ((document->>'name')) do nothing
+        returning id, document->>'name' as name
+    )");
+    static inline const PreparedStatement selectTeamVersion = StatementCatalog::Declare("select_team_version", "select version from TEAMS where id = $1");
+    // $3 is the expected version or null
+    static inline const PreparedStatement updateTeamName = StatementCatalog::Declare("update_team_name", R"(
+        with updated as (
+            update teams set document = jsonb_set(document, '{name}', to_jsonb($1::text))
+            where id = $2 and ($3::bigint is null or version = $3)
+            returning id
+        )
+        select updated.id, exists(select 1 from teams where id = $2) as found
+        from (values (1)) probe left join updated on true
+    )");
+    static inline const PreparedStatement deleteTeam = StatementCatalog::Declare("delete_team", "delete from TEAMS where id = $1");
 public:
 
     explicit TeamRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider) : connectionProvider(std::move(connectionProvider)){}
@@ -25,70 +64,193 @@ public:
     std::vector<std::shared_ptr<domain::Team>> ReadAll() override {
         std::vector<std::shared_ptr<domain::Team>> teams;
 
-        auto pooled = connectionProvider->Connection();
+        auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
         auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
         
-        pqxx::work tx(*(connection->connection));
-        pqxx::result result{tx.exec("select id, document->>'name' as name from teams")};
-        tx.commit();
+        pqxx::result result = connection->Read(ReadConsistency::Statement, selectAllTeams);
 
         for(auto row : result){
-            teams.push_back(std::make_shared<domain::Team>(domain::Team{row["id"].c_str(), row["name"].c_str()}));
+            teams.push_back(std::make_shared<domain::Team>(domain::Team{row["id"].as<domain::Uuid>(), row["name"].c_str()}));
         }
 
         return teams;
     }
 
-    std::shared_ptr<domain::Team> ReadById(std::string id) override {
-        auto pooled = connectionProvider->Connection();
+    std::shared_ptr<domain::Team> ReadById(domain::Uuid id) override {
+        auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
         auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
-        pqxx::work tx(*(connection->connection));
-        pqxx::result result = tx.exec(pqxx::prepped{"select_team_by_id"}, id.data());
-        tx.commit();
+        pqxx::result result = connection->Read(ReadConsistency::Statement, selectTeamById, id);
 
         if (result.empty()) {
             throw domain::NotFoundException();
         }
 
-        auto team = std::make_shared<domain::Team>( nlohmann::json::parse(result[0]["document"].c_str()));
-        team->Id = result[0]["id"].c_str();
+        auto team = std::make_shared<domain::Team>();
+        domain::decode(result[0]["document"].view(), *team);
+        team->Id = result[0]["id"].as<domain::Uuid>();
+        team->Version = result[0]["version"].as<std::int64_t>();
 
         return team;
     }
 
-    std::string Create(const domain::Team &entity) override {
-        auto pooled = connectionProvider->Connection();
+    std::optional<std::int64_t> ReadVersion(domain::Uuid id) override {
+        auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+        auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+        pqxx::result result = connection->Read(ReadConsistency::Statement, selectTeamVersion, id);
+
+        if (result.empty()) {
+            return std::nullopt;
+        }
+        return result[0]["version"].as<std::int64_t>();
+    }
+
+    std::vector<std::shared_ptr<domain::Team>> ReadByIds(const std::vector<domain::Uuid>& ids) override {
+        std::vector<std::shared_ptr<domain::Team>> teams;
+        if (ids.empty()) {
+            return teams;
+        }
+
+        auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+        auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+        pqxx::result result = connection->Read(ReadConsistency::Statement, selectTeamsByIds, ids);
+
+        teams.reserve(result.size());
+        for (auto row : result) {
+            auto team = std::make_shared<domain::Team>();
+            domain::decode(row["document"].view(), *team);
+            team->Id = row["id"].as<domain::Uuid>();
+            teams.push_back(team);
+        }
+
+        return teams;
+    }
+
+    std::vector<std::shared_ptr<domain::Team>> ReadPage(const std::optional<domain::Uuid>& after, std::size_t limit) override {
+        std::vector<std::shared_ptr<domain::Team>> teams;
+
+        auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+        auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+        pqxx::result result = after.has_value()
+            ? connection->Read(ReadConsistency::Statement, selectTeamsPageAfter, *after, limit)
+            : connection->Read(ReadConsistency::Statement, selectTeamsFirstPage, limit);
+
+        teams.reserve(result.size());
+        for (auto row : result) {
+            auto team = std::make_shared<domain::Team>();
+            domain::decode(row["document"].view(), *team);
+            team->Id = row["id"].as<domain::Uuid>();
+            teams.push_back(team);
+        }
+
+        return teams;
+    }
+
+    bool ExportAll(const std::function<void(std::string_view)>& writeRow, std::size_t limit) override {
+        auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+        auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+        // one snapshot, the rows streamed are the ones counted
+        const auto count = connection->Prepare(countTeamsUpTo);
+        pqxx::transaction<pqxx::isolation_level::repeatable_read, pqxx::write_policy::read_only> tx(*(connection->connection));
+        if (tx.exec(pqxx::prepped{count}, pqxx::params{limit + 1})[0][0].as<std::size_t>() > limit) {
+            tx.commit();
+            return false;
+        }
+        // COPY cannot run a prepared statement, the rows arrive one at a time instead of as one result set
+        for (auto [team] : tx.stream<std::string_view>(
+                 "select jsonb_build_object('id', id, 'name', document->>'name')::text from TEAMS order by id")) {
+            writeRow(team);
+        }
+        tx.commit();
+        return true;
+    }
+
+    domain::Uuid Create(const domain::Team &entity) override {
+        auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
         auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
         nlohmann::json teamBody = entity;
 
         try {
+            const auto statement = connection->Prepare(insertTeam);
             pqxx::work tx(*(connection->connection));
-            pqxx::result result = tx.exec(pqxx::prepped{"insert_team"}, teamBody.dump());
+            pqxx::result result = tx.exec(pqxx::prepped{statement}, teamBody.dump());
             tx.commit();
 
-            return result[0]["id"].as<std::string>();
+            return result[0]["id"].as<domain::Uuid>();
 
         } catch (const pqxx::unique_violation &e) {
             throw domain::DuplicateEntryException();
         }
     }
 
-    std::string Update(const domain::Team &entity) override {
-        auto pooled = connectionProvider->Connection();
+    BulkImportResult CreateMany(const std::vector<domain::Team>& teams) override {
+        BulkImportResult importResult;
+        importResult.ids.resize(teams.size());
+        if (teams.empty()) {
+            return importResult;
+        }
+
+        auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
+        auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+        // the staging table lives as long as the connection, its rows only as long as the transaction
+        pqxx::nontransaction setup(*(connection->connection));
+        setup.exec("create temp table if not exists teams_staging (row_number bigint, name text) on commit delete rows");
+        setup.commit();
+
+        const auto statement = connection->Prepare(mergeStagedTeams);
+        pqxx::work tx(*(connection->connection));
+        auto stream = pqxx::stream_to::table(tx, {"teams_staging"}, {"row_number", "name"});
+        for (std::size_t row = 0; row < teams.size(); row++) {
+            stream.write_values(static_cast<long long>(row), teams[row].Name);
+        }
+        stream.complete();
+        pqxx::result result = tx.exec(pqxx::prepped{statement});
+        tx.commit();
+
+        std::unordered_map<std::string, domain::Uuid> created;
+        created.reserve(result.size());
+        for (auto row : result) {
+            created.emplace(row["name"].c_str(), row["id"].as<domain::Uuid>());
+        }
+
+        for (std::size_t row = 0; row < teams.size(); row++) {
+            auto team = created.find(teams[row].Name);
+            if (team == created.end()) {
+                importResult.conflicts.push_back(row);
+                continue;
+            }
+            importResult.ids[row] = team->second;
+            created.erase(team);
+        }
+
+        return importResult;
+    }
+
+    domain::Uuid Update(const domain::Team &entity) override {
+        auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
         auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
         try {
+            const auto statement = connection->Prepare(updateTeamName);
             pqxx::work tx(*(connection->connection));
-            pqxx::result result = tx.exec(pqxx::prepped{"update_team_name"}, pqxx::params{entity.Name, entity.Id});
+            const std::optional<std::int64_t> expectedVersion = entity.Version > 0 ? std::optional(entity.Version) : std::nullopt;
+            pqxx::result result = tx.exec(pqxx::prepped{statement}, bindParams(entity.Name, entity.Id, expectedVersion));
             tx.commit();
 
-            // Si el resultado está vacío, significa que no se encontró el ID.
-            if (result.empty()) {
+            // Si el id viene vacío, no se encontró el equipo o su versión ya cambió.
+            if (result[0]["id"].is_null()) {
+                if (result[0]["found"].as<bool>()) {
+                    throw domain::VersionMismatchException();
+                }
                 throw domain::NotFoundException();
             }
 
-            return result[0]["id"].as<std::string>();
+            return result[0]["id"].as<domain::Uuid>();
 
         } catch (const pqxx::unique_violation &e) {
             throw domain::DuplicateEntryException();
@@ -98,12 +260,13 @@ public:
     }
 
 
-    void Delete(std::string id) override{
-        auto pooled = connectionProvider->Connection();
+    void Delete(domain::Uuid id) override{
+        auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
         auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
+        const auto statement = connection->Prepare(deleteTeam);
         pqxx::work tx(*(connection->connection));
-        pqxx::result result = tx.exec(pqxx::prepped{"delete_team"}, id);
+        pqxx::result result = tx.exec(pqxx::prepped{statement}, bindParams(id));
         tx.commit();
 
         if (result.affected_rows() == 0) {
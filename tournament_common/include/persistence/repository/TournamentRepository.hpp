@@ -4,22 +4,27 @@
 
 #ifndef TOURNAMENTS_TOURNAMENTREPOSITORY_HPP
 #define TOURNAMENTS_TOURNAMENTREPOSITORY_HPP
+#include <cstdint>
+#include <optional>
 #include <string>
 
-#include "IRepository.hpp"
+#include "ITournamentRepository.hpp"
 #include "domain/Tournament.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
 
 
-class TournamentRepository : public IRepository<domain::Tournament, std::string> {
+class TournamentRepository : public ITournamentRepository {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
 public:
     explicit TournamentRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider);
-    std::shared_ptr<domain::Tournament> ReadById(std::string id) override;
-    std::string Create (const domain::Tournament & entity) override;
-    std::string Update (const domain::Tournament & entity) override;
-    void Delete(std::string id) override;
+    std::shared_ptr<domain::Tournament> ReadById(domain::Uuid id) override;
+    std::optional<std::int64_t> ReadVersion(domain::Uuid id) override;
+    domain::Uuid Create (const domain::Tournament & entity) override;
+    domain::Uuid Update (const domain::Tournament & entity) override;
+    void Delete(domain::Uuid id) override;
     std::vector<std::shared_ptr<domain::Tournament>> ReadAll() override;
+    std::vector<std::shared_ptr<domain::Tournament>> ReadPage(const std::optional<domain::Uuid>& after, std::size_t limit) override;
+    bool ExportAll(const std::function<void(std::string_view)>& writeRow, std::size_t limit) override;
     virtual ~TournamentRepository() = default;
 };
 
@@ -0,0 +1,289 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include "persistence/async/PipelineQueryExecutor.hpp"
+
+#include <libpq-fe.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace {
+    QueryResult copyResult(PGresult* result, RequestArena* arena) {
+        const int columnCount = PQnfields(result);
+        const int rowCount = PQntuples(result);
+
+        QueryResult rows(arena != nullptr ? static_cast<std::pmr::memory_resource*>(arena) : std::pmr::get_default_resource());
+        rows.Reserve(columnCount, rowCount);
+        for (int column = 0; column < columnCount; ++column) {
+            rows.AddColumn(PQfname(result, column));
+        }
+        for (int row = 0; row < rowCount; ++row) {
+            for (int column = 0; column < columnCount; ++column) {
+                if (PQgetisnull(result, row, column)) {
+                    rows.AddCell(std::nullopt);
+                } else {
+                    rows.AddCell(std::string_view(PQgetvalue(result, row, column), PQgetlength(result, row, column)));
+                }
+            }
+        }
+
+        const char* affected = PQcmdTuples(result);
+        if (affected != nullptr && *affected != '\0') {
+            rows.SetAffectedRows(std::stoul(affected));
+        }
+        return rows;
+    }
+
+    // The coroutine carries on on this thread, with its request deadline, arena and read-your-writes state in
+    // place for what it does next.
+    void resume(PendingQuery& query) {
+        RequestDeadline::Scope deadline(query.deadline);
+        RequestArena::Scope arena(query.arena);
+        ReadYourWrites::Scope readYourWrites(query.readYourWrites);
+        query.continuation.resume();
+    }
+
+    QueryException toException(PGresult* result) {
+        const char* sqlState = PQresultErrorField(result, PG_DIAG_SQLSTATE);
+        return QueryException{PQresultErrorMessage(result), sqlState != nullptr ? sqlState : ""};
+    }
+}
+
+PipelineQueryExecutor::PipelineQueryExecutor(std::string_view connectionString, std::size_t connections, std::chrono::milliseconds statementTimeout) {
+    pipelines.reserve(std::max<std::size_t>(connections, 1));
+    for (std::size_t i = 0; i < std::max<std::size_t>(connections, 1); ++i) {
+        pipelines.push_back(std::make_unique<Pipeline>(std::string(connectionString), statementTimeout));
+    }
+}
+
+void PipelineQueryExecutor::Submit(PendingQuery& query) {
+    pipelines[next.fetch_add(1, std::memory_order_relaxed) % pipelines.size()]->Submit(query);
+}
+
+PipelineQueryExecutor::Pipeline::Pipeline(std::string connectionString, std::chrono::milliseconds statementTimeout)
+    : connectionString(std::move(connectionString)), statementTimeout(statementTimeout) {
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeFd < 0) {
+        throw std::runtime_error("Could not create pipeline wake descriptor.");
+    }
+    connect();
+    worker = std::jthread([this](std::stop_token stopToken) { run(stopToken); });
+}
+
+PipelineQueryExecutor::Pipeline::~Pipeline() {
+    worker.request_stop();
+    wake();
+    if (worker.joinable()) {
+        worker.join();
+    }
+    if (connection != nullptr) {
+        PQfinish(connection);
+    }
+    close(wakeFd);
+}
+
+void PipelineQueryExecutor::Pipeline::connect() {
+    if (connection != nullptr) {
+        PQfinish(connection);
+    }
+    prepared.clear();
+    connection = PQconnectdb(connectionString.c_str());
+    if (PQstatus(connection) != CONNECTION_OK) {
+        throw std::runtime_error(PQerrorMessage(connection));
+    }
+    if (statementTimeout.count() > 0) {
+        // pipelined statements cannot be cancelled one by one, the session timeout bounds each of them instead
+        const std::string setTimeout = "set statement_timeout = " + std::to_string(statementTimeout.count());
+        PGresult* result = PQexec(connection, setTimeout.c_str());
+        const bool applied = PQresultStatus(result) == PGRES_COMMAND_OK;
+        PQclear(result);
+        if (!applied) {
+            throw std::runtime_error(PQerrorMessage(connection));
+        }
+    }
+    if (PQsetnonblocking(connection, 1) != 0 || PQenterPipelineMode(connection) != 1) {
+        throw std::runtime_error(PQerrorMessage(connection));
+    }
+}
+
+void PipelineQueryExecutor::Pipeline::Submit(PendingQuery& query) {
+    {
+        std::lock_guard lock(submittedMutex);
+        submitted.push_back(&query);
+    }
+    wake();
+}
+
+void PipelineQueryExecutor::Pipeline::wake() const {
+    const std::uint64_t one = 1;
+    [[maybe_unused]] auto written = write(wakeFd, &one, sizeof(one));
+}
+
+void PipelineQueryExecutor::Pipeline::run(std::stop_token stopToken) {
+    while (!stopToken.stop_requested()) {
+        send();
+
+        // a full socket buffer leaves part of the pipeline unsent, wait until it drains
+        const int flushed = PQflush(connection);
+        pollfd descriptors[2] = {
+            {PQsocket(connection), static_cast<short>(POLLIN | (flushed == 1 ? POLLOUT : 0)), 0},
+            {wakeFd, POLLIN, 0}
+        };
+        if (poll(descriptors, 2, -1) < 0) {
+            continue;
+        }
+
+        if (descriptors[1].revents & POLLIN) {
+            std::uint64_t count;
+            [[maybe_unused]] auto read = ::read(wakeFd, &count, sizeof(count));
+        }
+
+        if (descriptors[0].revents & (POLLIN | POLLERR | POLLHUP)) {
+            if (PQconsumeInput(connection) == 0) {
+                failAll(PQerrorMessage(connection));
+                try {
+                    connect();
+                } catch (const std::exception&) {
+                    // stay down, the next submission fails fast and retries the connection
+                }
+                continue;
+            }
+            receive();
+        }
+    }
+    failAll("Pipeline stopped.");
+}
+
+void PipelineQueryExecutor::Pipeline::send() {
+    std::deque<PendingQuery*> batch;
+    {
+        std::lock_guard lock(submittedMutex);
+        batch.swap(submitted);
+    }
+    if (batch.empty()) {
+        return;
+    }
+
+    if (PQstatus(connection) != CONNECTION_OK) {
+        try {
+            connect();
+        } catch (const std::exception& e) {
+            for (PendingQuery* query : batch) {
+                query->error.emplace(e.what(), "08006");
+                resume(*query);
+            }
+            return;
+        }
+    }
+
+    StatementCatalog& catalog = StatementCatalog::Instance();
+    for (PendingQuery* query : batch) {
+        if (query->deadline && RequestDeadline::Clock::now() >= *query->deadline) {
+            // a query the client no longer waits for is not sent at all
+            query->error.emplace(DeadlineExceededException().what(), "57014");
+            resume(*query);
+            continue;
+        }
+        const std::size_t index = query->statement.index;
+        if (index >= prepared.size()) {
+            prepared.resize(catalog.Size(), false);
+        }
+
+        const std::string& name = catalog.Name(query->statement);
+        if (prepared[index]) {
+            catalog.Hit(query->statement);
+        } else {
+            PQsendPrepare(connection, name.c_str(), catalog.Sql(query->statement).c_str(), 0, nullptr);
+            inFlight.push_back({Step::Prepare, nullptr, index});
+            prepared[index] = true;
+            catalog.Miss(query->statement);
+        }
+
+        std::vector<const char*> values;
+        std::vector<int> lengths;
+        std::vector<int> formats;
+        values.reserve(query->params.size());
+        lengths.reserve(query->params.size());
+        formats.reserve(query->params.size());
+        for (const auto& param : query->params) {
+            values.push_back(param.value ? param.value->data() : nullptr);
+            // libpq reads the length of binary values only, text ones end at their terminator
+            lengths.push_back(param.value ? static_cast<int>(param.value->size()) : 0);
+            formats.push_back(param.binary ? 1 : 0);
+        }
+
+        if (PQsendQueryPrepared(connection, name.c_str(), static_cast<int>(values.size()), values.data(), lengths.data(), formats.data(), 0) != 1) {
+            query->error.emplace(PQerrorMessage(connection), "");
+            resume(*query);
+            continue;
+        }
+        inFlight.push_back({Step::Query, query, index});
+        // one sync per query keeps a failing statement from aborting the ones queued behind it
+        PQpipelineSync(connection);
+        inFlight.push_back({Step::Sync, nullptr, index});
+    }
+}
+
+void PipelineQueryExecutor::Pipeline::receive() {
+    while (!inFlight.empty() && PQisBusy(connection) == 0) {
+        PGresult* result = PQgetResult(connection);
+        InFlight& current = inFlight.front();
+
+        if (current.step == Step::Sync) {
+            PQclear(result);
+            inFlight.pop_front();
+            continue;
+        }
+
+        if (result == nullptr) {
+            // end of this statement's results
+            PendingQuery* query = current.query;
+            inFlight.pop_front();
+            if (query != nullptr) {
+                resume(*query);
+            }
+            continue;
+        }
+
+        const ExecStatusType status = PQresultStatus(result);
+        if (current.step == Step::Prepare) {
+            if (status != PGRES_COMMAND_OK) {
+                prepared[current.statement] = false;
+            }
+        } else if (status == PGRES_TUPLES_OK || status == PGRES_COMMAND_OK) {
+            current.query->result = copyResult(result, current.query->arena);
+        } else if (status == PGRES_PIPELINE_ABORTED) {
+            current.query->error.emplace("Statement skipped after an earlier failure in the pipeline.", "");
+        } else {
+            current.query->error.emplace(toException(result));
+        }
+        PQclear(result);
+    }
+}
+
+void PipelineQueryExecutor::Pipeline::failAll(const std::string& message) {
+    std::deque<PendingQuery*> batch;
+    {
+        std::lock_guard lock(submittedMutex);
+        batch.swap(submitted);
+    }
+    std::deque<InFlight> lost;
+    lost.swap(inFlight);
+
+    for (const InFlight& entry : lost) {
+        if (entry.step == Step::Query && entry.query != nullptr) {
+            entry.query->error.emplace(message, "08006");
+            resume(*entry.query);
+        }
+    }
+    for (PendingQuery* query : batch) {
+        query->error.emplace(message, "08006");
+        resume(*query);
+    }
+}
@@ -0,0 +1,303 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <limits>
+
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+
+namespace {
+    std::chrono::steady_clock::rep now() {
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+
+    double millis(std::chrono::steady_clock::duration duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+}
+
+PostgresConnectionProvider::PostgresConnectionProvider(std::string_view connectionString, const PoolSettings& settings)
+    : connectionString(connectionString), settings(settings), slots(std::max<size_t>(settings.maxSize, 1)) {
+    warmUp();
+    reaper = std::jthread([this](std::stop_token stopToken) { reapIdle(stopToken); });
+    watchdog = std::jthread([this](std::stop_token stopToken) { cancelExpired(stopToken); });
+}
+
+// Opens minSize connections concurrently, so startup costs one connection round instead of minSize of them.
+// Statements are not prepared here, each connection prepares what it runs on first use.
+void PostgresConnectionProvider::warmUp() {
+    const auto start = std::chrono::steady_clock::now();
+    const size_t initial = std::min(settings.minSize, slots.size());
+
+    std::vector<std::future<std::chrono::steady_clock::duration>> pending;
+    pending.reserve(initial);
+    for (size_t i = 0; i < initial; i++) {
+        slots[i].state = SlotState::Transition;
+        pending.push_back(std::async(std::launch::async, [this, i] { return open(slots[i]); }));
+    }
+
+    std::chrono::steady_clock::duration slowestConnect{}, totalConnect{};
+    for (size_t i = 0; i < initial; i++) {
+        const auto connect = pending[i].get();
+        slowestConnect = std::max(slowestConnect, connect);
+        totalConnect += connect;
+
+        slots[i].lastReleased = now();
+        slots[i].state = SlotState::Idle;
+        openConnections++;
+    }
+
+    warmUpMetrics.warmUpConnections = initial;
+    warmUpMetrics.warmUpMillis = millis(std::chrono::steady_clock::now() - start);
+    warmUpMetrics.warmUpConnectAvgMillis = millis(totalConnect) / static_cast<double>(std::max<size_t>(initial, 1));
+    warmUpMetrics.warmUpConnectMaxMillis = millis(slowestConnect);
+}
+
+std::chrono::steady_clock::duration PostgresConnectionProvider::open(Slot& slot) const {
+    const auto start = std::chrono::steady_clock::now();
+    slot.connection.Reset(std::make_unique<pqxx::connection>(connectionString));
+    if (settings.statementTimeout.count() > 0) {
+        // set once per connection, a SET on every checkout would cost each request a round trip
+        slot.connection.connection->set_session_var("statement_timeout", std::to_string(settings.statementTimeout.count()));
+    }
+    return std::chrono::steady_clock::now() - start;
+}
+
+PostgresConnectionProvider::Slot* PostgresConnectionProvider::tryAcquire() {
+    // Each thread starts probing at the slot it used last, so threads spread over the pool instead of
+    // all racing for the front of a shared queue.
+    thread_local size_t preferredSlot = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+    const size_t size = slots.size();
+    for (size_t probe = 0; probe < size; probe++) {
+        const size_t index = (preferredSlot + probe) % size;
+        Slot& slot = slots[index];
+        SlotState expected = SlotState::Idle;
+        if (slot.state.load(std::memory_order_relaxed) == SlotState::Idle && slot.state.compare_exchange_strong(expected, SlotState::InUse)) {
+            preferredSlot = index;
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+// Claims an empty slot and opens a connection into it, or returns nullptr once maxSize connections exist.
+PostgresConnectionProvider::Slot* PostgresConnectionProvider::tryGrow() {
+    for (Slot& slot : slots) {
+        SlotState expected = SlotState::Empty;
+        if (slot.state.load(std::memory_order_relaxed) != SlotState::Empty || !slot.state.compare_exchange_strong(expected, SlotState::Transition)) {
+            continue;
+        }
+        openConnections++;
+        try {
+            open(slot);
+        } catch (...) {
+            openConnections--;
+            slot.state = SlotState::Empty;
+            throw;
+        }
+        slot.state = SlotState::InUse;
+        return &slot;
+    }
+    return nullptr;
+}
+
+void PostgresConnectionProvider::release(Slot* slot) {
+    if (slot->deadline.load(std::memory_order_relaxed) != 0) {
+        // waits out a cancel in progress, so it cannot reach the statement of the next holder
+        std::unique_lock lock(watchdogMutex);
+        cancelCondition.wait(lock, [slot] { return slot->deadline.load(std::memory_order_relaxed) != CANCELLING; });
+        slot->deadline.store(0, std::memory_order_relaxed);
+    }
+    slot->lastReleased.store(now(), std::memory_order_relaxed);
+    slot->state.store(SlotState::Idle);
+    statistics.Returned();
+
+    if (statistics.Waiters() > 0) {
+        // taking the lock orders this release against a waiter that is between its predicate check and the wait
+        { std::lock_guard lock(connectionPoolMutex); }
+        connectionPoolCondition.notify_one();
+    }
+}
+
+PooledConnection PostgresConnectionProvider::Connection(ConnectionIntent) {
+    const auto start = std::chrono::steady_clock::now();
+    if (RequestDeadline::Expired()) {
+        throw DeadlineExceededException();
+    }
+    // a request that must be answered sooner than checkoutTimeout does not wait past its deadline
+    const auto checkoutDeadline = RequestDeadline::Bound(settings.checkoutTimeout);
+
+    Slot* slot = tryAcquire();
+    if (slot == nullptr) {
+        slot = tryGrow();
+    }
+
+    if (slot == nullptr) {
+        std::unique_lock lock(connectionPoolMutex);
+        statistics.WaitStarted();
+        struct WaitGuard {
+            PoolStatistics& statistics;
+            ~WaitGuard() { statistics.WaitFinished(); }
+        } waitGuard{statistics};
+
+        const auto timedOut = [this] {
+            statistics.TimedOut();
+            if (RequestDeadline::Expired()) {
+                throw DeadlineExceededException();
+            }
+            throw ConnectionUnavailableException();
+        };
+
+        while ((slot = tryAcquire()) == nullptr) {
+            if (std::chrono::steady_clock::now() >= checkoutDeadline) {
+                timedOut();
+            }
+            if (openConnections.load() < slots.size()) {
+                // a connection was reaped while we waited, open a fresh one without holding the lock
+                lock.unlock();
+                slot = tryGrow();
+                lock.lock();
+                if (slot != nullptr) {
+                    break;
+                }
+                // the free slot is still in Transition under the reaper, back off briefly instead of spinning
+                connectionPoolCondition.wait_until(lock, std::min(checkoutDeadline, std::chrono::steady_clock::now() + std::chrono::milliseconds(1)));
+                continue;
+            }
+            if (connectionPoolCondition.wait_until(lock, checkoutDeadline) == std::cv_status::timeout) {
+                slot = tryAcquire();
+                if (slot == nullptr) {
+                    timedOut();
+                }
+                break;
+            }
+        }
+    }
+
+    if (!slot->connection.connection->is_open()) {
+        // the server dropped this connection while it sat idle, replace it before handing it out
+        try {
+            open(*slot);
+        } catch (...) {
+            slot->connection.Reset(nullptr);
+            openConnections--;
+            slot->state = SlotState::Empty;
+            throw;
+        }
+    }
+    statistics.CheckedOut(std::chrono::steady_clock::now() - start);
+    if (const auto deadline = RequestDeadline::Current()) {
+        watch(slot, *deadline);
+    }
+
+    // the deleter only flags the slot as free again, the wrapper is never reallocated
+    return PooledConnection(
+        &slot->connection,
+        [this, slot](IDbConnection*) {
+            release(slot);
+        }
+    );
+}
+
+// Closes connections that sat idle past idleTimeout, never going below minSize.
+void PostgresConnectionProvider::reapIdle(std::stop_token stopToken) {
+    const auto interval = std::max<std::chrono::milliseconds>(settings.idleTimeout / 2, std::chrono::milliseconds(100));
+    const auto idleTimeout = std::chrono::duration_cast<std::chrono::steady_clock::duration>(settings.idleTimeout).count();
+
+    std::unique_lock lock(reaperMutex);
+    while (!reaperCondition.wait_for(lock, stopToken, interval, [] { return false; }) && !stopToken.stop_requested()) {
+        for (Slot& slot : slots) {
+            if (openConnections.load() <= settings.minSize) {
+                break;
+            }
+            SlotState expected = SlotState::Idle;
+            if (slot.state.load(std::memory_order_relaxed) != SlotState::Idle
+                || now() - slot.lastReleased.load(std::memory_order_relaxed) < idleTimeout
+                || !slot.state.compare_exchange_strong(expected, SlotState::Transition)) {
+                continue;
+            }
+            slot.connection.Reset(nullptr);
+            openConnections--;
+            slot.state = SlotState::Empty;
+        }
+    }
+}
+
+void PostgresConnectionProvider::watch(Slot* slot, RequestDeadline::Clock::time_point deadline) {
+    {
+        std::lock_guard lock(watchdogMutex);
+        // 0 means no deadline, a deadline landing exactly on the clock epoch is pushed one tick later
+        slot->deadline.store(std::max<std::chrono::steady_clock::rep>(deadline.time_since_epoch().count(), 1), std::memory_order_relaxed);
+        ++watchedCheckouts;
+    }
+    watchdogCondition.notify_one();
+}
+
+// Cancels the statement running on a checked-out connection once its holder's deadline passes. libpq
+// sends the cancel over a separate connection, the holder sees its statement fail with SQLSTATE 57014.
+// Opening that connection can take long while the server struggles, so expired slots are only marked
+// under the lock and cancelled after it is released. watch() and release() of other slots go on meanwhile.
+void PostgresConnectionProvider::cancelExpired(std::stop_token stopToken) {
+    std::vector<Slot*> expired;
+    std::unique_lock lock(watchdogMutex);
+    while (!stopToken.stop_requested()) {
+        auto earliest = std::numeric_limits<std::chrono::steady_clock::rep>::max();
+        const auto current = now();
+        for (Slot& slot : slots) {
+            const auto deadline = slot.deadline.load(std::memory_order_relaxed);
+            if (deadline == 0 || deadline == CANCELLING) {
+                continue;
+            }
+            if (deadline > current) {
+                earliest = std::min(earliest, deadline);
+                continue;
+            }
+            slot.deadline.store(CANCELLING, std::memory_order_relaxed);
+            expired.push_back(&slot);
+        }
+
+        if (!expired.empty()) {
+            lock.unlock();
+            for (Slot* slot : expired) {
+                try {
+                    slot->connection.connection->cancel_query();
+                    statistics.Cancelled();
+                } catch (const std::exception&) {
+                    // the connection is already broken, the holder fails on its own
+                }
+            }
+            lock.lock();
+            // cleared only after the cancels went out, release() of these slots waits until then
+            for (Slot* slot : expired) {
+                slot->deadline.store(0, std::memory_order_relaxed);
+            }
+            expired.clear();
+            cancelCondition.notify_all();
+            // more deadlines may have passed while the cancels were sent
+            continue;
+        }
+
+        const auto seen = watchedCheckouts;
+        const auto changed = [this, seen] { return watchedCheckouts != seen; };
+        if (earliest == std::numeric_limits<std::chrono::steady_clock::rep>::max()) {
+            watchdogCondition.wait(lock, stopToken, changed);
+        } else {
+            watchdogCondition.wait_until(lock, stopToken,
+                std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(earliest)), changed);
+        }
+    }
+}
+
+PoolMetrics PostgresConnectionProvider::Metrics() {
+    PoolMetrics metrics = statistics.Snapshot(slots.size());
+    metrics.openConnections = openConnections.load(std::memory_order_relaxed);
+    metrics.warmUpConnections = warmUpMetrics.warmUpConnections;
+    metrics.warmUpMillis = warmUpMetrics.warmUpMillis;
+    metrics.warmUpConnectAvgMillis = warmUpMetrics.warmUpConnectAvgMillis;
+    metrics.warmUpConnectMaxMillis = warmUpMetrics.warmUpConnectMaxMillis;
+    return metrics;
+}
@@ -0,0 +1,167 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include "domain/DocumentDecoder.hpp"
+#include "domain/Utilities.hpp"
+#include "persistence/repository/AsyncGroupRepository.hpp"
+#include "persistence/configuration/RequestArena.hpp"
+#include "persistence/configuration/StatementCatalog.hpp"
+
+namespace {
+    const PreparedStatement selectGroupById = StatementCatalog::Declare("async_select_group_by_id", "select id, document from groups where id = $1");
+    // group and memberships go in one statement, atomic without a BEGIN/COMMIT round trip of its own
+    const PreparedStatement insertGroup = StatementCatalog::Declare("async_insert_group", R"(
+        with inserted as (
+            insert into groups (tournament_id, document) values ($1::uuid, $2) returning id
+        ), members as (
+            insert into group_teams (tournament_id, group_id, team_id)
+            select $1::uuid, inserted.id, unnest($3::uuid[]) from inserted
+        )
+        select id from inserted
+    )");
+    // $4 is the expected version or null
+    const PreparedStatement updateGroupName = StatementCatalog::Declare("async_update_group_name", R"(
+        with updated as (
+            update groups set document = jsonb_set(document, '{name}', to_jsonb($1::text))
+            where id = $2 and tournament_id = $3 and ($4::bigint is null or version = $4)
+            returning id
+        )
+        select updated.id, exists(select 1 from groups where id = $2 and tournament_id = $3) as found
+        from (values (1)) probe left join updated on true
+    )");
+    const PreparedStatement deleteGroup = StatementCatalog::Declare("async_delete_group", "delete from groups where id = $1");
+    const PreparedStatement selectAllGroups = StatementCatalog::Declare("async_select_all_groups", "select id, document from groups");
+    const PreparedStatement selectGroupsByTournament = StatementCatalog::Declare("async_select_groups_by_tournament",
+        "select id, document from groups where tournament_id = $1");
+    // keys in the order the service writes them; found answers the tournament lookup in the same round trip
+    const PreparedStatement selectGroupsJsonByTournament = StatementCatalog::Declare("async_select_groups_json_by_tournament", R"(
+        select exists(select 1 from tournaments where id = $1) as found,
+               coalesce((select json_agg(json_build_object(
+                             'id', id,
+                             'name', document->'name',
+                             'teams', coalesce(document->'teams', '[]'::jsonb),
+                             'tournamentId', tournament_id))
+                         from groups where tournament_id = $1), '[]'::json)::text as groups
+    )");
+    const PreparedStatement selectGroupByTournamentIdGroupId = StatementCatalog::Declare("async_select_group_by_tournamentid_groupid",
+        "select id, version, document from groups where tournament_id = $1 and id = $2");
+    const PreparedStatement selectGroupVersion = StatementCatalog::Declare("async_select_group_version",
+        "select version from groups where tournament_id = $1 and id = $2");
+    const PreparedStatement addTeamToGroup = StatementCatalog::Declare("async_add_team_to_group",
+        "select add_team_to_group($1::uuid, $2::uuid, $3::uuid, $4) as status");
+
+    std::shared_ptr<domain::Group> toGroup(const QueryResult& result, std::size_t row) {
+        auto group = std::make_shared<domain::Group>();
+        domain::decode(result.Text(row, "document"), *group);
+        group->Id() = result.Uuid(row, "id");
+        return group;
+    }
+
+    std::vector<std::shared_ptr<domain::Group>> toGroups(const QueryResult& result) {
+        std::vector<std::shared_ptr<domain::Group>> groups;
+        groups.reserve(result.Size());
+        for (std::size_t row = 0; row < result.Size(); ++row) {
+            groups.push_back(toGroup(result, row));
+        }
+        return groups;
+    }
+}
+
+AsyncGroupRepository::AsyncGroupRepository(std::shared_ptr<IAsyncQueryExecutor> executor) : executor(std::move(executor)) {}
+
+Task<std::shared_ptr<domain::Group>> AsyncGroupRepository::ReadById(domain::Uuid id) {
+    const QueryResult result = co_await Query(*executor, selectGroupById, id);
+    if (result.Empty()) {
+        co_return nullptr;
+    }
+    co_return toGroup(result, 0);
+}
+
+Task<domain::Uuid> AsyncGroupRepository::Create(domain::Group entity) {
+    const nlohmann::json groupBody = entity;
+    std::vector<domain::Uuid> teamIds;
+    teamIds.reserve(entity.Teams().size());
+    for (const auto& team : entity.Teams()) {
+        teamIds.push_back(team.Id);
+    }
+
+    // same arena as the result moved in, so the assignment takes its storage instead of copying the cells
+    QueryResult result(RequestArena::Current());
+    try {
+        result = co_await Execute(*executor, insertGroup, entity.TournamentId(), groupBody.dump(), teamIds);
+    } catch (const QueryException& e) {
+        if (e.IsUniqueViolation()) {
+            throw domain::DuplicateEntryException();
+        }
+        throw;
+    }
+    co_return result.Uuid(0, "id");
+}
+
+Task<domain::Uuid> AsyncGroupRepository::Update(domain::Group entity) {
+    QueryResult result(RequestArena::Current());
+    try {
+        const std::optional<std::int64_t> expectedVersion = entity.Version() > 0 ? std::optional(entity.Version()) : std::nullopt;
+        result = co_await Execute(*executor, updateGroupName, entity.Name(), entity.Id(), entity.TournamentId(), expectedVersion);
+    } catch (const QueryException& e) {
+        if (e.IsUniqueViolation()) {
+            throw domain::DuplicateEntryException();
+        }
+        throw;
+    }
+    if (result.IsNull(0, "id")) {
+        if (result.Bool(0, "found")) {
+            throw domain::VersionMismatchException();
+        }
+        throw domain::NotFoundException();
+    }
+    co_return result.Uuid(0, "id");
+}
+
+Task<void> AsyncGroupRepository::Delete(domain::Uuid id) {
+    const QueryResult result = co_await Execute(*executor, deleteGroup, id);
+    if (result.AffectedRows() == 0) {
+        throw domain::NotFoundException();
+    }
+}
+
+Task<std::vector<std::shared_ptr<domain::Group>>> AsyncGroupRepository::ReadAll() {
+    co_return toGroups(co_await Query(*executor, selectAllGroups));
+}
+
+Task<std::vector<std::shared_ptr<domain::Group>>> AsyncGroupRepository::FindByTournamentId(domain::Uuid tournamentId) {
+    co_return toGroups(co_await Query(*executor, selectGroupsByTournament, tournamentId));
+}
+
+Task<std::optional<std::string>> AsyncGroupRepository::FindJsonByTournamentId(domain::Uuid tournamentId) {
+    const QueryResult result = co_await Query(*executor, selectGroupsJsonByTournament, tournamentId);
+    if (!result.Bool(0, "found")) {
+        co_return std::nullopt;
+    }
+    co_return std::string(result.Text(0, "groups"));
+}
+
+Task<std::shared_ptr<domain::Group>> AsyncGroupRepository::FindByTournamentIdAndGroupId(domain::Uuid tournamentId, domain::Uuid groupId) {
+    const QueryResult result = co_await Query(*executor, selectGroupByTournamentIdGroupId, tournamentId, groupId);
+    if (result.Empty()) {
+        co_return nullptr;
+    }
+    auto group = toGroup(result, 0);
+    group->Version() = result.BigInt(0, "version");
+    co_return group;
+}
+
+Task<std::optional<std::int64_t>> AsyncGroupRepository::FindVersion(domain::Uuid tournamentId, domain::Uuid groupId) {
+    const QueryResult result = co_await Query(*executor, selectGroupVersion, tournamentId, groupId);
+    if (result.Empty()) {
+        co_return std::nullopt;
+    }
+    co_return result.BigInt(0, "version");
+}
+
+Task<AddTeamStatus> AsyncGroupRepository::AddTeamToGroup(domain::Uuid tournamentId, domain::Uuid groupId, domain::Uuid teamId, std::size_t maxTeams) {
+    const QueryResult result = co_await Execute(*executor, addTeamToGroup, tournamentId, groupId, teamId, maxTeams);
+
+    co_return parseAddTeamStatus(result.Text(0, "status"));
+}
@@ -0,0 +1,85 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include <nlohmann/json.hpp>
+
+#include "domain/DocumentDecoder.hpp"
+#include "domain/Utilities.hpp"
+#include "persistence/repository/AsyncTournamentRepository.hpp"
+#include "persistence/configuration/RequestArena.hpp"
+#include "persistence/configuration/StatementCatalog.hpp"
+
+namespace {
+    const PreparedStatement selectTournamentById = StatementCatalog::Declare("async_select_tournament_by_id", "select id, document from tournaments where id = $1");
+    const PreparedStatement insertTournament = StatementCatalog::Declare("async_insert_tournament", "insert into tournaments (document) values($1) returning id");
+    const PreparedStatement updateTournament = StatementCatalog::Declare("async_update_tournament", "update tournaments set document = $1 where id = $2 returning id");
+    const PreparedStatement deleteTournament = StatementCatalog::Declare("async_delete_tournament", "delete from tournaments where id = $1");
+    const PreparedStatement selectAllTournaments = StatementCatalog::Declare("async_select_all_tournaments", "select id, document from tournaments");
+
+    std::shared_ptr<domain::Tournament> toTournament(const QueryResult& result, std::size_t row) {
+        auto tournament = std::make_shared<domain::Tournament>();
+        domain::decode(result.Text(row, "document"), *tournament);
+        tournament->Id() = result.Uuid(row, "id");
+        return tournament;
+    }
+}
+
+AsyncTournamentRepository::AsyncTournamentRepository(std::shared_ptr<IAsyncQueryExecutor> executor) : executor(std::move(executor)) {}
+
+Task<std::shared_ptr<domain::Tournament>> AsyncTournamentRepository::ReadById(domain::Uuid id) {
+    const QueryResult result = co_await Query(*executor, selectTournamentById, id);
+    if (result.Empty()) {
+        co_return nullptr;
+    }
+    co_return toTournament(result, 0);
+}
+
+Task<domain::Uuid> AsyncTournamentRepository::Create(domain::Tournament entity) {
+    const nlohmann::json tournamentDoc = entity;
+    QueryResult result(RequestArena::Current());
+    try {
+        result = co_await Execute(*executor, insertTournament, tournamentDoc.dump());
+    } catch (const QueryException& e) {
+        if (e.IsUniqueViolation()) {
+            throw domain::DuplicateEntryException();
+        }
+        throw;
+    }
+    co_return result.Uuid(0, "id");
+}
+
+Task<domain::Uuid> AsyncTournamentRepository::Update(domain::Tournament entity) {
+    const nlohmann::json tournamentDoc = entity;
+    QueryResult result(RequestArena::Current());
+    try {
+        result = co_await Execute(*executor, updateTournament, tournamentDoc.dump(), entity.Id());
+    } catch (const QueryException& e) {
+        if (e.IsUniqueViolation()) {
+            throw domain::DuplicateEntryException();
+        }
+        throw;
+    }
+    if (result.Empty()) {
+        throw domain::NotFoundException();
+    }
+    co_return result.Uuid(0, "id");
+}
+
+Task<void> AsyncTournamentRepository::Delete(domain::Uuid id) {
+    const QueryResult result = co_await Execute(*executor, deleteTournament, id);
+    if (result.AffectedRows() == 0) {
+        throw domain::NotFoundException();
+    }
+}
+
+Task<std::vector<std::shared_ptr<domain::Tournament>>> AsyncTournamentRepository::ReadAll() {
+    const QueryResult result = co_await Query(*executor, selectAllTournaments);
+
+    std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+    tournaments.reserve(result.Size());
+    for (std::size_t row = 0; row < result.Size(); ++row) {
+        tournaments.push_back(toTournament(result, row));
+    }
+    co_return tournaments;
+}
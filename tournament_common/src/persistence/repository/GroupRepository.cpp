@@ -2,67 +2,127 @@
 // Created by root on 9/27/25.
 //
 
+#include "domain/DocumentDecoder.hpp"
 #include "domain/Utilities.hpp"
 #include  "persistence/repository/GroupRepository.hpp"
+#include "persistence/configuration/StatementCatalog.hpp"
+
+namespace {
+    const PreparedStatement selectGroupById = StatementCatalog::Declare("select_group_by_id", "SELECT id, document FROM groups WHERE id = $1");
+    const PreparedStatement insertGroup = StatementCatalog::Declare("insert_group", "insert into GROUPS (tournament_id, document) values($1, $2) RETURNING id");
+    // $4 is the expected version or null
+    const PreparedStatement updateGroupName = StatementCatalog::Declare("update_group_name", R"(
+        with updated as (
+            update groups set document = jsonb_set(document, '{name}', to_jsonb($1::text))
+            where id = $2 and tournament_id = $3 and ($4::bigint is null or version = $4)
+            returning id
+        )
+        select updated.id, exists(select 1 from groups where id = $2 and tournament_id = $3) as found
+        from (values (1)) probe left join updated on true
+    )");
+    const PreparedStatement deleteGroup = StatementCatalog::Declare("delete_group", "DELETE FROM groups WHERE id = $1");
+    const PreparedStatement selectAllGroups = StatementCatalog::Declare("select_all_groups", "SELECT id, document FROM groups");
+    const PreparedStatement selectGroupsByTournament = StatementCatalog::Declare("select_groups_by_tournament", "select * from GROUPS where tournament_id = $1");
+    const PreparedStatement selectGroupByTournamentIdGroupId = StatementCatalog::Declare("select_group_by_tournamentid_groupid",
+        "select * from GROUPS where tournament_id = $1 and id = $2");
+    // membership checks probe the GROUP_TEAMS primary key instead of scanning group documents
+    const PreparedStatement selectGroupInTournament = StatementCatalog::Declare("select_group_in_tournament", R"(
+        select groups.* from group_teams
+        join groups on groups.id = group_teams.group_id
+        where group_teams.tournament_id = $1
+        and group_teams.team_id = $2
+    )");
+    const PreparedStatement selectGroupedTeamIds = StatementCatalog::Declare("select_grouped_team_ids", R"(
+        select team_id from group_teams
+        where tournament_id = $1
+        and team_id = any($2::uuid[])
+    )");
+    const PreparedStatement insertGroupTeams = StatementCatalog::Declare("insert_group_teams", R"(
+        insert into group_teams (tournament_id, group_id, team_id)
+        select $1::uuid, $2::uuid, unnest($3::uuid[])
+    )");
+    const PreparedStatement addTeamToGroup = StatementCatalog::Declare("add_team_to_group",
+        "select add_team_to_group($1::uuid, $2::uuid, $3::uuid, $4) as status");
+}
 
 GroupRepository::GroupRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
 
-std::shared_ptr<domain::Group> GroupRepository::ReadById(std::string id) {
-    auto pooled = connectionProvider->Connection();
+std::shared_ptr<domain::Group> GroupRepository::ReadById(domain::Uuid id) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
-    pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"select_group_by_id"}, pqxx::params{id});
-    tx.commit();
+    pqxx::result result = connection->Read(ReadConsistency::Statement, selectGroupById, id);
 
     if (result.empty()) {
         return nullptr;
     }
 
     auto row = result[0];
-    auto group = std::make_shared<domain::Group>(nlohmann::json::parse(row["document"].c_str()));
-    group->Id() = row["id"].as<std::string>();
+    auto group = std::make_shared<domain::Group>();
+    domain::decode(row["document"].view(), *group);
+    group->Id() = row["id"].as<domain::Uuid>();
 
     return group;
 }
 
-std::string GroupRepository::Create (const domain::Group & entity) {
-    auto pooled = connectionProvider->Connection();
+domain::Uuid GroupRepository::Create (const domain::Group & entity) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
     nlohmann::json groupBody = entity;
 
-    pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"insert_group"}, pqxx::params{entity.TournamentId(), groupBody.dump()});
+    std::vector<domain::Uuid> teamIds;
+    teamIds.reserve(entity.Teams().size());
+    for (const auto& team : entity.Teams()) {
+        teamIds.push_back(team.Id);
+    }
 
-    tx.commit();
+    try {
+        const auto statement = connection->Prepare(insertGroup);
+        const auto membership = connection->Prepare(insertGroupTeams);
+        pqxx::work tx(*(connection->connection));
+        pqxx::result result = tx.exec(pqxx::prepped{statement}, bindParams(entity.TournamentId(), groupBody.dump()));
+        const auto groupId = result[0]["id"].as<domain::Uuid>();
+        if (!teamIds.empty()) {
+            tx.exec(pqxx::prepped{membership}, bindParams(entity.TournamentId(), groupId, teamIds));
+        }
+        tx.commit();
 
-    return result[0]["id"].as<std::string>();
+        return groupId;
+    } catch (const pqxx::unique_violation& e) {
+        throw domain::DuplicateEntryException();
+    }
 }
 
-std::string GroupRepository::Update (const domain::Group & entity) {
-    auto pooled = connectionProvider->Connection();
+domain::Uuid GroupRepository::Update (const domain::Group & entity) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     try {
+        const auto statement = connection->Prepare(updateGroupName);
         pqxx::work tx(*(connection->connection));
-        pqxx::result result = tx.exec(pqxx::prepped{"update_group_name"},
-                                     pqxx::params{entity.Name(), entity.Id(), entity.TournamentId()});
+        const std::optional<std::int64_t> expectedVersion = entity.Version() > 0 ? std::optional(entity.Version()) : std::nullopt;
+        pqxx::result result = tx.exec(pqxx::prepped{statement},
+                                     bindParams(entity.Name(), entity.Id(), entity.TournamentId(), expectedVersion));
         tx.commit();
-        if (result.empty()) {
+        if (result[0]["id"].is_null()) {
+            if (result[0]["found"].as<bool>()) {
+                throw domain::VersionMismatchException();
+            }
             throw domain::NotFoundException();
         }
-        return result[0]["id"].as<std::string>();
+        return result[0]["id"].as<domain::Uuid>();
     } catch (const pqxx::unique_violation& e) {
         throw domain::DuplicateEntryException();
     }
 }
 
-void GroupRepository::Delete(std::string id) {
-    auto pooled = connectionProvider->Connection();
+void GroupRepository::Delete(domain::Uuid id) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto statement = connection->Prepare(deleteGroup);
     pqxx::work tx(*(connection->connection));
 
-    pqxx::result result = tx.exec(pqxx::prepped{"delete_group"}, pqxx::params{id});
+    pqxx::result result = tx.exec(pqxx::prepped{statement}, bindParams(id));
     tx.commit();
 
     if (result.affected_rows() == 0) {
@@ -72,77 +132,93 @@ void GroupRepository::Delete(std::string id) {
 
 std::vector<std::shared_ptr<domain::Group>> GroupRepository::ReadAll() {
     std::vector<std::shared_ptr<domain::Group>> groups;
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
-    pqxx::work tx(*(connection->connection));
-    pqxx::result result{tx.exec("SELECT id, document FROM groups")};
-    tx.commit();
+    pqxx::result result = connection->Read(ReadConsistency::Statement, selectAllGroups);
 
     for(auto row : result){
-        auto group = std::make_shared<domain::Group>(nlohmann::json::parse(row["document"].c_str()));
-        group->Id() = row["id"].as<std::string>();
+        auto group = std::make_shared<domain::Group>();
+        domain::decode(row["document"].view(), *group);
+        group->Id() = row["id"].as<domain::Uuid>();
         groups.push_back(group);
     }
     return groups;
 }
 
-std::vector<std::shared_ptr<domain::Group>> GroupRepository::FindByTournamentId(const std::string_view& tournamentId) {
-    auto pooled = connectionProvider->Connection();
+std::vector<std::shared_ptr<domain::Group>> GroupRepository::FindByTournamentId(const domain::Uuid& tournamentId) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"select_groups_by_tournament"}, pqxx::params{tournamentId});
-    tx.commit();
+    pqxx::result result = connection->Read(ReadConsistency::Statement, selectGroupsByTournament, tournamentId);
 
     std::vector<std::shared_ptr<domain::Group>> groups;
     for(auto row : result){
-        auto group = std::make_shared<domain::Group>(nlohmann::json::parse(row["document"].c_str()));
-        group->Id() = row["id"].as<std::string>();
+        auto group = std::make_shared<domain::Group>();
+        domain::decode(row["document"].view(), *group);
+        group->Id() = row["id"].as<domain::Uuid>();
         groups.push_back(group);
     }
     return groups;
 }
 
-std::shared_ptr<domain::Group> GroupRepository::FindByTournamentIdAndGroupId(const std::string_view& tournamentId, const std::string_view& groupId) {
-    auto pooled = connectionProvider->Connection();
+std::shared_ptr<domain::Group> GroupRepository::FindByTournamentIdAndGroupId(const domain::Uuid& tournamentId, const domain::Uuid& groupId) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"select_group_by_tournamentid_groupid"}, pqxx::params{tournamentId, groupId});
-    tx.commit();
+    pqxx::result result = connection->Read(ReadConsistency::Statement, selectGroupByTournamentIdGroupId, tournamentId, groupId);
 
     if (result.empty()) {
         return nullptr;
     }
 
     auto row = result[0];
-    auto group = std::make_shared<domain::Group>(nlohmann::json::parse(row["document"].c_str()));
-    group->Id() = row["id"].as<std::string>();
+    auto group = std::make_shared<domain::Group>();
+    domain::decode(row["document"].view(), *group);
+    group->Id() = row["id"].as<domain::Uuid>();
+    group->Version() = row["version"].as<std::int64_t>();
     return group;
 }
 
-std::shared_ptr<domain::Group> GroupRepository::FindByTournamentIdAndTeamId(const std::string_view& tournamentId, const std::string_view& teamId) {
-    auto pooled = connectionProvider->Connection();
+std::shared_ptr<domain::Group> GroupRepository::FindByTournamentIdAndTeamId(const domain::Uuid& tournamentId, const domain::Uuid& teamId) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
-    pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"select_group_in_tournament"}, pqxx::params{tournamentId, teamId});
-    tx.commit();
+    const pqxx::result result = connection->Read(ReadConsistency::Statement, selectGroupInTournament, tournamentId, teamId);
     if (result.empty()) {
         return nullptr;
     }
-    nlohmann::json groupDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    std::shared_ptr<domain::Group> group = std::make_shared<domain::Group>(groupDocument);
-    group->Id() = result[0]["id"].as<std::string>();
+    auto group = std::make_shared<domain::Group>();
+    domain::decode(result[0]["document"].view(), *group);
+    group->Id() = result[0]["id"].as<domain::Uuid>();
 
     return group;
 }
 
-void GroupRepository::UpdateGroupAddTeam(std::string_view groupId, const domain::Team& team) {
-    nlohmann::json teamDocument = team;
+std::vector<domain::Uuid> GroupRepository::FindGroupedTeamIds(const domain::Uuid& tournamentId, const std::vector<domain::Uuid>& teamIds) {
+    std::vector<domain::Uuid> groupedTeamIds;
+    if (teamIds.empty()) {
+        return groupedTeamIds;
+    }
+
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    const pqxx::result result = connection->Read(ReadConsistency::Statement, selectGroupedTeamIds, tournamentId, teamIds);
 
-    auto pooled = connectionProvider->Connection();
+    groupedTeamIds.reserve(result.size());
+    for (const auto& row : result) {
+        groupedTeamIds.push_back(row["team_id"].as<domain::Uuid>());
+    }
+    return groupedTeamIds;
+}
+
+AddTeamStatus GroupRepository::AddTeamToGroup(const domain::Uuid& tournamentId, const domain::Uuid& groupId, const domain::Uuid& teamId, std::size_t maxTeams) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    pqxx::work tx(*(connection->connection));
-    tx.exec(pqxx::prepped{"update_group_add_team"}, pqxx::params{groupId, teamDocument.dump()});
-    tx.commit();
-}
\ No newline at end of file
+
+    // a single statement is atomic on its own, no transaction block around it
+    const auto statement = connection->Prepare(addTeamToGroup);
+    pqxx::nontransaction tx(*(connection->connection));
+    const pqxx::result result = tx.exec(pqxx::prepped{statement}, bindParams(tournamentId, groupId, teamId, static_cast<int>(maxTeams)));
+
+    return parseAddTeamStatus(result[0]["status"].view());
+}
@@ -0,0 +1,189 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include "domain/Utilities.hpp"
+#include "persistence/repository/MatchRepository.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/StatementCatalog.hpp"
+
+namespace {
+    // the tournament id prunes the lookup to one partition and its primary key, the id alone probes every partition
+    const PreparedStatement selectMatchById = StatementCatalog::Declare("select_match_by_id",
+        "select id, tournament_id, home_team_id, away_team_id, home_score, away_score, round from matches where id = $1");
+    const PreparedStatement selectMatchByTournamentAndId = StatementCatalog::Declare("select_match_by_tournament_and_id",
+        "select id, tournament_id, home_team_id, away_team_id, home_score, away_score, round from matches where tournament_id = $1 and id = $2");
+    const PreparedStatement selectAllMatches = StatementCatalog::Declare("select_all_matches",
+        "select id, tournament_id, home_team_id, away_team_id, home_score, away_score, round from matches");
+    const PreparedStatement selectMatchesByTournament = StatementCatalog::Declare("select_matches_by_tournament",
+        "select id, tournament_id, home_team_id, away_team_id, home_score, away_score, round from matches where tournament_id = $1");
+    const PreparedStatement selectMatchesByTournamentAndTeam = StatementCatalog::Declare("select_matches_by_tournament_and_team", R"(
+        select id, tournament_id, home_team_id, away_team_id, home_score, away_score, round from matches
+        where tournament_id = $1
+        and (home_team_id = $2 or away_team_id = $2)
+    )");
+    // the whole batch travels as one set of arrays, so a season is a single statement
+    const PreparedStatement insertMatches = StatementCatalog::Declare("insert_matches", R"(
+        insert into matches (tournament_id, home_team_id, away_team_id, home_score, away_score, round)
+        select * from unnest($1::uuid[], $2::uuid[], $3::uuid[], $4::integer[], $5::integer[], $6::text[])
+        returning id
+    )");
+    const PreparedStatement updateMatchScore = StatementCatalog::Declare("update_match_score",
+        "update matches set home_score = $1, away_score = $2, last_update_date = CURRENT_TIMESTAMP where id = $3 and tournament_id = $4 returning id");
+    const PreparedStatement deleteMatch = StatementCatalog::Declare("delete_match", "delete from matches where id = $1");
+    const PreparedStatement deleteMatchByTournament = StatementCatalog::Declare("delete_match_by_tournament",
+        "delete from matches where tournament_id = $1 and id = $2");
+
+    std::shared_ptr<domain::Match> toMatch(const pqxx::row& row) {
+        auto match = std::make_shared<domain::Match>(
+            row["home_team_id"].as<std::string>(),
+            row["away_team_id"].as<std::string>(),
+            row["home_score"].as<int>(),
+            row["away_score"].as<int>(),
+            domain::matchRoundFromString(row["round"].as<std::string>()));
+        match->Id() = row["id"].as<std::string>();
+        match->TournamentId() = row["tournament_id"].as<std::string>();
+        return match;
+    }
+
+    std::vector<std::shared_ptr<domain::Match>> toMatches(const pqxx::result& result) {
+        std::vector<std::shared_ptr<domain::Match>> matches;
+        matches.reserve(result.size());
+        for (const auto& row : result) {
+            matches.push_back(toMatch(row));
+        }
+        return matches;
+    }
+}
+
+MatchRepository::MatchRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
+
+std::shared_ptr<domain::Match> MatchRepository::ReadById(std::string id) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    const pqxx::result result = connection->Read(ReadConsistency::Statement, selectMatchById, id);
+    if (result.empty()) {
+        return nullptr;
+    }
+    return toMatch(result[0]);
+}
+
+std::shared_ptr<domain::Match> MatchRepository::FindByTournamentIdAndId(std::string_view tournamentId, std::string_view id) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    const pqxx::result result = connection->Read(ReadConsistency::Statement, selectMatchByTournamentAndId, tournamentId, id);
+    if (result.empty()) {
+        return nullptr;
+    }
+    return toMatch(result[0]);
+}
+
+std::string MatchRepository::Create(const domain::Match & entity) {
+    return CreateMany({entity}).front();
+}
+
+std::vector<std::string> MatchRepository::CreateMany(const std::vector<domain::Match>& matches) {
+    std::vector<std::string> ids;
+    if (matches.empty()) {
+        return ids;
+    }
+
+    std::vector<std::string> tournamentIds, homeTeamIds, awayTeamIds, rounds;
+    std::vector<int> homeScores, awayScores;
+    tournamentIds.reserve(matches.size());
+    homeTeamIds.reserve(matches.size());
+    awayTeamIds.reserve(matches.size());
+    rounds.reserve(matches.size());
+    homeScores.reserve(matches.size());
+    awayScores.reserve(matches.size());
+    for (const auto& match : matches) {
+        tournamentIds.push_back(match.TournamentId());
+        homeTeamIds.push_back(match.HomeTeamId());
+        awayTeamIds.push_back(match.AwayTeamId());
+        homeScores.push_back(match.HomeScore());
+        awayScores.push_back(match.AwayScore());
+        rounds.emplace_back(domain::toString(match.Round()));
+    }
+
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    // one INSERT is atomic on its own, skipping BEGIN/COMMIT keeps the batch to a single round trip
+    const auto statement = connection->Prepare(insertMatches);
+    pqxx::nontransaction tx(*(connection->connection));
+    const pqxx::result result = tx.exec(pqxx::prepped{statement},
+                                        pqxx::params{tournamentIds, homeTeamIds, awayTeamIds, homeScores, awayScores, rounds});
+
+    ids.reserve(result.size());
+    for (const auto& row : result) {
+        ids.push_back(row["id"].as<std::string>());
+    }
+    return ids;
+}
+
+std::string MatchRepository::Update(const domain::Match & entity) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    const auto statement = connection->Prepare(updateMatchScore);
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result = tx.exec(pqxx::prepped{statement},
+                                        pqxx::params{entity.HomeScore(), entity.AwayScore(), entity.Id(), entity.TournamentId()});
+    tx.commit();
+
+    if (result.empty()) {
+        throw domain::NotFoundException();
+    }
+    return result[0]["id"].as<std::string>();
+}
+
+void MatchRepository::Delete(std::string id) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    const auto statement = connection->Prepare(deleteMatch);
+    pqxx::work tx(*(connection->connection));
+    const pqxx::result result = tx.exec(pqxx::prepped{statement}, pqxx::params{id});
+    tx.commit();
+
+    if (result.affected_rows() == 0) {
+        throw domain::NotFoundException();
+    }
+}
+
+void MatchRepository::DeleteByTournamentIdAndId(std::string_view tournamentId, std::string_view id) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    // a single DELETE is atomic on its own, no transaction block around it
+    const auto statement = connection->Prepare(deleteMatchByTournament);
+    pqxx::nontransaction tx(*(connection->connection));
+    const pqxx::result result = tx.exec(pqxx::prepped{statement}, pqxx::params{tournamentId, id});
+
+    if (result.affected_rows() == 0) {
+        throw domain::NotFoundException();
+    }
+}
+
+std::vector<std::shared_ptr<domain::Match>> MatchRepository::ReadAll() {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    return toMatches(connection->Read(ReadConsistency::Statement, selectAllMatches));
+}
+
+std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTournamentId(std::string_view tournamentId) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    return toMatches(connection->Read(ReadConsistency::Statement, selectMatchesByTournament, tournamentId));
+}
+
+std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTournamentIdAndTeamId(std::string_view tournamentId, std::string_view teamId) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    return toMatches(connection->Read(ReadConsistency::Statement, selectMatchesByTournamentAndTeam, tournamentId, teamId));
+}
@@ -0,0 +1,48 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include "persistence/repository/StandingRepository.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/StatementCatalog.hpp"
+
+namespace {
+    // unordered, a tournament has a few dozen rows and domain::RanksAbove ranks them
+    const PreparedStatement selectStandingsByTournament = StatementCatalog::Declare("select_standings_by_tournament", R"(
+        select s.team_id, t.document->>'name' as name, s.wins, s.losses, s.ties, s.net_points
+        from standings s
+        join teams t on t.id = s.team_id
+        where s.tournament_id = $1
+    )");
+    const PreparedStatement selectTournamentExists = StatementCatalog::Declare("select_tournament_exists",
+        "select exists(select 1 from tournaments where id = $1) as found");
+}
+
+StandingRepository::StandingRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
+
+std::optional<std::vector<domain::Standing>> StandingRepository::FindByTournamentId(const domain::Uuid& tournamentId) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+    auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    // a match may land between the two reads, one snapshot keeps the lookup in agreement with the rows
+    return connection->Read(ReadConsistency::ReadOnly, [&](ReadSession& session) -> std::optional<std::vector<domain::Standing>> {
+        const pqxx::result result = session.Exec(selectStandingsByTournament, tournamentId);
+        if (result.empty() && !session.Exec(selectTournamentExists, tournamentId)[0]["found"].as<bool>()) {
+            return std::nullopt;
+        }
+
+        std::vector<domain::Standing> standings;
+        standings.reserve(result.size());
+        for (const auto& row : result) {
+            standings.push_back(domain::Standing{
+                row["team_id"].as<domain::Uuid>(),
+                row["name"].as<std::string>(),
+                row["wins"].as<int>(),
+                row["losses"].as<int>(),
+                row["ties"].as<int>(),
+                row["net_points"].as<int>()
+            });
+        }
+        return standings;
+    });
+}
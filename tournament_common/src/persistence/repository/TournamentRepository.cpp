@@ -6,93 +6,178 @@
 #include <nlohmann/json.hpp>
 
 #include "persistence/repository/TournamentRepository.hpp"
+#include "domain/DocumentDecoder.hpp"
 #include "domain/Utilities.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
-
+#include "persistence/configuration/StatementCatalog.hpp"
+
+namespace {
+    const PreparedStatement selectTournamentById = StatementCatalog::Declare("select_tournament_by_id", "select * from TOURNAMENTS where id = $1");
+    const PreparedStatement insertTournament = StatementCatalog::Declare("insert_tournament", "insert into TOURNAMENTS (document) values($1) RETURNING id");
+    const PreparedStatement selectTournamentVersion = StatementCatalog::Declare("select_tournament_version", "select version from TOURNAMENTS where id = $1");
+    // $3 is the expected version or null
+    const PreparedStatement updateTournament = StatementCatalog::Declare("update_tournament", R"(
+        with updated as (
+            update tournaments set document = $1 where id = $2 and ($3::bigint is null or version = $3) returning id
+        )
+        select updated.id, exists(select 1 from tournaments where id = $2) as found
+        from (values (1)) probe left join updated on true
+    )");
+    const PreparedStatement deleteTournament = StatementCatalog::Declare("delete_tournament", "DELETE FROM tournaments WHERE id = $1");
+    const PreparedStatement selectAllTournaments = StatementCatalog::Declare("select_all_tournaments", "select id, document from tournaments");
+    const PreparedStatement selectTournamentsFirstPage = StatementCatalog::Declare("select_tournaments_first_page",
+        "select id, document from tournaments order by id limit $1");
+    const PreparedStatement selectTournamentsPageAfter = StatementCatalog::Declare("select_tournaments_page_after",
+        "select id, document from tournaments where id > $1 order by id limit $2");
+    // walks at most $1 entries of the primary key index, however large TOURNAMENTS is
+    const PreparedStatement countTournamentsUpTo = StatementCatalog::Declare("count_tournaments_up_to",
+        "select count(*) from (select 1 from tournaments limit $1) capped");
+}
 
 TournamentRepository::TournamentRepository(std::shared_ptr<IDbConnectionProvider> connection) : connectionProvider(std::move(connection)) {
 }
 
-std::shared_ptr<domain::Tournament> TournamentRepository::ReadById(std::string id) {
-    auto pooled = connectionProvider->Connection();
+std::shared_ptr<domain::Tournament> TournamentRepository::ReadById(domain::Uuid id) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
-
-    pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"select_tournament_by_id"}, id);
-    tx.commit();
+    const pqxx::result result = connection->Read(ReadConsistency::Statement, selectTournamentById, id);
 
     if (result.empty()) {
         return nullptr;
     }
-    nlohmann::json rowTournament = nlohmann::json::parse(result.at(0)["document"].c_str());
-    auto tournament = std::make_shared<domain::Tournament>(rowTournament);
-    tournament->Id() = result.at(0)["id"].c_str();
+    auto tournament = std::make_shared<domain::Tournament>();
+    domain::decode(result.at(0)["document"].view(), *tournament);
+    tournament->Id() = result.at(0)["id"].as<domain::Uuid>();
+    tournament->Version() = result.at(0)["version"].as<std::int64_t>();
 
     return tournament;
 }
 
-std::string TournamentRepository::Create (const domain::Tournament & entity) {
+std::optional<std::int64_t> TournamentRepository::ReadVersion(domain::Uuid id) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    const pqxx::result result = connection->Read(ReadConsistency::Statement, selectTournamentVersion, id);
+
+    if (result.empty()) {
+        return std::nullopt;
+    }
+    return result.at(0)["version"].as<std::int64_t>();
+}
+
+domain::Uuid TournamentRepository::Create (const domain::Tournament & entity) {
 
     const nlohmann::json tournamentDoc = entity;
 
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+    const auto statement = connection->Prepare(insertTournament);
     pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"insert_tournament"}, tournamentDoc.dump());
+    const pqxx::result result = tx.exec(pqxx::prepped{statement}, tournamentDoc.dump());
 
     tx.commit();
 
-    return result[0]["id"].c_str();
+    return result[0]["id"].as<domain::Uuid>();
 }
 
-std::string TournamentRepository::Update (const domain::Tournament & entity) {
+domain::Uuid TournamentRepository::Update (const domain::Tournament & entity) {
     const nlohmann::json tournamentDoc = entity;
-    std::string id = entity.Id();
 
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
-    pqxx::work tx(*(connection->connection));
-
-    // Comando SQL raw for now
-    tx.exec(
-        "UPDATE tournaments SET document = " + tx.quote(tournamentDoc.dump()) +
-        " WHERE id = " + tx.quote(id)
-    );
-    tx.commit();
-
-    return id;
+    try {
+        const auto statement = connection->Prepare(updateTournament);
+        pqxx::work tx(*(connection->connection));
+        const std::optional<std::int64_t> expectedVersion = entity.Version() > 0 ? std::optional(entity.Version()) : std::nullopt;
+        const pqxx::result result = tx.exec(pqxx::prepped{statement}, bindParams(tournamentDoc.dump(), entity.Id(), expectedVersion));
+        tx.commit();
+
+        if (result[0]["id"].is_null()) {
+            if (result[0]["found"].as<bool>()) {
+                throw domain::VersionMismatchException();
+            }
+            throw domain::NotFoundException();
+        }
+
+        return result[0]["id"].as<domain::Uuid>();
+    } catch (const pqxx::unique_violation &e) {
+        throw domain::DuplicateEntryException();
+    }
 }
 
-void TournamentRepository::Delete(std::string id) {
-    auto pooled = connectionProvider->Connection();
+void TournamentRepository::Delete(domain::Uuid id) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Write);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
+    const auto statement = connection->Prepare(deleteTournament);
     pqxx::work tx(*(connection->connection));
-    // Comando SQL raw for now
-    tx.exec("DELETE FROM tournaments WHERE id = " + tx.quote(id));
+    const pqxx::result result = tx.exec(pqxx::prepped{statement}, bindParams(id));
     tx.commit();
 
+    if (result.affected_rows() == 0) {
+        throw domain::NotFoundException();
+    }
 }
 
 std::vector<std::shared_ptr<domain::Tournament>> TournamentRepository::ReadAll() {
     std::vector<std::shared_ptr<domain::Tournament>> tournaments;
 
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
-    pqxx::work tx(*(connection->connection));
-    const pqxx::result result{tx.exec("select id, document from tournaments")};
-    tx.commit();
+    const pqxx::result result = connection->Read(ReadConsistency::Statement, selectAllTournaments);
 
     for(auto row : result){
-        nlohmann::json rowTournament = nlohmann::json::parse(row["document"].c_str());
-        auto tournament = std::make_shared<domain::Tournament>(rowTournament);
-        tournament->Id() = row["id"].c_str();
+        auto tournament = std::make_shared<domain::Tournament>();
+        domain::decode(row["document"].view(), *tournament);
+        tournament->Id() = row["id"].as<domain::Uuid>();
 
         tournaments.push_back(tournament);
     }
 
     return tournaments;
-}
\ No newline at end of file
+}
+
+std::vector<std::shared_ptr<domain::Tournament>> TournamentRepository::ReadPage(const std::optional<domain::Uuid>& after, std::size_t limit) {
+    std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    const pqxx::result result = after.has_value()
+        ? connection->Read(ReadConsistency::Statement, selectTournamentsPageAfter, *after, limit)
+        : connection->Read(ReadConsistency::Statement, selectTournamentsFirstPage, limit);
+
+    tournaments.reserve(result.size());
+    for(auto row : result){
+        auto tournament = std::make_shared<domain::Tournament>();
+        domain::decode(row["document"].view(), *tournament);
+        tournament->Id() = row["id"].as<domain::Uuid>();
+
+        tournaments.push_back(tournament);
+    }
+
+    return tournaments;
+}
+
+bool TournamentRepository::ExportAll(const std::function<void(std::string_view)>& writeRow, std::size_t limit) {
+    auto pooled = connectionProvider->Connection(ConnectionIntent::Read);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    // one snapshot, the rows streamed are the ones counted
+    const auto count = connection->Prepare(countTournamentsUpTo);
+    pqxx::transaction<pqxx::isolation_level::repeatable_read, pqxx::write_policy::read_only> tx(*(connection->connection));
+    if (tx.exec(pqxx::prepped{count}, pqxx::params{limit + 1})[0][0].as<std::size_t>() > limit) {
+        tx.commit();
+        return false;
+    }
+    // COPY cannot run a prepared statement, the rows arrive one at a time instead of as one result set
+    for (auto [tournament] : tx.stream<std::string_view>(
+             "select (document || jsonb_build_object('id', id))::text from tournaments order by id")) {
+        writeRow(tournament);
+    }
+    tx.commit();
+    return true;
+}
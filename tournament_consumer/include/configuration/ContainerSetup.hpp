@@ -17,6 +17,7 @@
 #include "persistence/repository/TeamRepository.hpp"
 #include "persistence/configuration/PostgresConnectionProvider.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
+#include "persistence/repository/MatchRepository.hpp"
 #include "cms/QueueMessageConsumer.hpp"
 
 namespace config {
@@ -27,7 +28,8 @@ namespace config {
         nlohmann::json configuration;
         file >> configuration;
 
-        std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(configuration["databaseConfig"]["connectionString"].get<std::string>(), configuration["databaseConfig"]["poolSize"].get<size_t>());
+        const auto databaseConfig = configuration["databaseConfig"].get<DatabaseConfiguration>();
+        std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(databaseConfig.connectionString, databaseConfig.pool);
         builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
 
         builder.registerType<ConnectionManager>()
@@ -46,9 +48,11 @@ namespace config {
         // builder.registerType<QueueResolver>().as<IResolver<IQueueMessageProducer> >().named("queueResolver").
         //         singleInstance();
 
-        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string>>().singleInstance();
+        builder.registerType<TeamRepository>().as<IRepository<domain::Team, domain::Uuid>>().singleInstance();
 
-        builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, std::string>>().singleInstance();
+        builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, domain::Uuid>>().singleInstance();
+
+        builder.registerType<MatchRepository>().as<IMatchRepository>().singleInstance();
 
         return builder.build();
     }
@@ -0,0 +1,201 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_COMPRESSION_HPP
+#define TOURNAMENTS_COMPRESSION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <crow.h>
+#include <zlib.h>
+#ifdef TOURNAMENTS_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#include "common/ETag.hpp"
+
+#define ACCEPT_ENCODING_HEADER "Accept-Encoding"
+#define CONTENT_ENCODING_HEADER "Content-Encoding"
+#define VARY_HEADER "Vary"
+
+enum class ContentCoding : std::uint8_t { Identity, Zstd, Gzip, Deflate };
+
+// The encodings a body can be sent in, in the order the server picks them when a client weighs them alike.
+inline constexpr std::array<ContentCoding, 3> CONTENT_CODINGS{ContentCoding::Zstd, ContentCoding::Gzip, ContentCoding::Deflate};
+
+constexpr std::string_view codingName(ContentCoding coding) {
+    switch (coding) {
+        case ContentCoding::Zstd: return "zstd";
+        case ContentCoding::Gzip: return "gzip";
+        case ContentCoding::Deflate: return "deflate";
+        default: return "identity";
+    }
+}
+
+constexpr bool codingAvailable(ContentCoding coding) {
+#ifdef TOURNAMENTS_WITH_ZSTD
+    return coding != ContentCoding::Identity;
+#else
+    return coding != ContentCoding::Identity && coding != ContentCoding::Zstd;
+#endif
+}
+
+// The q value Accept-Encoding gives coding. A named entry wins over "*", a coding the header leaves out gets 0.
+inline double acceptWeight(std::string_view acceptEncoding, std::string_view coding) {
+    const auto trim = [](std::string_view value) {
+        const auto first = value.find_first_not_of(" \t");
+        if (first == std::string_view::npos) {
+            return std::string_view{};
+        }
+        return value.substr(first, value.find_last_not_of(" \t") - first + 1);
+    };
+    const auto equalsIgnoreCase = [](std::string_view left, std::string_view right) {
+        return std::ranges::equal(left, right, [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; });
+    };
+
+    double wildcard = 0;
+    while (!acceptEncoding.empty()) {
+        const auto comma = acceptEncoding.find(',');
+        std::string_view entry = acceptEncoding.substr(0, comma);
+        acceptEncoding.remove_prefix(comma == std::string_view::npos ? acceptEncoding.size() : comma + 1);
+
+        const auto semicolon = entry.find(';');
+        const std::string_view name = trim(entry.substr(0, semicolon));
+        double weight = 1;
+        if (semicolon != std::string_view::npos) {
+            const std::string_view parameter = trim(entry.substr(semicolon + 1));
+            if (parameter.starts_with("q=") || parameter.starts_with("Q=")) {
+                std::from_chars(parameter.data() + 2, parameter.data() + parameter.size(), weight);
+            }
+        }
+        if (equalsIgnoreCase(name, coding) || (coding == "gzip" && equalsIgnoreCase(name, "x-gzip"))) {
+            return weight;
+        }
+        if (name == "*") {
+            wildcard = weight;
+        }
+    }
+    return wildcard;
+}
+
+// The best encoding this build supports that the client accepts, Identity when it accepts none.
+inline ContentCoding negotiateCoding(std::string_view acceptEncoding) {
+    ContentCoding best = ContentCoding::Identity;
+    double bestWeight = 0;
+    for (const auto coding : CONTENT_CODINGS) {
+        if (!codingAvailable(coding)) {
+            continue;
+        }
+        if (const double weight = acceptWeight(acceptEncoding, codingName(coding)); weight > bestWeight) {
+            best = coding;
+            bestWeight = weight;
+        }
+    }
+    return best;
+}
+
+// True once a response was negotiated for Accept-Encoding, its Vary headers name it.
+inline bool variesByEncoding(const crow::response& response) {
+    const auto [first, last] = response.headers.equal_range(VARY_HEADER);
+    return std::any_of(first, last, [](const auto& vary) { return vary.second.find(ACCEPT_ENCODING_HEADER) != std::string::npos; });
+}
+
+namespace detail {
+    // One deflate call over the whole body, windowBits picks the zlib (15) or gzip (15 + 16) wrapper.
+    inline std::string deflateBody(std::string_view body, int level, int windowBits) {
+        z_stream stream{};
+        if (deflateInit2(&stream, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error("Could not initialize the deflate stream");
+        }
+        std::string encoded(deflateBound(&stream, body.size()), '\0');
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(body.data()));
+        stream.avail_in = static_cast<uInt>(body.size());
+        stream.next_out = reinterpret_cast<Bytef*>(encoded.data());
+        stream.avail_out = static_cast<uInt>(encoded.size());
+        const int status = deflate(&stream, Z_FINISH);
+        encoded.resize(stream.total_out);
+        deflateEnd(&stream);
+        if (status != Z_STREAM_END) {
+            throw std::runtime_error("Could not deflate the response body");
+        }
+        return encoded;
+    }
+}
+
+// Content-Encoding negotiated from Accept-Encoding for bodies of at least minimumBytes. Smaller bodies go out
+// as they are, the few bytes compression would save do not pay for the CPU it costs.
+class ResponseCompression {
+    std::size_t minimumBytes;
+    int zlibLevel;
+    int zstdLevel;
+
+public:
+    explicit ResponseCompression(std::size_t minimumBytes = 0, int zlibLevel = 6, int zstdLevel = 3)
+        : minimumBytes(minimumBytes), zlibLevel(zlibLevel), zstdLevel(zstdLevel) {}
+
+    [[nodiscard]] bool Enabled() const {
+        return minimumBytes > 0;
+    }
+
+    [[nodiscard]] bool Compressible(std::size_t bodySize) const {
+        return Enabled() && bodySize >= minimumBytes;
+    }
+
+    // The encoding a body of bodySize goes out in for this request.
+    [[nodiscard]] ContentCoding Negotiate(const crow::request& request, std::size_t bodySize) const {
+        if (!Compressible(bodySize)) {
+            return ContentCoding::Identity;
+        }
+        return negotiateCoding(request.get_header_value(ACCEPT_ENCODING_HEADER));
+    }
+
+    [[nodiscard]] std::string Encode(std::string_view body, ContentCoding coding) const {
+        switch (coding) {
+            case ContentCoding::Gzip: return detail::deflateBody(body, zlibLevel, 15 + 16);
+            case ContentCoding::Deflate: return detail::deflateBody(body, zlibLevel, 15);
+#ifdef TOURNAMENTS_WITH_ZSTD
+            case ContentCoding::Zstd: {
+                std::string encoded(ZSTD_compressBound(body.size()), '\0');
+                const std::size_t size = ZSTD_compress(encoded.data(), encoded.size(), body.data(), body.size(), zstdLevel);
+                if (ZSTD_isError(size)) {
+                    throw std::runtime_error(ZSTD_getErrorName(size));
+                }
+                encoded.resize(size);
+                return encoded;
+            }
+#endif
+            default: return std::string(body);
+        }
+    }
+
+    // Encodes a successful response in place, its ETag then names the encoded body. Responses that were already
+    // negotiated, cache hits served from a stored encoding among them, vary by Accept-Encoding already and pass
+    // through untouched.
+    void Apply(const crow::request& request, crow::response& response) const {
+        if (response.code < 200 || response.code >= 300 || !Compressible(response.body.size()) || variesByEncoding(response)) {
+            return;
+        }
+        response.add_header(VARY_HEADER, ACCEPT_ENCODING_HEADER);
+        const auto coding = negotiateCoding(request.get_header_value(ACCEPT_ENCODING_HEADER));
+        if (coding == ContentCoding::Identity) {
+            return;
+        }
+        if (auto encoded = Encode(response.body, coding); encoded.size() < response.body.size()) {
+            response.body = std::move(encoded);
+            response.add_header(CONTENT_ENCODING_HEADER, std::string(codingName(coding)));
+            if (const std::string& etag = response.get_header_value(ETAG_HEADER); !etag.empty()) {
+                response.set_header(ETAG_HEADER, appendETagVariant(etag, codingName(coding)));
+            }
+        }
+    }
+};
+
+#endif //TOURNAMENTS_COMPRESSION_HPP
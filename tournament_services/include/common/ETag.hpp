@@ -0,0 +1,134 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_ETAG_HPP
+#define TOURNAMENTS_ETAG_HPP
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <format>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <crow.h>
+
+#define ETAG_HEADER "ETag"
+#define IF_NONE_MATCH_HEADER "If-None-Match"
+#define IF_MATCH_HEADER "If-Match"
+
+// crow::status has no name for it
+inline constexpr int PRECONDITION_FAILED = 412;
+
+// Entity tags are the row version every write bumps. A GET carrying If-None-Match is answered from a
+// version probe that does not read the document, a 304 when the client's copy is still current. A write
+// carrying If-Match hands the version to its UPDATE, which only matches that version and also reports
+// whether the row exists, so a stale copy answers 412 and a missing row 404 without a second query.
+
+// The row version is the entity tag of the JSON document sent without a content coding, "7". Any other
+// representation of that version appends what sets it apart, "7-gzip": a strong tag names one sequence of
+// bytes, a cache holding the gzip body under "7" would revalidate it for a client that accepts no gzip.
+// Tags are only unique within one resource URL.
+inline std::string formatETag(std::int64_t version, std::string_view variant = {}) {
+    return variant.empty() ? std::format("\"{}\"", version) : std::format("\"{}-{}\"", version, variant);
+}
+
+// The tag of another representation of what tag names, "7-gzip" from "7". Anything not quoted is left as it is.
+// Whatever representation a tag was sent for, If-Match conditions on its version.
+inline std::string appendETagVariant(std::string_view tag, std::string_view variant) {
+    if (tag.size() < 2 || tag.back() != '"') {
+        return std::string(tag);
+    }
+    return std::format("{}-{}\"", tag.substr(0, tag.size() - 1), variant);
+}
+
+namespace detail {
+    // What is between the quotes, the weak W/ an intermediary may have rewritten the tag to dropped unless
+    // strong is asked for. Empty when it is not a quoted tag.
+    inline std::optional<std::string_view> opaqueTag(std::string_view tag, bool strong) {
+        const auto first = tag.find_first_not_of(' ');
+        if (first == std::string_view::npos) {
+            return std::nullopt;
+        }
+        tag = tag.substr(first, tag.find_last_not_of(' ') - first + 1);
+        if (tag.starts_with("W/")) {
+            if (strong) {
+                return std::nullopt;
+            }
+            tag.remove_prefix(2);
+        }
+        if (tag.size() < 3 || tag.front() != '"' || tag.back() != '"') {
+            return std::nullopt;
+        }
+        return tag.substr(1, tag.size() - 2);
+    }
+}
+
+// The version "7" and every representation of it, "7-gzip", stand for. Anything else is not one of ours.
+inline std::optional<std::int64_t> parseETag(std::string_view tag, bool strong = false) {
+    const auto opaque = detail::opaqueTag(tag, strong);
+    if (!opaque) {
+        return std::nullopt;
+    }
+    std::int64_t version = 0;
+    const char* end = opaque->data() + opaque->size();
+    const auto [last, error] = std::from_chars(opaque->data(), end, version);
+    if (error != std::errc{} || (last != end && (*last != '-' || last + 1 == end))) {
+        return std::nullopt;
+    }
+    return version;
+}
+
+// The tag If-None-Match lists for a current representation: version in one of the variants the request may
+// be answered in, the first being the one * stands for. Empty when none of the client's copies is current.
+template<std::size_t Count>
+std::optional<std::string> matchIfNoneMatch(std::string_view header, std::int64_t version, const std::array<std::string, Count>& variants) {
+    while (!header.empty()) {
+        const auto end = header.find(',');
+        const auto tag = header.substr(0, end);
+        header.remove_prefix(end == std::string_view::npos ? header.size() : end + 1);
+        if (const auto first = tag.find_first_not_of(' '); first != std::string_view::npos && tag[first] == '*') {
+            return formatETag(version, variants.front());
+        }
+        const auto opaque = detail::opaqueTag(tag, false);
+        if (!opaque) {
+            continue;
+        }
+        for (const auto& variant : variants) {
+            if (const auto current = formatETag(version, variant); current.substr(1, current.size() - 2) == *opaque) {
+                return current;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+// Version a write is conditioned on, empty without If-Match or with If-Match: * since the update
+// already fails on a missing row. If-Match compares strongly, a weak tag never satisfies it and the
+// write fails with 412 as for a stale one. Anything else that is not one of our tags is a 400.
+inline std::expected<std::optional<std::int64_t>, crow::response> parseIfMatch(const crow::request& request) {
+    const std::string& header = request.get_header_value(IF_MATCH_HEADER);
+    const auto first = header.find_first_not_of(' ');
+    if (first == std::string::npos || header[first] == '*') {
+        return std::optional<std::int64_t>{};
+    }
+    if (std::string_view(header).substr(first).starts_with("W/") && parseETag(header)) {
+        return std::unexpected(crow::response{PRECONDITION_FAILED, "If-Match needs a strong ETag, a weak one never matches"});
+    }
+    const auto version = parseETag(header, true);
+    if (!version) {
+        return std::unexpected(crow::response{crow::BAD_REQUEST, "If-Match must be a single ETag returned by this service"});
+    }
+    return version;
+}
+
+inline crow::response notModified(std::string etag) {
+    crow::response response{crow::NOT_MODIFIED};
+    response.add_header(ETAG_HEADER, std::move(etag));
+    return response;
+}
+
+#endif //TOURNAMENTS_ETAG_HPP
@@ -0,0 +1,257 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_JSONWRITER_HPP
+#define TOURNAMENTS_JSONWRITER_HPP
+
+#include <charconv>
+#include <concepts>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <crow.h>
+
+#include "domain/Group.hpp"
+#include "domain/Standing.hpp"
+#include "domain/Team.hpp"
+#include "domain/Tournament.hpp"
+#include "domain/Uuid.hpp"
+
+// One member of a serialized object: its key, how to read it from T and whether an empty value is left out.
+template<typename Get>
+struct JsonField {
+    std::string_view key;
+    Get get;
+    bool omitEmpty = false;
+};
+
+// Specialized for every type a response carries, fields in the order they are written. The order is
+// the sorted key order nlohmann::json wrote, so bodies stay byte for byte what clients got before.
+template<typename T>
+struct JsonFields;
+
+template<typename T>
+concept JsonObject = requires { JsonFields<T>::fields; };
+
+// What omitEmpty leaves out: an empty string, or a nil id.
+template<typename Value>
+bool emptyJsonValue(const Value& value) {
+    if constexpr (requires { value.empty(); }) {
+        return value.empty();
+    } else {
+        return false;
+    }
+}
+
+inline bool emptyJsonValue(const domain::Uuid& id) {
+    return id.IsNil();
+}
+
+// A value written with the descriptor Fields instead of JsonFields, for types serialized differently
+// where they are nested in another one.
+template<typename Fields, typename Value>
+struct JsonAs {
+    const Value& value;
+};
+
+// Serializes domain objects straight into a string, usually the response body, without building an
+// nlohmann::json tree first. Output matches nlohmann's dump(): compact, UTF-8 passed through as is.
+class JsonWriter {
+    std::string& out;
+
+    template<typename T, typename Field>
+    void member(const T& object, const Field& field, bool& first) {
+        decltype(auto) value = field.get(object);
+        if (field.omitEmpty && emptyJsonValue(value)) {
+            return;
+        }
+        if (!first) {
+            out.push_back(',');
+        }
+        first = false;
+        out.push_back('"');
+        out.append(field.key);
+        out.append("\":");
+        Write(value);
+    }
+
+public:
+    explicit JsonWriter(std::string& out) : out(out) {}
+
+    void Write(std::string_view value) {
+        static constexpr char hex[] = "0123456789abcdef";
+        out.push_back('"');
+        std::size_t run = 0;
+        for (std::size_t i = 0; i < value.size(); ++i) {
+            const auto c = static_cast<unsigned char>(value[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+            out.append(value.substr(run, i - run));
+            run = i + 1;
+            switch (c) {
+                case '"': out.append("\\\""); break;
+                case '\\': out.append("\\\\"); break;
+                case '\b': out.append("\\b"); break;
+                case '\f': out.append("\\f"); break;
+                case '\n': out.append("\\n"); break;
+                case '\r': out.append("\\r"); break;
+                case '\t': out.append("\\t"); break;
+                default:
+                    out.append("\\u00");
+                    out.push_back(hex[c >> 4]);
+                    out.push_back(hex[c & 0xF]);
+            }
+        }
+        out.append(value.substr(run));
+        out.push_back('"');
+    }
+
+    void Write(const std::string& value) {
+        Write(std::string_view(value));
+    }
+
+    void Write(const char* value) {
+        Write(std::string_view(value));
+    }
+
+    // formatted straight into the output, a nil id as the empty string entities without one always had
+    void Write(const domain::Uuid& id) {
+        out.push_back('"');
+        if (!id.IsNil()) {
+            const std::size_t start = out.size();
+            out.resize(start + domain::Uuid::TEXT_SIZE);
+            id.Format(out.data() + start);
+        }
+        out.push_back('"');
+    }
+
+    template<std::integral Number> requires (!std::same_as<Number, bool>)
+    void Write(Number value) {
+        char digits[24];
+        const auto [last, error] = std::to_chars(digits, digits + sizeof(digits), value);
+        out.append(digits, last);
+    }
+
+    template<typename Fields, typename T>
+    void WriteAs(const T& object) {
+        out.push_back('{');
+        bool first = true;
+        std::apply([&](const auto&... field) { (member(object, field, first), ...); }, Fields::fields);
+        out.push_back('}');
+    }
+
+    template<JsonObject T>
+    void Write(const T& object) {
+        WriteAs<JsonFields<T>>(object);
+    }
+
+    template<typename Fields, typename T>
+    void Write(const JsonAs<Fields, std::vector<T>>& values) {
+        out.push_back('[');
+        for (std::size_t i = 0; i < values.value.size(); ++i) {
+            if (i > 0) {
+                out.push_back(',');
+            }
+            WriteAs<Fields>(values.value[i]);
+        }
+        out.push_back(']');
+    }
+
+    template<typename T>
+    void Write(const std::shared_ptr<T>& object) {
+        if (object == nullptr) {
+            out.append("null");
+            return;
+        }
+        Write(*object);
+    }
+
+    template<typename T>
+    void Write(const std::vector<T>& values) {
+        out.push_back('[');
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            if (i > 0) {
+                out.push_back(',');
+            }
+            Write(values[i]);
+        }
+        out.push_back(']');
+    }
+};
+
+// A response whose body is value serialized in place. The body is reserved at the size the last
+// response of the same type needed, so a list grows its buffer once instead of doubling its way up.
+template<typename T>
+crow::response jsonResponse(int code, const T& value) {
+    static thread_local std::size_t sizeHint = 0;
+    crow::response response{code};
+    response.body.reserve(sizeHint);
+    JsonWriter(response.body).Write(value);
+    sizeHint = response.body.size();
+    return response;
+}
+
+template<>
+struct JsonFields<domain::Team> {
+    static constexpr auto fields = std::tuple{
+        JsonField{"id", [](const domain::Team& team) -> const domain::Uuid& { return team.Id; }, true},
+        JsonField{"name", [](const domain::Team& team) -> const std::string& { return team.Name; }},
+    };
+};
+
+// Teams inside a group always carry their id, even an empty one, as to_json(const Team&) wrote them.
+struct EmbeddedTeamFields {
+    static constexpr auto fields = std::tuple{
+        JsonField{"id", [](const domain::Team& team) -> const domain::Uuid& { return team.Id; }},
+        JsonField{"name", [](const domain::Team& team) -> const std::string& { return team.Name; }},
+    };
+};
+
+template<>
+struct JsonFields<domain::Group> {
+    static constexpr auto fields = std::tuple{
+        JsonField{"id", [](const domain::Group& group) -> const domain::Uuid& { return group.Id(); }, true},
+        JsonField{"name", [](const domain::Group& group) -> const std::string& { return group.Name(); }},
+        JsonField{"teams", [](const domain::Group& group) { return JsonAs<EmbeddedTeamFields, std::vector<domain::Team>>{group.Teams()}; }},
+        JsonField{"tournamentId", [](const domain::Group& group) -> const domain::Uuid& { return group.TournamentId(); }},
+    };
+};
+
+template<>
+struct JsonFields<domain::TournamentFormat> {
+    static constexpr auto fields = std::tuple{
+        JsonField{"maxTeamsPerGroup", [](const domain::TournamentFormat& format) { return format.MaxTeamsPerGroup(); }},
+        JsonField{"numberOfGroups", [](const domain::TournamentFormat& format) { return format.NumberOfGroups(); }},
+        JsonField{"type", [](const domain::TournamentFormat& format) -> std::string_view {
+            return format.Type() == domain::TournamentType::NFL ? "NFL" : "ROUND_ROBIN";
+        }},
+    };
+};
+
+template<>
+struct JsonFields<domain::Tournament> {
+    static constexpr auto fields = std::tuple{
+        JsonField{"format", [](const domain::Tournament& tournament) { return tournament.Format(); }},
+        JsonField{"id", [](const domain::Tournament& tournament) -> const domain::Uuid& { return tournament.Id(); }, true},
+        JsonField{"name", [](const domain::Tournament& tournament) -> const std::string& { return tournament.Name(); }},
+    };
+};
+
+template<>
+struct JsonFields<domain::Standing> {
+    static constexpr auto fields = std::tuple{
+        JsonField{"losses", [](const domain::Standing& standing) { return standing.Losses; }},
+        JsonField{"netPoints", [](const domain::Standing& standing) { return standing.NetPoints; }},
+        JsonField{"teamId", [](const domain::Standing& standing) -> const domain::Uuid& { return standing.TeamId; }},
+        JsonField{"teamName", [](const domain::Standing& standing) -> const std::string& { return standing.TeamName; }},
+        JsonField{"ties", [](const domain::Standing& standing) { return standing.Ties; }},
+        JsonField{"wins", [](const domain::Standing& standing) { return standing.Wins; }},
+    };
+};
+
+#endif //TOURNAMENTS_JSONWRITER_HPP
@@ -0,0 +1,84 @@
+#ifndef TOURNAMENTS_PAGINATION_HPP
+#define TOURNAMENTS_PAGINATION_HPP
+
+#include <charconv>
+#include <cstring>
+#include <expected>
+#include <format>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <crow.h>
+
+#include "domain/Uuid.hpp"
+
+inline constexpr std::size_t DEFAULT_PAGE_SIZE = 100;
+inline constexpr std::size_t MAX_PAGE_SIZE = 1000;
+// Crow sends a body only once it is complete, so an unpaged export is held in memory whole and capped here.
+inline constexpr std::size_t MAX_EXPORT_ROWS = 10000;
+inline constexpr int PAYLOAD_TOO_LARGE = 413;
+
+// ?limit=&after= cursor, after is the last id of the previous page.
+struct PageRequest {
+    std::optional<domain::Uuid> after;
+    std::size_t limit = DEFAULT_PAGE_SIZE;
+};
+
+// Empty when the request carries neither limit nor after, the caller then exports the whole collection.
+inline std::expected<std::optional<PageRequest>, std::string> parsePageRequest(const crow::request& request) {
+    const char* limit = request.url_params.get("limit");
+    const char* after = request.url_params.get("after");
+    if (limit == nullptr && after == nullptr) {
+        return std::optional<PageRequest>{};
+    }
+
+    PageRequest page;
+    if (limit != nullptr) {
+        const char* end = limit + std::strlen(limit);
+        const auto [last, error] = std::from_chars(limit, end, page.limit);
+        if (error != std::errc{} || last != end || page.limit == 0 || page.limit > MAX_PAGE_SIZE) {
+            return std::unexpected(std::format("limit must be between 1 and {}", MAX_PAGE_SIZE));
+        }
+    }
+    if (after != nullptr) {
+        page.after = domain::Uuid::Parse(after);
+        if (!page.after) {
+            return std::unexpected(std::string(domain::INVALID_ID_MESSAGE));
+        }
+    }
+    return page;
+}
+
+// A full page may have a successor, point the client at it with a Link header.
+inline void addNextPageLink(crow::response& response, std::string_view path, const PageRequest& page, std::size_t returned, const domain::Uuid& lastId) {
+    if (returned == page.limit) {
+        response.add_header("Link", std::format("<{}?limit={}&after={}>; rel=\"next\"", path, page.limit, lastId));
+    }
+}
+
+// Joins rows that are already serialized JSON objects into one array body, no DOM is built. A collection
+// of more than MAX_EXPORT_ROWS is refused by exportRows before any row is read and answered 413, it is
+// never cut short into something that looks like all of it.
+inline crow::response exportJsonArray(std::string_view path, const std::function<bool(const std::function<void(std::string_view)>&, std::size_t)>& exportRows) {
+    crow::response response{crow::OK};
+    response.body.push_back('[');
+    bool first = true;
+    const bool exported = exportRows([&](std::string_view row) {
+        if (!first) {
+            response.body.push_back(',');
+        }
+        first = false;
+        response.body.append(row);
+    }, MAX_EXPORT_ROWS);
+    if (!exported) {
+        crow::response tooLarge{PAYLOAD_TOO_LARGE, std::format("More than {} entries, page through them with ?limit=", MAX_EXPORT_ROWS)};
+        tooLarge.add_header("Link", std::format("<{}?limit={}>; rel=\"first\"", path, MAX_PAGE_SIZE));
+        return tooLarge;
+    }
+    response.body.push_back(']');
+    response.add_header("content-type", "application/json");
+    return response;
+}
+
+#endif //TOURNAMENTS_PAGINATION_HPP
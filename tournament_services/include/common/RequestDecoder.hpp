@@ -0,0 +1,346 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_REQUESTDECODER_HPP
+#define TOURNAMENTS_REQUESTDECODER_HPP
+
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <format>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <crow.h>
+#include <nlohmann/json.hpp>
+
+#include "common/JsonWriter.hpp"
+#include "domain/Uuid.hpp"
+
+enum class FieldKind { String, Integer, Object, Array };
+
+// One field a request body may carry. Fields nest through parent, the index of the enclosing Object or
+// Array rule; the elements of an array are the single rule whose parent is the array and whose name is empty.
+// The setters write into the object being decoded, nested fields reach their member from the root.
+template<typename T>
+struct FieldRule {
+    std::string_view name;
+    FieldKind kind = FieldKind::String;
+    int parent = -1;
+    bool required = false;
+    std::size_t minLength = 0;
+    std::size_t maxLength = std::numeric_limits<std::size_t>::max();
+    std::int64_t minimum = std::numeric_limits<int>::min();
+    std::int64_t maximum = std::numeric_limits<int>::max();
+    // the only values a string may take, any value when the first is empty
+    std::array<std::string_view, 4> oneOf{};
+    void (*text)(T&, std::string_view) = nullptr;
+    // a string that must be an id, handed over parsed; anything else is answered like a malformed id in the path
+    void (*id)(T&, const domain::Uuid&) = nullptr;
+    void (*number)(T&, std::int64_t) = nullptr;
+    // arrays, called before each element is decoded so its fields have somewhere to go
+    void (*element)(T&) = nullptr;
+};
+
+// The fields one endpoint accepts, checked when the schema is compiled rather than when a request comes in.
+template<typename T, std::size_t N>
+struct RequestSchema {
+    std::array<FieldRule<T>, N> rules;
+
+    consteval RequestSchema(std::array<FieldRule<T>, N> rules) : rules(rules) {
+        static_assert(N <= 64, "a schema tracks the fields it has seen in one 64 bit mask");
+        for (std::size_t i = 0; i < N; ++i) {
+            const auto parent = rules[i].parent;
+            if (parent >= static_cast<int>(i)) {
+                throw "a field must come after the object or array that holds it";
+            }
+            if (parent >= 0 && rules[parent].kind != FieldKind::Object && rules[parent].kind != FieldKind::Array) {
+                throw "only objects and arrays hold fields";
+            }
+            if (parent >= 0 && (rules[parent].kind == FieldKind::Array) != rules[i].name.empty()) {
+                throw "array elements are unnamed, object fields are named";
+            }
+        }
+    }
+};
+
+struct FieldViolation {
+    std::string field;
+    std::string message;
+};
+
+// Everything wrong with a request body, all fields are reported at once rather than the first one.
+struct RequestError {
+    std::string error;
+    std::vector<FieldViolation> violations;
+};
+
+template<>
+struct JsonFields<FieldViolation> {
+    static constexpr auto fields = std::tuple{
+        JsonField{"field", [](const FieldViolation& violation) -> const std::string& { return violation.field; }},
+        JsonField{"message", [](const FieldViolation& violation) -> const std::string& { return violation.message; }},
+    };
+};
+
+template<>
+struct JsonFields<RequestError> {
+    static constexpr auto fields = std::tuple{
+        JsonField{"error", [](const RequestError& error) -> const std::string& { return error.error; }},
+        JsonField{"violations", [](const RequestError& error) -> const std::vector<FieldViolation>& { return error.violations; }},
+    };
+};
+
+inline crow::response badRequest(const RequestError& error) {
+    auto response = jsonResponse(crow::BAD_REQUEST, error);
+    response.add_header("content-type", "application/json");
+    return response;
+}
+
+namespace detail {
+    // SAX handler that validates each value against the schema as the parser reaches it and hands it to
+    // the rule's setter, so the body is read once and no DOM is built.
+    template<typename T, std::size_t N>
+    class RequestHandler {
+        using json = nlohmann::json;
+        static constexpr int BODY = -1;
+        static constexpr int SKIP = -2;
+
+        struct Frame {
+            int rule;
+            bool array = false;
+            std::uint64_t seen = 0;
+            std::size_t elements = 0;
+        };
+
+        const RequestSchema<T, N>& schema;
+        T& object;
+        RequestError& error;
+        std::vector<Frame> frames;
+        // rule of the value that follows the last key
+        int pending = SKIP;
+
+        [[nodiscard]] int child(int parent, std::string_view name) const {
+            for (std::size_t i = 0; i < N; ++i) {
+                if (schema.rules[i].parent == parent && schema.rules[i].name == name) {
+                    return static_cast<int>(i);
+                }
+            }
+            return SKIP;
+        }
+
+        // Rule of the value about to be read, counting it when it is an array element.
+        int target() {
+            if (frames.empty()) {
+                return BODY;
+            }
+            Frame& top = frames.back();
+            if (top.rule == SKIP) {
+                return SKIP;
+            }
+            if (top.array) {
+                ++top.elements;
+                return child(top.rule, "");
+            }
+            const int rule = pending;
+            pending = SKIP;
+            if (rule >= 0) {
+                top.seen |= std::uint64_t{1} << rule;
+            }
+            return rule;
+        }
+
+        [[nodiscard]] std::string path(std::string_view leaf) const {
+            std::string path;
+            for (const auto& frame : frames) {
+                if (frame.rule >= 0 && !schema.rules[frame.rule].name.empty()) {
+                    path.append(path.empty() ? "" : ".").append(schema.rules[frame.rule].name);
+                }
+                if (frame.array) {
+                    path.append(std::format("[{}]", frame.elements - 1));
+                }
+            }
+            if (!leaf.empty()) {
+                path.append(path.empty() ? "" : ".").append(leaf);
+            }
+            return path;
+        }
+
+        bool violation(int rule, std::string message) {
+            error.violations.push_back({path(rule >= 0 ? schema.rules[rule].name : ""), std::move(message)});
+            return true;
+        }
+
+        bool mismatch(int rule) {
+            if (rule == SKIP) {
+                return true;
+            }
+            if (rule == BODY) {
+                return violation(rule, "body must be a JSON object");
+            }
+            switch (schema.rules[rule].kind) {
+                case FieldKind::String: return violation(rule, "must be a string");
+                case FieldKind::Integer: return violation(rule, "must be an integer");
+                case FieldKind::Object: return violation(rule, "must be an object");
+                default: return violation(rule, "must be an array");
+            }
+        }
+
+        bool integer(std::int64_t value, bool inRange) {
+            const int rule = target();
+            if (rule < 0 || schema.rules[rule].kind != FieldKind::Integer) {
+                return mismatch(rule);
+            }
+            const auto& field = schema.rules[rule];
+            if (!inRange || value < field.minimum || value > field.maximum) {
+                return violation(rule, std::format("must be between {} and {}", field.minimum, field.maximum));
+            }
+            if (field.number != nullptr) {
+                field.number(object, value);
+            }
+            return true;
+        }
+
+        bool open(bool array) {
+            const int rule = target();
+            const auto kind = array ? FieldKind::Array : FieldKind::Object;
+            if (rule == BODY && !array) {
+                frames.push_back({BODY});
+                return true;
+            }
+            if (rule < 0 || schema.rules[rule].kind != kind) {
+                mismatch(rule);
+                frames.push_back({SKIP, array});
+                return true;
+            }
+            if (frames.back().array && schema.rules[frames.back().rule].element != nullptr) {
+                schema.rules[frames.back().rule].element(object);
+            }
+            frames.push_back({rule, array});
+            return true;
+        }
+
+    public:
+        RequestHandler(const RequestSchema<T, N>& schema, T& object, RequestError& error) : schema(schema), object(object), error(error) {
+            frames.reserve(4);
+        }
+
+        bool null() {
+            // an explicit null reads as an absent field
+            if (const int rule = target(); rule >= 0 && !frames.empty()) {
+                frames.back().seen &= ~(std::uint64_t{1} << rule);
+            } else if (rule == BODY) {
+                return mismatch(rule);
+            }
+            return true;
+        }
+
+        bool boolean(bool) { return mismatch(target()); }
+        bool binary(json::binary_t&) { return mismatch(target()); }
+
+        bool number_integer(json::number_integer_t value) { return integer(value, true); }
+
+        bool number_unsigned(json::number_unsigned_t value) {
+            return integer(static_cast<std::int64_t>(value), value <= static_cast<json::number_unsigned_t>(std::numeric_limits<std::int64_t>::max()));
+        }
+
+        bool number_float(json::number_float_t, const json::string_t&) {
+            const int rule = target();
+            if (rule >= 0 && schema.rules[rule].kind == FieldKind::Integer) {
+                return violation(rule, "must be an integer");
+            }
+            return mismatch(rule);
+        }
+
+        bool string(json::string_t& value) {
+            const int rule = target();
+            if (rule < 0 || schema.rules[rule].kind != FieldKind::String) {
+                return mismatch(rule);
+            }
+            const auto& field = schema.rules[rule];
+            if (field.id != nullptr) {
+                const auto id = domain::Uuid::Parse(value);
+                if (!id) {
+                    return violation(rule, std::string(domain::INVALID_ID_MESSAGE));
+                }
+                field.id(object, *id);
+                return true;
+            }
+            if (value.size() < field.minLength) {
+                return violation(rule, field.minLength == 1 ? "must not be empty" : std::format("must be at least {} characters", field.minLength));
+            }
+            if (value.size() > field.maxLength) {
+                return violation(rule, std::format("must be at most {} characters", field.maxLength));
+            }
+            if (!field.oneOf[0].empty()) {
+                bool allowed = false;
+                std::string values;
+                for (const auto candidate : field.oneOf) {
+                    if (candidate.empty()) {
+                        break;
+                    }
+                    allowed = allowed || candidate == value;
+                    values.append(values.empty() ? "" : ", ").append(candidate);
+                }
+                if (!allowed) {
+                    return violation(rule, std::format("must be one of {}", values));
+                }
+            }
+            if (field.text != nullptr) {
+                field.text(object, value);
+            }
+            return true;
+        }
+
+        bool start_object(std::size_t) { return open(false); }
+        bool start_array(std::size_t) { return open(true); }
+
+        bool key(json::string_t& key) {
+            const Frame& top = frames.back();
+            pending = top.rule == SKIP ? SKIP : child(top.rule, key);
+            return true;
+        }
+
+        bool end_object() {
+            const Frame& top = frames.back();
+            if (top.rule != SKIP) {
+                for (std::size_t i = 0; i < N; ++i) {
+                    const auto& field = schema.rules[i];
+                    if (field.parent == top.rule && field.required && (top.seen & (std::uint64_t{1} << i)) == 0) {
+                        error.violations.push_back({path(field.name), "is required"});
+                    }
+                }
+            }
+            frames.pop_back();
+            return true;
+        }
+
+        bool end_array() {
+            frames.pop_back();
+            return true;
+        }
+
+        bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception&) {
+            error.error = "Invalid JSON body";
+            error.violations = {{"", std::format("malformed JSON at byte {}", position)}};
+            return false;
+        }
+    };
+}
+
+// Parses and validates a request body in one pass. Either every field passed its rule and object holds
+// the decoded value, or the error lists each violation for a 400.
+template<typename T, std::size_t N>
+std::expected<T, RequestError> decodeRequest(std::string_view body, const RequestSchema<T, N>& schema, T object = T()) {
+    RequestError error{"Invalid request body"};
+    detail::RequestHandler handler(schema, object, error);
+    nlohmann::json::sax_parse(body.begin(), body.end(), &handler);
+    if (!error.violations.empty()) {
+        return std::unexpected(std::move(error));
+    }
+    return object;
+}
+
+#endif //TOURNAMENTS_REQUESTDECODER_HPP
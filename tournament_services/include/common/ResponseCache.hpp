@@ -0,0 +1,379 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_RESPONSECACHE_HPP
+#define TOURNAMENTS_RESPONSECACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <crow.h>
+
+#include "common/Compression.hpp"
+#include "common/ETag.hpp"
+#include "common/WireFormat.hpp"
+#include "domain/Uuid.hpp"
+
+// What a cached response represents, its ids held as domain::Uuid so a key is compared and hashed as plain
+// memory and a lookup formats no string.
+struct CacheKey {
+    // None is the empty key, it stores and matches nothing.
+    enum class Resource : std::uint8_t { None, Team, Tournament, Groups, Group };
+
+    Resource resource = Resource::None;
+    // the team or the tournament
+    domain::Uuid owner;
+    // the group, nil for the other resources
+    domain::Uuid id;
+
+    static CacheKey Of(Resource resource, const domain::Uuid& owner, const domain::Uuid& id = {}) {
+        return {resource, owner, resource == Resource::Group ? id : domain::Uuid()};
+    }
+
+    // True for key itself and, for a tournament, everything below it.
+    [[nodiscard]] bool Contains(const CacheKey& key) const {
+        if (resource == Resource::None || owner != key.owner) {
+            return false;
+        }
+        return key == *this || (resource == Resource::Tournament && (key.resource == Resource::Groups || key.resource == Resource::Group));
+    }
+
+    bool operator==(const CacheKey&) const = default;
+};
+
+struct CacheKeyHash {
+    std::size_t operator()(const CacheKey& key) const noexcept {
+        return key.owner.Hash() ^ (key.id.Hash() + static_cast<std::size_t>(key.resource)) * 0x9E3779B97F4A7C15ULL;
+    }
+};
+
+inline CacheKey teamCacheKey(const domain::Uuid& teamId) {
+    return CacheKey::Of(CacheKey::Resource::Team, teamId);
+}
+
+inline CacheKey tournamentCacheKey(const domain::Uuid& tournamentId) {
+    return CacheKey::Of(CacheKey::Resource::Tournament, tournamentId);
+}
+
+inline CacheKey groupsCacheKey(const domain::Uuid& tournamentId) {
+    return CacheKey::Of(CacheKey::Resource::Groups, tournamentId);
+}
+
+inline CacheKey groupCacheKey(const domain::Uuid& tournamentId, const domain::Uuid& groupId) {
+    return CacheKey::Of(CacheKey::Resource::Group, tournamentId, groupId);
+}
+
+// Serialized body of a GET and the row version it was read at, the version is what the ETag carries.
+// Encoded copies of the body are added as clients ask for them, indexed by ContentCoding minus one.
+struct CachedResponse {
+    std::int64_t version;
+    std::shared_ptr<const std::string> body;
+    std::array<std::shared_ptr<const std::string>, CONTENT_CODINGS.size()> encoded{};
+};
+
+// Final JSON bytes of single resource reads, bounded by a byte budget and evicted with CLOCK: a hit only
+// sets the entry's reference bit under the shared lock, the hand clears bits and evicts under the exclusive
+// one. Delegates invalidate after every write. A read takes a Ticket before it goes to the database and its
+// Put is dropped when any invalidation happened in between, so a read that raced a write cannot cache what
+// it saw. The cache is per process, writes made by another instance are not seen by it, so entries are
+// only served for maxAge after they were stored. That bounds how stale such a write leaves them.
+class ResponseCache {
+    struct Slot {
+        CacheKey key;
+        CachedResponse response;
+        std::size_t bytes = 0;
+        // steady clock ticks at Put, entries older than maxAge are misses
+        std::chrono::steady_clock::rep stored = 0;
+        mutable std::atomic<bool> referenced{false};
+    };
+
+    // key and bookkeeping an entry costs on top of its body
+    static constexpr std::size_t ENTRY_OVERHEAD = 128;
+    static_assert(sizeof(CacheKey) < ENTRY_OVERHEAD);
+
+    const std::size_t budget;
+    const ResponseCompression compression;
+    // with a read replica a fill right after a write may still read the old row, fills wait this long
+    const std::chrono::steady_clock::duration settle;
+    // zero keeps entries until they are invalidated or evicted
+    const std::chrono::steady_clock::duration maxAge;
+
+    mutable std::shared_mutex mutex;
+    std::unordered_map<CacheKey, std::size_t, CacheKeyHash> index;
+    std::deque<Slot> slots;
+    std::vector<std::size_t> freeSlots;
+    std::size_t used = 0;
+    std::size_t hand = 0;
+
+    std::atomic<std::uint64_t> generation{0};
+    std::atomic<std::chrono::steady_clock::rep> lastInvalidation{0};
+
+    void evict(std::size_t slot) {
+        index.erase(slots[slot].key);
+        used -= slots[slot].bytes;
+        slots[slot].key = {};
+        slots[slot].response = {};
+        slots[slot].bytes = 0;
+        freeSlots.push_back(slot);
+    }
+
+    // Advances the hand until bytes fit, an entry referenced since the last pass gets another round.
+    void makeRoom(std::size_t bytes) {
+        for (std::size_t steps = 0; used + bytes > budget && steps < 2 * slots.size(); ++steps) {
+            hand = (hand + 1) % slots.size();
+            Slot& slot = slots[hand];
+            if (slot.bytes == 0) {
+                continue;
+            }
+            if (slot.referenced.exchange(false, std::memory_order_relaxed)) {
+                continue;
+            }
+            evict(hand);
+        }
+    }
+
+    void invalidated() {
+        generation.fetch_add(1, std::memory_order_acq_rel);
+        lastInvalidation.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_release);
+    }
+
+public:
+    using Ticket = std::uint64_t;
+
+    // Drops its keys when it goes out of scope, after the write it guards whatever its outcome. With
+    // subtree every key below them goes too.
+    class Invalidation {
+        ResponseCache& cache;
+        std::vector<CacheKey> keys;
+        bool subtree;
+
+    public:
+        Invalidation(ResponseCache& cache, std::initializer_list<CacheKey> keys, bool subtree = false) : cache(cache), keys(keys), subtree(subtree) {}
+        ~Invalidation() {
+            for (const auto& key : keys) {
+                subtree ? cache.InvalidateTree(key) : cache.Invalidate(key);
+            }
+        }
+        Invalidation(const Invalidation&) = delete;
+        Invalidation& operator=(const Invalidation&) = delete;
+    };
+
+    explicit ResponseCache(std::size_t budgetBytes = 0, std::chrono::milliseconds settle = {}, ResponseCompression compression = ResponseCompression(),
+                           std::chrono::milliseconds maxAge = {})
+        : budget(budgetBytes), compression(compression), settle(settle), maxAge(maxAge) {}
+
+    [[nodiscard]] bool Enabled() const {
+        return budget > 0;
+    }
+
+    [[nodiscard]] std::optional<CachedResponse> Get(const CacheKey& key) const {
+        if (!Enabled() || key.resource == CacheKey::Resource::None) {
+            return std::nullopt;
+        }
+        std::shared_lock lock(mutex);
+        const auto found = index.find(key);
+        if (found == index.end()) {
+            return std::nullopt;
+        }
+        const Slot& slot = slots[found->second];
+        if (maxAge.count() > 0 && std::chrono::steady_clock::now().time_since_epoch().count() - slot.stored >= maxAge.count()) {
+            // left for the next Put or the hand to replace, a reader cannot evict under the shared lock
+            return std::nullopt;
+        }
+        slot.referenced.store(true, std::memory_order_relaxed);
+        return slot.response;
+    }
+
+    // Taken before the read whose result may be Put.
+    [[nodiscard]] Ticket Begin() const {
+        return generation.load(std::memory_order_acquire);
+    }
+
+    void Put(const CacheKey& key, std::int64_t version, std::string body, Ticket ticket) {
+        const std::size_t bytes = body.size() + ENTRY_OVERHEAD;
+        // one large list must not flush everything else
+        if (!Enabled() || key.resource == CacheKey::Resource::None || bytes > budget / 4) {
+            return;
+        }
+        const auto since = std::chrono::steady_clock::now().time_since_epoch().count() - lastInvalidation.load(std::memory_order_acquire);
+        if (since < settle.count()) {
+            return;
+        }
+
+        std::unique_lock lock(mutex);
+        if (generation.load(std::memory_order_acquire) != ticket) {
+            return;
+        }
+        if (const auto found = index.find(key); found != index.end()) {
+            if (slots[found->second].response.version > version) {
+                return;
+            }
+            evict(found->second);
+        }
+        makeRoom(bytes);
+        if (used + bytes > budget) {
+            return;
+        }
+
+        std::size_t slot;
+        if (!freeSlots.empty()) {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            slot = slots.size();
+            slots.emplace_back();
+        }
+        Slot& entry = slots[slot];
+        entry.key = key;
+        entry.response = {version, std::make_shared<const std::string>(std::move(body))};
+        entry.bytes = bytes;
+        entry.stored = std::chrono::steady_clock::now().time_since_epoch().count();
+        entry.referenced.store(false, std::memory_order_relaxed);
+        index.emplace(entry.key, slot);
+        used += bytes;
+    }
+
+    // Keeps an encoded copy of body next to it, charged to the same entry, so each encoding is computed once
+    // for all the hits that ask for it. Dropped when the entry no longer holds body, collections all have
+    // version 0 and a refill after an invalidation must not get the old copy, or the budget has no room.
+    void PutEncoded(const CacheKey& key, const std::shared_ptr<const std::string>& body, ContentCoding coding, std::shared_ptr<const std::string> encoded) {
+        if (!Enabled() || coding == ContentCoding::Identity) {
+            return;
+        }
+        std::unique_lock lock(mutex);
+        const auto found = index.find(key);
+        if (found == index.end() || used + encoded->size() > budget) {
+            return;
+        }
+        Slot& slot = slots[found->second];
+        auto& copy = slot.response.encoded[static_cast<std::size_t>(coding) - 1];
+        if (slot.response.body != body || copy != nullptr) {
+            return;
+        }
+        slot.bytes += encoded->size();
+        used += encoded->size();
+        copy = std::move(encoded);
+    }
+
+    // The ETag variants a request may be answered in: the format Accept picks, bare or in the coding
+    // Accept-Encoding picks when compression is on. Before the document is read its size is not known, a
+    // copy in either is current.
+    [[nodiscard]] std::array<std::string, 2> Variants(const crow::request& request) const {
+        const auto format = acceptedFormat(request.get_header_value(ACCEPT_HEADER));
+        std::string base = format == WireFormat::Json ? std::string() : std::string(formatName(format));
+        const auto coding = compression.Enabled() ? negotiateCoding(request.get_header_value(ACCEPT_ENCODING_HEADER)) : ContentCoding::Identity;
+        if (coding == ContentCoding::Identity) {
+            return {base, base};
+        }
+        std::string encoded = base.empty() ? std::string(codingName(coding)) : std::format("{}-{}", base, codingName(coding));
+        return {std::move(base), std::move(encoded)};
+    }
+
+    // A 304 when If-None-Match lists a current representation of version. It carries that representation's
+    // tag and the Vary a 200 would, so a cache revalidates the copy it holds for these request headers.
+    [[nodiscard]] std::optional<crow::response> NotModified(const crow::request& request, std::int64_t version) const {
+        const std::string& ifNoneMatch = request.get_header_value(IF_NONE_MATCH_HEADER);
+        if (ifNoneMatch.empty()) {
+            return std::nullopt;
+        }
+        auto etag = matchIfNoneMatch(ifNoneMatch, version, Variants(request));
+        if (!etag) {
+            return std::nullopt;
+        }
+        auto response = notModified(std::move(*etag));
+        response.add_header(VARY_HEADER, compression.Enabled() ? ACCEPT_HEADER ", " ACCEPT_ENCODING_HEADER : ACCEPT_HEADER);
+        return response;
+    }
+
+    // A hit is answered without the database or the serializer: 304 when the client's copy is current, the
+    // stored bytes otherwise, in the negotiated encoding and tagged for it. Version 0 marks a collection,
+    // those carry no ETag. A client asking for a binary format gets the JSON body, translated and compressed
+    // on the way out.
+    crow::response Respond(const crow::request& request, const CacheKey& key, const CachedResponse& cached) {
+        if (cached.version > 0) {
+            if (auto unchanged = NotModified(request, cached.version)) {
+                return std::move(*unchanged);
+            }
+        }
+        crow::response response{crow::OK};
+        response.add_header("content-type", "application/json");
+        if (cached.version > 0) {
+            response.add_header(ETAG_HEADER, formatETag(cached.version));
+        }
+
+        const std::string& body = *cached.body;
+        if (acceptedFormat(request.get_header_value(ACCEPT_HEADER)) != WireFormat::Json) {
+            response.body = body;
+            return response;
+        }
+        if (compression.Compressible(body.size())) {
+            response.add_header(VARY_HEADER, ACCEPT_ENCODING_HEADER);
+        }
+        const auto coding = compression.Negotiate(request, body.size());
+        if (coding == ContentCoding::Identity) {
+            response.body = body;
+            return response;
+        }
+        auto encoded = cached.encoded[static_cast<std::size_t>(coding) - 1];
+        if (encoded == nullptr) {
+            encoded = std::make_shared<const std::string>(compression.Encode(body, coding));
+            PutEncoded(key, cached.body, coding, encoded);
+        }
+        if (encoded->size() < body.size()) {
+            response.body = *encoded;
+            response.add_header(CONTENT_ENCODING_HEADER, std::string(codingName(coding)));
+            if (cached.version > 0) {
+                response.set_header(ETAG_HEADER, formatETag(cached.version, codingName(coding)));
+            }
+        } else {
+            response.body = body;
+        }
+        return response;
+    }
+
+    void Invalidate(const CacheKey& key) {
+        if (!Enabled()) {
+            return;
+        }
+        std::unique_lock lock(mutex);
+        invalidated();
+        if (const auto found = index.find(key); found != index.end()) {
+            evict(found->second);
+        }
+    }
+
+    // Drops key and every key below it, a tournament takes its groups along.
+    void InvalidateTree(const CacheKey& key) {
+        if (!Enabled()) {
+            return;
+        }
+        std::unique_lock lock(mutex);
+        invalidated();
+        for (std::size_t slot = 0; slot < slots.size(); ++slot) {
+            if (slots[slot].bytes > 0 && key.Contains(slots[slot].key)) {
+                evict(slot);
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t UsedBytes() const {
+        std::shared_lock lock(mutex);
+        return used;
+    }
+};
+
+#endif //TOURNAMENTS_RESPONSECACHE_HPP
@@ -0,0 +1,637 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_WIREFORMAT_HPP
+#define TOURNAMENTS_WIREFORMAT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <crow.h>
+#include <nlohmann/json.hpp>
+
+#include "common/ETag.hpp"
+#include "common/JsonWriter.hpp"
+
+#define ACCEPT_HEADER "Accept"
+#define MSGPACK_CONTENT_TYPE "application/msgpack"
+#define CBOR_CONTENT_TYPE "application/cbor"
+
+// How a payload travels. Controllers read JSON, the binary formats are the same document in MessagePack or
+// CBOR. Request bodies and JSON responses are translated at the edge, responses built from domain objects
+// may be written in the accepted format straight away.
+enum class WireFormat { Json, MessagePack, Cbor };
+
+// The format's part of an ETag variant, JSON being the representation the bare version tags.
+constexpr std::string_view formatName(WireFormat format) {
+    switch (format) {
+        case WireFormat::MessagePack: return "msgpack";
+        case WireFormat::Cbor: return "cbor";
+        default: return "json";
+    }
+}
+
+constexpr const char* formatContentType(WireFormat format) {
+    switch (format) {
+        case WireFormat::MessagePack: return MSGPACK_CONTENT_TYPE;
+        case WireFormat::Cbor: return CBOR_CONTENT_TYPE;
+        default: return "application/json";
+    }
+}
+
+namespace detail {
+    struct MediaType {
+        std::string_view name;
+        WireFormat format;
+    };
+
+    inline constexpr std::array<MediaType, 5> MEDIA_TYPES{{
+        {"application/json", WireFormat::Json},
+        {MSGPACK_CONTENT_TYPE, WireFormat::MessagePack},
+        {"application/x-msgpack", WireFormat::MessagePack},
+        {"application/vnd.msgpack", WireFormat::MessagePack},
+        {CBOR_CONTENT_TYPE, WireFormat::Cbor},
+    }};
+
+    inline std::string_view trim(std::string_view value) {
+        const auto first = value.find_first_not_of(" \t");
+        if (first == std::string_view::npos) {
+            return {};
+        }
+        return value.substr(first, value.find_last_not_of(" \t") - first + 1);
+    }
+
+    inline bool equalsIgnoreCase(std::string_view left, std::string_view right) {
+        return std::ranges::equal(left, right, [](char a, char b) {
+            return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+        });
+    }
+
+    // The type/subtype of a Content-Type or Accept entry, parameters dropped.
+    inline std::string_view mediaType(std::string_view value) {
+        return trim(value.substr(0, value.find(';')));
+    }
+
+    inline WireFormat formatOf(std::string_view type) {
+        for (const auto& media : MEDIA_TYPES) {
+            if (equalsIgnoreCase(type, media.name)) {
+                return media.format;
+            }
+        }
+        return WireFormat::Json;
+    }
+}
+
+// The format the client asked for in Accept. A binary type wins when the client weighs it at least as
+// high as JSON, which "*/*" and "application/*" stand in for; anything else answers in JSON.
+inline WireFormat acceptedFormat(std::string_view accept) {
+    double json = accept.empty() ? 1 : 0;
+    double best = 0;
+    WireFormat format = WireFormat::Json;
+    while (!accept.empty()) {
+        const auto comma = accept.find(',');
+        const std::string_view entry = accept.substr(0, comma);
+        accept.remove_prefix(comma == std::string_view::npos ? accept.size() : comma + 1);
+
+        const std::string_view type = detail::mediaType(entry);
+        double weight = 1;
+        if (const auto q = entry.find("q="); q != std::string_view::npos) {
+            std::from_chars(entry.data() + q + 2, entry.data() + entry.size(), weight);
+        }
+        const WireFormat named = detail::formatOf(type);
+        if (named != WireFormat::Json && weight > best) {
+            format = named;
+            best = weight;
+        } else if (named == WireFormat::Json && (type == "*/*" || type == "application/*" || detail::equalsIgnoreCase(type, "application/json"))) {
+            json = std::max(json, weight);
+        }
+    }
+    return best > 0 && best >= json ? format : WireFormat::Json;
+}
+
+inline WireFormat contentFormat(const crow::request& request) {
+    return detail::formatOf(detail::mediaType(request.get_header_value("content-type")));
+}
+
+// Writes MessagePack or CBOR items into out, each in the shortest form the format has for it like nlohmann's
+// to_msgpack and to_cbor. Floats always take eight bytes.
+class BinaryEncoder {
+    std::string& out;
+    WireFormat format;
+
+    void bigEndian(std::uint64_t value, int bytes) {
+        for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+            out.push_back(static_cast<char>(value >> shift));
+        }
+    }
+
+    // CBOR: the major type in the top three bits, the argument inline below 24 or in the bytes that follow.
+    void head(std::uint8_t major, std::uint64_t argument) {
+        const auto type = static_cast<std::uint8_t>(major << 5);
+        if (argument < 24) {
+            out.push_back(static_cast<char>(type | argument));
+        } else if (argument <= 0xFF) {
+            out.push_back(static_cast<char>(type | 24));
+            bigEndian(argument, 1);
+        } else if (argument <= 0xFFFF) {
+            out.push_back(static_cast<char>(type | 25));
+            bigEndian(argument, 2);
+        } else if (argument <= 0xFFFFFFFF) {
+            out.push_back(static_cast<char>(type | 26));
+            bigEndian(argument, 4);
+        } else {
+            out.push_back(static_cast<char>(type | 27));
+            bigEndian(argument, 8);
+        }
+    }
+
+    // MessagePack: the size in the fix form's low bits up to fixLimit, else after the 8 bit (strings only),
+    // 16 bit or 32 bit marker, which follow each other from first.
+    void length(std::uint8_t fix, std::size_t fixLimit, std::uint8_t first, std::size_t size) {
+        if (size <= fixLimit) {
+            out.push_back(static_cast<char>(fix | size));
+        } else if (first == 0xd9 && size <= 0xFF) {
+            out.push_back(static_cast<char>(first));
+            bigEndian(size, 1);
+        } else if (size <= 0xFFFF) {
+            out.push_back(static_cast<char>(first == 0xd9 ? 0xda : first));
+            bigEndian(size, 2);
+        } else {
+            out.push_back(static_cast<char>(first == 0xd9 ? 0xdb : first + 1));
+            bigEndian(size, 4);
+        }
+    }
+
+public:
+    BinaryEncoder(std::string& out, WireFormat format) : out(out), format(format) {}
+
+    void Null() {
+        out.push_back(static_cast<char>(format == WireFormat::MessagePack ? 0xc0 : 0xf6));
+    }
+
+    void Boolean(bool value) {
+        if (format == WireFormat::MessagePack) {
+            out.push_back(static_cast<char>(value ? 0xc3 : 0xc2));
+        } else {
+            out.push_back(static_cast<char>(value ? 0xf5 : 0xf4));
+        }
+    }
+
+    void Unsigned(std::uint64_t value) {
+        if (format == WireFormat::Cbor) {
+            head(0, value);
+        } else if (value < 0x80) {
+            out.push_back(static_cast<char>(value));
+        } else if (value <= 0xFF) {
+            out.push_back(static_cast<char>(0xcc));
+            bigEndian(value, 1);
+        } else if (value <= 0xFFFF) {
+            out.push_back(static_cast<char>(0xcd));
+            bigEndian(value, 2);
+        } else if (value <= 0xFFFFFFFF) {
+            out.push_back(static_cast<char>(0xce));
+            bigEndian(value, 4);
+        } else {
+            out.push_back(static_cast<char>(0xcf));
+            bigEndian(value, 8);
+        }
+    }
+
+    void Integer(std::int64_t value) {
+        if (value >= 0) {
+            Unsigned(static_cast<std::uint64_t>(value));
+        } else if (format == WireFormat::Cbor) {
+            head(1, static_cast<std::uint64_t>(-(value + 1)));
+        } else if (value >= -32) {
+            out.push_back(static_cast<char>(value));
+        } else if (value >= INT8_MIN) {
+            out.push_back(static_cast<char>(0xd0));
+            bigEndian(static_cast<std::uint64_t>(value), 1);
+        } else if (value >= INT16_MIN) {
+            out.push_back(static_cast<char>(0xd1));
+            bigEndian(static_cast<std::uint64_t>(value), 2);
+        } else if (value >= INT32_MIN) {
+            out.push_back(static_cast<char>(0xd2));
+            bigEndian(static_cast<std::uint64_t>(value), 4);
+        } else {
+            out.push_back(static_cast<char>(0xd3));
+            bigEndian(static_cast<std::uint64_t>(value), 8);
+        }
+    }
+
+    void Float(double value) {
+        out.push_back(static_cast<char>(format == WireFormat::MessagePack ? 0xcb : 0xfb));
+        bigEndian(std::bit_cast<std::uint64_t>(value), 8);
+    }
+
+    void String(std::string_view value) {
+        if (format == WireFormat::MessagePack) {
+            length(0xa0, 31, 0xd9, value.size());
+        } else {
+            head(3, value.size());
+        }
+        out.append(value);
+    }
+
+    void Array(std::size_t size) {
+        if (format == WireFormat::MessagePack) {
+            length(0x90, 15, 0xdc, size);
+        } else {
+            head(4, size);
+        }
+    }
+
+    // size is the number of key and value pairs.
+    void Map(std::size_t size) {
+        if (format == WireFormat::MessagePack) {
+            length(0x80, 15, 0xde, size);
+        } else {
+            head(5, size);
+        }
+    }
+};
+
+// JsonWriter for the binary formats: walks the same JsonFields descriptors, so the bytes are those
+// to_msgpack or to_cbor make of the JSON document without the document ever being built.
+class BinaryWriter {
+    BinaryEncoder encoder;
+
+    template<typename T, typename Field>
+    static bool present(const T& object, const Field& field) {
+        return !field.omitEmpty || !emptyJsonValue(field.get(object));
+    }
+
+    template<typename T, typename Field>
+    void member(const T& object, const Field& field) {
+        if (!present(object, field)) {
+            return;
+        }
+        encoder.String(field.key);
+        Write(field.get(object));
+    }
+
+public:
+    BinaryWriter(std::string& out, WireFormat format) : encoder(out, format) {}
+
+    void Write(std::string_view value) {
+        encoder.String(value);
+    }
+
+    void Write(const std::string& value) {
+        encoder.String(value);
+    }
+
+    void Write(const char* value) {
+        encoder.String(value);
+    }
+
+    void Write(const domain::Uuid& id) {
+        if (id.IsNil()) {
+            encoder.String({});
+            return;
+        }
+        char text[domain::Uuid::TEXT_SIZE];
+        id.Format(text);
+        encoder.String(std::string_view(text, sizeof(text)));
+    }
+
+    template<std::integral Number> requires (!std::same_as<Number, bool>)
+    void Write(Number value) {
+        if constexpr (std::is_signed_v<Number>) {
+            encoder.Integer(value);
+        } else {
+            encoder.Unsigned(value);
+        }
+    }
+
+    template<typename Fields, typename T>
+    void WriteAs(const T& object) {
+        encoder.Map(std::apply([&](const auto&... field) { return (std::size_t{0} + ... + present(object, field)); }, Fields::fields));
+        std::apply([&](const auto&... field) { (member(object, field), ...); }, Fields::fields);
+    }
+
+    template<JsonObject T>
+    void Write(const T& object) {
+        WriteAs<JsonFields<T>>(object);
+    }
+
+    template<typename Fields, typename T>
+    void Write(const JsonAs<Fields, std::vector<T>>& values) {
+        encoder.Array(values.value.size());
+        for (const auto& value : values.value) {
+            WriteAs<Fields>(value);
+        }
+    }
+
+    template<typename T>
+    void Write(const std::shared_ptr<T>& object) {
+        if (object == nullptr) {
+            encoder.Null();
+            return;
+        }
+        Write(*object);
+    }
+
+    template<typename T>
+    void Write(const std::vector<T>& values) {
+        encoder.Array(values.size());
+        for (const auto& value : values) {
+            Write(value);
+        }
+    }
+};
+
+namespace detail {
+    inline bool validUtf8(std::string_view text) {
+        for (std::size_t i = 0; i < text.size();) {
+            const auto lead = static_cast<unsigned char>(text[i]);
+            if (lead < 0x80) {
+                ++i;
+                continue;
+            }
+            std::size_t size;
+            std::uint32_t codePoint;
+            std::uint32_t minimum;
+            if ((lead & 0xE0) == 0xC0) {
+                size = 2, codePoint = lead & 0x1F, minimum = 0x80;
+            } else if ((lead & 0xF0) == 0xE0) {
+                size = 3, codePoint = lead & 0x0F, minimum = 0x800;
+            } else if ((lead & 0xF8) == 0xF0) {
+                size = 4, codePoint = lead & 0x07, minimum = 0x10000;
+            } else {
+                return false;
+            }
+            if (i + size > text.size()) {
+                return false;
+            }
+            for (std::size_t k = 1; k < size; ++k) {
+                const auto next = static_cast<unsigned char>(text[i + k]);
+                if ((next & 0xC0) != 0x80) {
+                    return false;
+                }
+                codePoint = codePoint << 6 | (next & 0x3F);
+            }
+            if (codePoint < minimum || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+                return false;
+            }
+            i += size;
+        }
+        return true;
+    }
+
+    // SAX handler writing a JSON document as MessagePack or CBOR as the parser reads it. A container's
+    // header goes in front of its items once its end tells how many there were.
+    class BinaryTranscoder {
+        using json = nlohmann::json;
+
+        struct Container {
+            std::size_t start;
+            std::size_t items = 0;
+            bool object = false;
+        };
+
+        std::string& out;
+        WireFormat format;
+        BinaryEncoder encoder;
+        std::vector<Container> open;
+
+        // Values count as items of an array, those of an object were counted with their key.
+        void value() {
+            if (!open.empty() && !open.back().object) {
+                ++open.back().items;
+            }
+        }
+
+        bool close() {
+            std::string header;
+            BinaryEncoder headerEncoder(header, format);
+            if (open.back().object) {
+                headerEncoder.Map(open.back().items);
+            } else {
+                headerEncoder.Array(open.back().items);
+            }
+            out.insert(open.back().start, header);
+            open.pop_back();
+            return true;
+        }
+
+    public:
+        BinaryTranscoder(std::string& out, WireFormat format) : out(out), format(format), encoder(out, format) {
+            open.reserve(4);
+        }
+
+        bool null() { value(); encoder.Null(); return true; }
+        bool boolean(bool flag) { value(); encoder.Boolean(flag); return true; }
+        bool number_integer(json::number_integer_t number) { value(); encoder.Integer(number); return true; }
+        bool number_unsigned(json::number_unsigned_t number) { value(); encoder.Unsigned(number); return true; }
+        bool number_float(json::number_float_t number, const json::string_t&) { value(); encoder.Float(number); return true; }
+        bool string(json::string_t& text) { value(); encoder.String(text); return true; }
+        // JSON text has no binary values
+        bool binary(json::binary_t&) { return false; }
+
+        bool start_object(std::size_t) {
+            value();
+            open.push_back({out.size(), 0, true});
+            return true;
+        }
+
+        bool key(json::string_t& key) {
+            ++open.back().items;
+            encoder.String(key);
+            return true;
+        }
+
+        bool end_object() { return close(); }
+
+        bool start_array(std::size_t) {
+            value();
+            open.push_back({out.size()});
+            return true;
+        }
+
+        bool end_array() { return close(); }
+
+        bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) { return false; }
+    };
+
+    // SAX handler writing a MessagePack or CBOR document as JSON text. Strings must be UTF-8 and binary values
+    // have no JSON form, either stops the translation.
+    class JsonTranscoder {
+        using json = nlohmann::json;
+
+        std::string& out;
+        JsonWriter writer;
+        // per open container, whether an item was written to it yet
+        std::vector<bool> filled;
+        bool afterKey = false;
+
+        void separator() {
+            if (afterKey) {
+                afterKey = false;
+            } else if (!filled.empty()) {
+                if (filled.back()) {
+                    out.push_back(',');
+                }
+                filled.back() = true;
+            }
+        }
+
+        bool text(std::string_view value) {
+            if (!validUtf8(value)) {
+                return false;
+            }
+            writer.Write(value);
+            return true;
+        }
+
+    public:
+        explicit JsonTranscoder(std::string& out) : out(out), writer(out) {
+            filled.reserve(4);
+        }
+
+        bool null() { separator(); out.append("null"); return true; }
+        bool boolean(bool flag) { separator(); out.append(flag ? "true" : "false"); return true; }
+        bool number_integer(json::number_integer_t number) { separator(); writer.Write(number); return true; }
+        bool number_unsigned(json::number_unsigned_t number) { separator(); writer.Write(number); return true; }
+
+        // as dump() writes them: shortest round trip digits, a fraction kept visible, null when not finite
+        bool number_float(json::number_float_t number, const json::string_t&) {
+            separator();
+            if (!std::isfinite(number)) {
+                out.append("null");
+                return true;
+            }
+            char digits[32];
+            const auto [last, error] = std::to_chars(digits, digits + sizeof(digits), number);
+            const std::string_view written(digits, last);
+            out.append(written);
+            if (written.find_first_of(".e") == std::string_view::npos) {
+                out.append(".0");
+            }
+            return true;
+        }
+
+        bool string(json::string_t& value) { separator(); return text(value); }
+        bool binary(json::binary_t&) { return false; }
+
+        bool start_object(std::size_t) {
+            separator();
+            out.push_back('{');
+            filled.push_back(false);
+            return true;
+        }
+
+        bool key(json::string_t& key) {
+            separator();
+            afterKey = true;
+            if (!text(key)) {
+                return false;
+            }
+            out.push_back(':');
+            return true;
+        }
+
+        bool end_object() {
+            out.push_back('}');
+            filled.pop_back();
+            return true;
+        }
+
+        bool start_array(std::size_t) {
+            separator();
+            out.push_back('[');
+            filled.push_back(false);
+            return true;
+        }
+
+        bool end_array() {
+            out.push_back(']');
+            filled.pop_back();
+            return true;
+        }
+
+        bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) { return false; }
+    };
+}
+
+// A MessagePack or CBOR request body as the JSON text it encodes, so every request schema and decoder applies
+// unchanged. Translated item by item, nothing is built in between. Null when the body already is JSON, a 400
+// when it does not decode or holds what JSON cannot, text that is not UTF-8 among it.
+inline std::expected<std::shared_ptr<const crow::request>, crow::response> jsonRequest(const crow::request& request) {
+    const WireFormat format = contentFormat(request);
+    if (format == WireFormat::Json) {
+        return nullptr;
+    }
+    auto decoded = std::make_shared<crow::request>(request);
+    decoded->body.clear();
+    decoded->body.reserve(request.body.size() * 2);
+    detail::JsonTranscoder transcoder(decoded->body);
+    const bool translated = nlohmann::json::sax_parse(request.body, &transcoder,
+        format == WireFormat::MessagePack ? nlohmann::json::input_format_t::msgpack : nlohmann::json::input_format_t::cbor);
+    if (!translated) {
+        return std::unexpected(crow::response{crow::BAD_REQUEST, format == WireFormat::MessagePack ? "Invalid MessagePack body" : "Invalid CBOR body"});
+    }
+    decoded->headers.erase("content-type");
+    decoded->add_header("content-type", "application/json");
+    return decoded;
+}
+
+// Re-encodes a JSON response in the format Accept asks for, translating the text as it is parsed, and tags
+// it as that format's representation. Only JSON bodies are touched, they all may vary with Accept; text
+// errors, empty bodies and bodies already written in a binary format go out as they are.
+inline void encodeResponse(const crow::request& request, crow::response& response) {
+    if (response.body.empty() || !detail::equalsIgnoreCase(detail::mediaType(response.get_header_value("content-type")), "application/json")) {
+        return;
+    }
+    response.add_header("Vary", ACCEPT_HEADER);
+    const WireFormat format = acceptedFormat(request.get_header_value(ACCEPT_HEADER));
+    if (format == WireFormat::Json) {
+        return;
+    }
+    std::string encoded;
+    encoded.reserve(response.body.size());
+    detail::BinaryTranscoder transcoder(encoded, format);
+    if (!nlohmann::json::sax_parse(response.body, &transcoder)) {
+        return;
+    }
+    response.body = std::move(encoded);
+    response.set_header("content-type", formatContentType(format));
+    if (const std::string& etag = response.get_header_value(ETAG_HEADER); !etag.empty()) {
+        response.set_header(ETAG_HEADER, appendETagVariant(etag, formatName(format)));
+    }
+}
+
+// A response with value serialized in the format Accept asks for, the binary ones straight from the
+// JsonFields descriptors. Sets the content type, and Vary since encodeResponse leaves binary bodies alone.
+template<typename T>
+crow::response wireResponse(const crow::request& request, int code, const T& value) {
+    const WireFormat format = acceptedFormat(request.get_header_value(ACCEPT_HEADER));
+    if (format == WireFormat::Json) {
+        auto response = jsonResponse(code, value);
+        response.add_header("content-type", "application/json");
+        return response;
+    }
+    static thread_local std::size_t sizeHint = 0;
+    crow::response response{code};
+    response.body.reserve(sizeHint);
+    BinaryWriter(response.body, format).Write(value);
+    sizeHint = response.body.size();
+    response.add_header("content-type", formatContentType(format));
+    response.add_header("Vary", ACCEPT_HEADER);
+    return response;
+}
+
+#endif //TOURNAMENTS_WIREFORMAT_HPP
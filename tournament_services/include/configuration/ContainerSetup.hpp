@@ -13,19 +13,30 @@
 #include "persistence/repository/IRepository.hpp"
 #include "persistence/repository/TeamRepository.hpp"
 #include "RunConfiguration.hpp"
+#include "configuration/DatabaseConfiguration.hpp"
 #include "cms/ConnectionManager.hpp"
 #include "delegate/TeamDelegate.hpp"
 #include "controller/TeamController.hpp"
 #include "controller/TournamentController.hpp"
 #include "delegate/TournamentDelegate.hpp"
 #include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/ReadWriteConnectionProvider.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
 #include "persistence/repository/GroupRepository.hpp"
+#include "persistence/repository/MatchRepository.hpp"
+#include "persistence/repository/StandingRepository.hpp"
+#include "persistence/repository/AsyncGroupRepository.hpp"
+#include "persistence/repository/AsyncTournamentRepository.hpp"
+#include "persistence/async/PipelineQueryExecutor.hpp"
+#include "persistence/async/ReadWriteQueryExecutor.hpp"
 #include "cms/QueueMessageProducer.hpp"
 #include "cms/QueueResolver.hpp"
 #include "delegate/IGroupDelegate.hpp"
 #include "delegate/GroupDelegate.hpp"
 #include "controller/GroupController.hpp"
+#include "controller/MetricsController.hpp"
+#include "common/Compression.hpp"
+#include "common/ResponseCache.hpp"
 
 namespace config {
     inline std::shared_ptr<Hypodermic::Container> containerSetup() {
@@ -37,11 +48,39 @@ namespace config {
         std::shared_ptr<RunConfiguration> appConfig = std::make_shared<RunConfiguration>(configuration["runConfig"]);
         builder.registerInstance(appConfig);
 
-        std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(
-            configuration["databaseConfig"]["connectionString"].get<std::string>(),
-            configuration["databaseConfig"]["poolSize"].get<size_t>());
+        const auto databaseConfig = configuration["databaseConfig"].get<DatabaseConfiguration>();
+        std::shared_ptr<IDbConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(
+            databaseConfig.connectionString,
+            databaseConfig.pool);
+        if (databaseConfig.readConnectionString.has_value()) {
+            postgressConnection = std::make_shared<ReadWriteConnectionProvider>(
+                postgressConnection,
+                std::make_shared<PostgresConnectionProvider>(*databaseConfig.readConnectionString, databaseConfig.pool),
+                databaseConfig.readYourWritesWindow);
+        }
         builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
 
+        std::shared_ptr<IAsyncQueryExecutor> pipelineExecutor = std::make_shared<PipelineQueryExecutor>(
+            databaseConfig.connectionString,
+            databaseConfig.pipelineConnections,
+            databaseConfig.pool.statementTimeout);
+        if (databaseConfig.readConnectionString.has_value()) {
+            pipelineExecutor = std::make_shared<ReadWriteQueryExecutor>(
+                pipelineExecutor,
+                std::make_shared<PipelineQueryExecutor>(*databaseConfig.readConnectionString, databaseConfig.pipelineConnections, databaseConfig.pool.statementTimeout),
+                databaseConfig.readYourWritesWindow);
+        }
+        builder.registerInstance(pipelineExecutor).as<IAsyncQueryExecutor>();
+
+        const auto compression = std::make_shared<ResponseCompression>(appConfig->compressionMinBytes);
+        builder.registerInstance(compression);
+        // a replica may still serve the old row right after a write, fills wait out the read-your-writes window
+        builder.registerInstance(std::make_shared<ResponseCache>(
+            appConfig->responseCacheBytes,
+            databaseConfig.readConnectionString.has_value() ? databaseConfig.readYourWritesWindow : std::chrono::milliseconds{0},
+            *compression,
+            appConfig->responseCacheTtl));
+
         builder.registerType<ConnectionManager>()
             .onActivated([configuration](Hypodermic::ComponentContext&, const std::shared_ptr<ConnectionManager>& instance) {
                 instance->initialize(configuration["activemq"]["broker-url"].get<std::string>());
@@ -52,14 +91,20 @@ namespace config {
         builder.registerType<QueueResolver>().as<IResolver<IQueueMessageProducer> >().named("queueResolver").
                 singleInstance();
 
-        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string> >().singleInstance();
+        builder.registerType<TeamRepository>().as<ITeamRepository>().singleInstance();
         builder.registerType<GroupRepository>().as<IGroupRepository>().singleInstance();
+        builder.registerType<MatchRepository>().as<IMatchRepository>().singleInstance();
+        builder.registerType<StandingRepository>().as<IStandingRepository>().singleInstance();
+        builder.registerType<AsyncGroupRepository>().as<IAsyncGroupRepository>().singleInstance();
+        builder.registerType<AsyncTournamentRepository>().as<IAsyncRepository<domain::Tournament, domain::Uuid> >().singleInstance();
 
         builder.registerType<TeamDelegate>().as<ITeamDelegate>().singleInstance();
         builder.registerType<TeamController>().singleInstance();
 
-        builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, std::string> >().
-                singleInstance();
+        builder.registerType<TournamentRepository>()
+                .as<ITournamentRepository>()
+                .as<IRepository<domain::Tournament, domain::Uuid> >()
+                .singleInstance();
 
         builder.registerType<TournamentDelegate>()
                 .as<ITournamentDelegate>()
@@ -73,6 +118,8 @@ namespace config {
         builder.registerType<GroupDelegate>().as<IGroupDelegate>().singleInstance();
         builder.registerType<GroupController>().singleInstance();
 
+        builder.registerType<MetricsController>().singleInstance();
+
         return builder.build();
     }
 }
@@ -7,9 +7,26 @@
 
 #include <crow.h>
 #include <Hypodermic/Container.h>
+#include <charconv>
+#include <chrono>
+#include <format>
+#include <optional>
 #include <vector>
 #include <functional>
 #include <string>
+#include <tuple>
+#include <pqxx/pqxx>
+
+#include "common/Compression.hpp"
+#include "common/WireFormat.hpp"
+#include "configuration/RoutePath.hpp"
+#include "configuration/RunConfiguration.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/ReadYourWrites.hpp"
+#include "persistence/configuration/RequestArena.hpp"
+#include "persistence/configuration/RequestDeadline.hpp"
+#include "persistence/async/QueryResult.hpp"
+#include "persistence/async/Task.hpp"
 
 // Route definition storage
 struct RouteDefinition {
@@ -43,16 +60,224 @@ auto invokeController(Controller* controller, Method method, const crow::request
 
 }
 
-// Annotation-style macro
+// The pool gave up waiting for a free connection, tell the client to back off instead of hanging the worker.
+inline crow::response serviceUnavailable(const std::exception& e) {
+    crow::response response{crow::SERVICE_UNAVAILABLE, e.what()};
+    response.add_header("Retry-After", "1");
+    return response;
+}
+
+#define REQUEST_TIMEOUT_HEADER "X-Request-Timeout"
+
+// The configured budget, shortened by X-Request-Timeout (milliseconds) when the client gives up sooner.
+// The header cannot extend the budget. Empty when neither sets a timeout.
+inline std::optional<RequestDeadline::Clock::time_point> requestDeadline(const crow::request& request, std::chrono::milliseconds budget) {
+    const auto received = RequestDeadline::Clock::now();
+    std::optional<std::chrono::milliseconds> timeout;
+    if (budget.count() > 0) {
+        timeout = budget;
+    }
+
+    const std::string& header = request.get_header_value(REQUEST_TIMEOUT_HEADER);
+    std::chrono::milliseconds::rep millis = 0;
+    const auto [last, error] = std::from_chars(header.data(), header.data() + header.size(), millis);
+    if (!header.empty() && error == std::errc{} && last == header.data() + header.size() && millis > 0) {
+        timeout = std::min(timeout.value_or(std::chrono::milliseconds::max()), std::chrono::milliseconds(millis));
+    }
+
+    if (!timeout) {
+        return std::nullopt;
+    }
+    return received + *timeout;
+}
+
+#define READ_YOUR_WRITES_COOKIE "rw_pin"
+
+// When the client's last write stops pinning its reads to the primary, as handed out by pinClient.
+// Empty when the Cookie header has no such cookie or it does not hold milliseconds since the epoch.
+inline std::optional<ReadYourWrites::Clock::time_point> readYourWritesPin(const crow::request& request) {
+    constexpr std::string_view name = READ_YOUR_WRITES_COOKIE "=";
+    std::string_view cookies = request.get_header_value("Cookie");
+    while (!cookies.empty()) {
+        const auto separator = cookies.find(';');
+        std::string_view cookie = cookies.substr(0, separator);
+        cookies = separator == std::string_view::npos ? std::string_view{} : cookies.substr(separator + 1);
+        cookie.remove_prefix(std::min(cookie.find_first_not_of(' '), cookie.size()));
+        if (!cookie.starts_with(name)) {
+            continue;
+        }
+        cookie.remove_prefix(name.size());
+        std::chrono::milliseconds::rep millis = 0;
+        const auto [last, error] = std::from_chars(cookie.data(), cookie.data() + cookie.size(), millis);
+        if (error != std::errc{} || last != cookie.data() + cookie.size() || millis <= 0) {
+            return std::nullopt;
+        }
+        return ReadYourWrites::Clock::time_point(std::chrono::milliseconds(millis));
+    }
+    return std::nullopt;
+}
+
+// Hands the pin a write of this request took to the client, so the reads of its next requests stay on the
+// primary until the replicas have caught up. The cookie expires with the pin.
+inline void pinClient(crow::response& response, const ReadYourWrites& readYourWrites) {
+    const auto until = readYourWrites.PinnedUntil();
+    if (!readYourWrites.Wrote() || !until) {
+        return;
+    }
+    const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(until->time_since_epoch()).count();
+    const auto maxAge = std::max<std::chrono::seconds::rep>(std::chrono::ceil<std::chrono::seconds>(*until - ReadYourWrites::Clock::now()).count(), 1);
+    response.add_header("Set-Cookie", std::format("{}={}; Max-Age={}; Path=/; HttpOnly; SameSite=Lax", READ_YOUR_WRITES_COOKIE, millis, maxAge));
+}
+
+// The request ran out of time waiting on the database.
+inline crow::response gatewayTimeout(const std::exception& e) {
+    return crow::response{crow::GATEWAY_TIMEOUT, e.what()};
+}
+
+// True for a statement cancelled by statement_timeout or the deadline watchdog, and for anything that
+// failed once the deadline had already passed.
+inline bool deadlineExceeded(const std::exception& e) {
+    if (dynamic_cast<const DeadlineExceededException*>(&e) != nullptr || RequestDeadline::Expired()) {
+        return true;
+    }
+    const auto* sqlError = dynamic_cast<const pqxx::sql_error*>(&e);
+    return sqlError != nullptr && sqlError->sqlstate() == "57014";
+}
+
+// Every response leaves in the format Accept asks for, then compressed as Accept-Encoding allows.
+inline void finishResponse(const crow::request& request, crow::response& response, const ResponseCompression& compression) {
+    encodeResponse(request, response);
+    compression.Apply(request, response);
+}
+
+// A path parameter declared <uuid> that is not one never reaches the controller, controllers take the
+// ids of their path as valid.
+inline crow::response invalidPathParameter() {
+    return crow::response{crow::BAD_REQUEST, std::string(domain::INVALID_ID_MESSAGE)};
+}
+
+// Annotation-style macro. Path parameters are declared with Crow's placeholders plus <uuid>, which the method
+// takes as a domain::Uuid parsed before it runs. The controller is resolved once when the route is bound and
+// every request goes straight to its method. Controllers read the request body as JSON whatever format it came
+// in. What the request allocates from its arena is released in one go once the response is finished. A client
+// that wrote gets a cookie keeping its next reads on the primary.
 #define REGISTER_ROUTE(Controller, Method, Path, HttpMethod) \
 struct Controller## _##Method##_RouteRegistrator { \
+    using Route = RoutePath<Path>; \
+    static_assert(Route::Accepts<Controller, decltype(&Controller::Method)>, \
+        #Controller "::" #Method " does not take the parameters of " Path); \
+    Controller##_##Method##_RouteRegistrator() { \
+        routeRegistry().push_back({ Route::crow.value, HttpMethod, \
+            [](crow::SimpleApp& app, const std::shared_ptr<Hypodermic::Container>& container) { \
+                    const auto requestTimeout = container->resolve<config::RunConfiguration>()->requestTimeout; \
+                    const auto compression = container->resolve<ResponseCompression>(); \
+                    const auto controller = container->resolve<Controller>(); \
+                    CROW_ROUTE(app, Route::crow.value).methods(HttpMethod)( \
+                        [controller, requestTimeout, compression](const crow::request& request ,auto&&... args) { \
+                        auto arguments = Route::Parse(std::forward<decltype(args)>(args)...); \
+                        if (!arguments) { \
+                            return invalidPathParameter(); \
+                        } \
+                        ReadYourWrites readYourWrites(readYourWritesPin(request)); \
+                        ReadYourWrites::Scope readYourWritesScope(&readYourWrites); \
+                        RequestDeadline::Scope deadline(requestDeadline(request, requestTimeout)); \
+                        RequestArena arena; \
+                        RequestArena::Scope arenaScope(&arena); \
+                        auto decoded = jsonRequest(request); \
+                        if (!decoded) { \
+                            return std::move(decoded.error()); \
+                        } \
+                        try { \
+                            crow::response response = std::apply([&](auto&... parsed) { \
+                                return invokeController(controller.get(), &Controller::Method, *decoded ? **decoded : request, parsed...); \
+                            }, *arguments); \
+                            finishResponse(request, response, *compression); \
+                            pinClient(response, readYourWrites); \
+                            return response; \
+                        } catch (const ConnectionUnavailableException& e) { \
+                            return serviceUnavailable(e); \
+                        } catch (const std::exception& e) { \
+                            if (deadlineExceeded(e)) { \
+                                return gatewayTimeout(e); \
+                            } \
+                            throw; \
+                        } \
+                    } \
+                ); \
+            } \
+        }); \
+    } \
+}; \
+static Controller##_##Method##_RouteRegistrator global_##Controller##_##Method##_registrator;
+
+// Finishes a response whose controller coroutine failed, a lost pipeline connection reads as unavailable.
+inline crow::response asyncFailure(std::exception_ptr error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (const ConnectionUnavailableException& e) {
+        return serviceUnavailable(e);
+    } catch (const DeadlineExceededException& e) {
+        return gatewayTimeout(e);
+    } catch (const QueryException& e) {
+        if (e.sqlState.starts_with("08")) {
+            return serviceUnavailable(e);
+        }
+        if (e.sqlState == "57014") {
+            return gatewayTimeout(e);
+        }
+        return crow::response{crow::INTERNAL_SERVER_ERROR, e.what()};
+    } catch (const std::exception& e) {
+        return crow::response{crow::INTERNAL_SERVER_ERROR, e.what()};
+    }
+}
+
+// For controller methods returning Task<crow::response>. The worker thread returns as soon as the
+// coroutine suspends and the response is ended from wherever it resumes. Route arguments are copied
+// into the coroutine, so such methods take them by value. The request deadline, arena and read-your-writes
+// state ride along with each query the coroutine awaits, the callbacks hold them until the coroutine frames are gone.
+#define REGISTER_ASYNC_ROUTE(Controller, Method, Path, HttpMethod) \
+struct Controller## _##Method##_RouteRegistrator { \
+    using Route = RoutePath<Path>; \
+    static_assert(Route::Accepts<Controller, decltype(&Controller::Method)>, \
+        #Controller "::" #Method " does not take the parameters of " Path); \
     Controller##_##Method##_RouteRegistrator() { \
-        routeRegistry().push_back({ Path, HttpMethod, \
+        routeRegistry().push_back({ Route::crow.value, HttpMethod, \
             [](crow::SimpleApp& app, const std::shared_ptr<Hypodermic::Container>& container) { \
-                    CROW_ROUTE(app, Path).methods(HttpMethod)( \
-                        [container](const crow::request& request ,auto&&... args) { \
-                        auto controller = container->resolve<Controller>(); \
-                        return invokeController(controller.get(), &Controller::Method, request, std::forward<decltype(args)>(args)...); \
+                    const auto requestTimeout = container->resolve<config::RunConfiguration>()->requestTimeout; \
+                    const auto compression = container->resolve<ResponseCompression>(); \
+                    const auto controller = container->resolve<Controller>(); \
+                    CROW_ROUTE(app, Route::crow.value).methods(HttpMethod)( \
+                        [controller, requestTimeout, compression](const crow::request& request, crow::response& response, auto&&... args) { \
+                        auto arguments = Route::Parse(std::forward<decltype(args)>(args)...); \
+                        if (!arguments) { \
+                            response = invalidPathParameter(); \
+                            response.end(); \
+                            return; \
+                        } \
+                        auto readYourWrites = std::make_shared<ReadYourWrites>(readYourWritesPin(request)); \
+                        ReadYourWrites::Scope readYourWritesScope(readYourWrites.get()); \
+                        RequestDeadline::Scope deadline(requestDeadline(request, requestTimeout)); \
+                        auto arena = std::make_shared<RequestArena>(); \
+                        RequestArena::Scope arenaScope(arena.get()); \
+                        auto decoded = jsonRequest(request); \
+                        if (!decoded) { \
+                            response = std::move(decoded.error()); \
+                            response.end(); \
+                            return; \
+                        } \
+                        Spawn(std::apply([&](auto&... parsed) { \
+                                return invokeController(controller.get(), &Controller::Method, *decoded ? **decoded : request, parsed...); \
+                            }, *arguments), \
+                            [&request, &response, controller, compression, decoded = *decoded, arena, readYourWrites](crow::response result) { \
+                                response = std::move(result); \
+                                finishResponse(request, response, *compression); \
+                                pinClient(response, *readYourWrites); \
+                                response.end(); \
+                            }, \
+                            [&response, controller, arena, readYourWrites](std::exception_ptr error) { \
+                                response = asyncFailure(error); \
+                                response.end(); \
+                            }); \
                     } \
                 ); \
             } \
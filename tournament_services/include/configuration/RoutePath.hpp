@@ -0,0 +1,187 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_ROUTEPATH_HPP
+#define TOURNAMENTS_ROUTEPATH_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <crow.h>
+
+#include "domain/Uuid.hpp"
+
+// What a path placeholder holds. Uuid is ours, it reaches Crow as <string> and the controller as domain::Uuid,
+// the rest are Crow's own.
+enum class PathParameter { Uuid, String, Int, UInt, Double, Path };
+
+namespace detail {
+    template<std::size_t N>
+    struct PathLiteral {
+        char text[N]{};
+
+        consteval PathLiteral(const char (&path)[N]) {
+            std::copy_n(path, N, text);
+        }
+
+        [[nodiscard]] constexpr std::string_view View() const {
+            return {text, N - 1};
+        }
+    };
+
+    struct PathToken {
+        std::string_view declared;
+        std::string_view crow;
+        PathParameter parameter;
+    };
+
+    inline constexpr std::array<PathToken, 8> PATH_TOKENS{{
+        {"<uuid>", "<string>", PathParameter::Uuid},
+        {"<string>", "<string>", PathParameter::String},
+        {"<str>", "<str>", PathParameter::String},
+        {"<int>", "<int>", PathParameter::Int},
+        {"<uint>", "<uint>", PathParameter::UInt},
+        {"<double>", "<double>", PathParameter::Double},
+        {"<float>", "<float>", PathParameter::Double},
+        {"<path>", "<path>", PathParameter::Path},
+    }};
+
+    // Not constexpr, reaching it while a route path is parsed at compile time fails the build.
+    inline void unknownPathParameter() {}
+
+    // Hands each character outside a placeholder to onText and each placeholder to onParameter.
+    template<typename OnText, typename OnParameter>
+    constexpr void scanPath(std::string_view path, OnText onText, OnParameter onParameter) {
+        for (std::size_t i = 0; i < path.size();) {
+            if (path[i] != '<') {
+                onText(path[i++]);
+                continue;
+            }
+            const auto end = path.find('>', i);
+            const std::string_view token = path.substr(i, end == std::string_view::npos ? std::string_view::npos : end - i + 1);
+            const auto* known = std::ranges::find(PATH_TOKENS, token, &PathToken::declared);
+            if (known == PATH_TOKENS.end()) {
+                unknownPathParameter();
+                return;
+            }
+            onParameter(*known);
+            i += token.size();
+        }
+    }
+
+    template<PathParameter parameter>
+    struct PathArgument { using type = std::string; };
+    template<>
+    struct PathArgument<PathParameter::Uuid> { using type = domain::Uuid; };
+    template<>
+    struct PathArgument<PathParameter::Int> { using type = std::int64_t; };
+    template<>
+    struct PathArgument<PathParameter::UInt> { using type = std::uint64_t; };
+    template<>
+    struct PathArgument<PathParameter::Double> { using type = double; };
+
+    // What the controller is given for an argument Crow extracted, empty when it is malformed. Only <uuid>
+    // ones can be, the rest Crow already converted.
+    template<PathParameter parameter, typename T>
+    auto parsePathArgument(T&& argument) {
+        if constexpr (parameter == PathParameter::Uuid) {
+            return domain::Uuid::Parse(argument);
+        } else {
+            return std::optional<std::decay_t<T>>(std::forward<T>(argument));
+        }
+    }
+}
+
+// A route path as REGISTER_ROUTE declares it, parsed at compile time into the path Crow matches and the
+// kind of each parameter. Placeholders Crow does not know fail the build, and so does a controller method
+// that cannot take the parameters.
+template<detail::PathLiteral declared>
+struct RoutePath {
+private:
+    static constexpr std::size_t crowSize = [] {
+        std::size_t size = 1;
+        detail::scanPath(declared.View(), [&](char) { ++size; }, [&](const detail::PathToken& token) { size += token.crow.size(); });
+        return size;
+    }();
+
+    static constexpr std::size_t parameterCount = [] {
+        std::size_t count = 0;
+        detail::scanPath(declared.View(), [](char) {}, [&](const detail::PathToken&) { ++count; });
+        return count;
+    }();
+
+public:
+    struct Text {
+        char value[crowSize]{};
+    };
+
+    // the path in Crow's syntax, what CROW_ROUTE is given
+    static constexpr Text crow = [] {
+        Text text;
+        std::size_t i = 0;
+        detail::scanPath(declared.View(), [&](char c) { text.value[i++] = c; }, [&](const detail::PathToken& token) {
+            for (const char c : token.crow) {
+                text.value[i++] = c;
+            }
+        });
+        return text;
+    }();
+
+    static constexpr std::array<PathParameter, parameterCount> parameters = [] {
+        std::array<PathParameter, parameterCount> kinds{};
+        std::size_t i = 0;
+        detail::scanPath(declared.View(), [](char) {}, [&](const detail::PathToken& token) { kinds[i++] = token.parameter; });
+        return kinds;
+    }();
+
+private:
+    template<std::size_t... I>
+    static auto argumentTypes(std::index_sequence<I...>) -> std::tuple<typename detail::PathArgument<parameters[I]>::type...>;
+
+    template<typename Controller, typename Method, typename... Values>
+    static constexpr bool accepts(std::tuple<Values...>*) {
+        return std::is_invocable_v<Method, Controller*>
+            || std::is_invocable_v<Method, Controller*, Values...>
+            || std::is_invocable_v<Method, Controller*, const crow::request&>
+            || std::is_invocable_v<Method, Controller*, const crow::request&, Values...>;
+    }
+
+    template<std::size_t... I, typename... Values>
+    static auto parse(std::index_sequence<I...>, Values&&... values) {
+        auto arguments = std::make_tuple(detail::parsePathArgument<parameters[I]>(std::forward<Values>(values))...);
+        using Parsed = std::tuple<typename std::tuple_element_t<I, decltype(arguments)>::value_type...>;
+        if (!(std::get<I>(arguments).has_value() && ...)) {
+            return std::optional<Parsed>();
+        }
+        return std::optional<Parsed>(std::in_place, std::move(*std::get<I>(arguments))...);
+    }
+
+public:
+    using Arguments = decltype(argumentTypes(std::make_index_sequence<parameterCount>{}));
+
+    // True when Method can be invoked the way invokeController does with this path's parameters.
+    template<typename Controller, typename Method>
+    static constexpr bool Accepts = accepts<Controller, Method>(static_cast<Arguments*>(nullptr));
+
+    // The arguments Crow extracted as the controller takes them, each <uuid> parsed once into a domain::Uuid.
+    // Empty when one is not well formed. Calls with another arity do not match this route, their arguments
+    // pass through as they are and are left to invokeController.
+    template<typename... Values>
+    static auto Parse(Values&&... values) {
+        if constexpr (sizeof...(Values) == parameterCount) {
+            return parse(std::index_sequence_for<Values...>{}, std::forward<Values>(values)...);
+        } else {
+            return std::optional<std::tuple<std::decay_t<Values>...>>(std::in_place, std::forward<Values>(values)...);
+        }
+    }
+};
+
+#endif //TOURNAMENTS_ROUTEPATH_HPP
@@ -1,16 +1,30 @@
 #ifndef TOURNAMENTS_APPLICATION_PROPERTIES_HPP
 #define TOURNAMENTS_APPLICATION_PROPERTIES_HPP
+#include <chrono>
+#include <cstddef>
 #include <nlohmann/json.hpp>
 
 namespace config{
     struct RunConfiguration{
         int port;
         int concurrency;
+        // time every request has to be answered in, 0 leaves requests without a deadline
+        std::chrono::milliseconds requestTimeout{0};
+        // memory the serialized GET responses may take, 0 turns the cache off
+        std::size_t responseCacheBytes{0};
+        // how long a cached response is served, bounds staleness from writes made by other instances
+        std::chrono::milliseconds responseCacheTtl{30000};
+        // smallest body sent compressed when the client accepts it, 0 sends every body as is
+        std::size_t compressionMinBytes{0};
     };
 
     inline void from_json(const nlohmann::json& json, RunConfiguration& applicationProperties) {
         json.at("port").get_to(applicationProperties.port);
         json.at("concurrency").get_to(applicationProperties.concurrency);
+        applicationProperties.requestTimeout = std::chrono::milliseconds(json.value("requestTimeoutMs", 0));
+        applicationProperties.responseCacheBytes = json.value("responseCacheBytes", std::size_t{0});
+        applicationProperties.responseCacheTtl = std::chrono::milliseconds(json.value("responseCacheTtlMs", applicationProperties.responseCacheTtl.count()));
+        applicationProperties.compressionMinBytes = json.value("compressionMinBytes", std::size_t{0});
     }
 }
 #endif
@@ -12,6 +12,7 @@
 
 #include "configuration/RouteDefinition.hpp"
 #include "delegate/IGroupDelegate.hpp"
+#include "common/ResponseCache.hpp"
 #include "domain/Group.hpp"
 #include "domain/Utilities.hpp"
 
@@ -20,28 +21,29 @@ class IGroupDelegate;
 
 class GroupController {
     std::shared_ptr<IGroupDelegate> groupDelegate;
+    std::shared_ptr<ResponseCache> responseCache;
 
 public:
     // El constructor toma la interfaz, lo que facilita la inyección de dependencias.
-    explicit GroupController(std::shared_ptr<IGroupDelegate> delegate);
+    GroupController(std::shared_ptr<IGroupDelegate> delegate, std::shared_ptr<ResponseCache> responseCache);
 
     // --- GET /tournaments/{id}/groups ---
-    [[nodiscard]] crow::response GetGroups(const std::string& tournamentId) const;
+    [[nodiscard]] Task<crow::response> GetGroups(const crow::request& request, domain::Uuid tournamentId) const;
 
     // --- GET /tournaments/{id}/groups/{id} ---
-    [[nodiscard]] crow::response GetGroup(const std::string& tournamentId, const std::string& groupId) const;
+    [[nodiscard]] Task<crow::response> GetGroup(const crow::request& request, domain::Uuid tournamentId, domain::Uuid groupId) const;
 
     // --- POST /tournaments/{id}/groups ---
-    [[nodiscard]] crow::response CreateGroup(const crow::request& req, const std::string& tournamentId) const;
+    [[nodiscard]] crow::response CreateGroup(const crow::request& req, const domain::Uuid& tournamentId) const;
 
     // --- POST /tournaments/{id}/groups/{id}/teams ---
-    [[nodiscard]] crow::response AddTeamToGroup(const crow::request& req, const std::string& tournamentId, const std::string& groupId) const;
+    [[nodiscard]] crow::response AddTeamToGroup(const crow::request& req, const domain::Uuid& tournamentId, const domain::Uuid& groupId) const;
 
     // --- PATCH /tournaments/{id}/groups/{id} ---
-    [[nodiscard]] crow::response UpdateGroupName(const crow::request& req, const std::string& tournamentId, const std::string& groupId) const;
+    [[nodiscard]] crow::response UpdateGroupName(const crow::request& req, const domain::Uuid& tournamentId, const domain::Uuid& groupId) const;
 
     // --- DELETE /tournaments/{id}/groups/{id} ---
-    [[nodiscard]] crow::response DeleteGroup(const std::string& tournamentId, const std::string& groupId) const;
+    [[nodiscard]] crow::response DeleteGroup(const domain::Uuid& tournamentId, const domain::Uuid& groupId) const;
 };
 
 #endif // SERVICE_GROUP_CONTROLLER_HPP
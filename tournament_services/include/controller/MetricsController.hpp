@@ -0,0 +1,28 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef SERVICE_METRICS_CONTROLLER_HPP
+#define SERVICE_METRICS_CONTROLLER_HPP
+
+#include <memory>
+#include <crow.h>
+
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+
+class MetricsController {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+public:
+    explicit MetricsController(std::shared_ptr<IDbConnectionProvider> connectionProvider);
+
+    // --- GET /metrics/db-pool ---
+    [[nodiscard]] crow::response GetPoolMetrics() const;
+
+    // --- GET /metrics/statements ---
+    [[nodiscard]] crow::response GetStatementMetrics() const;
+
+    // --- GET /metrics/request-memory ---
+    [[nodiscard]] crow::response GetRequestMemoryMetrics() const;
+};
+
+#endif //SERVICE_METRICS_CONTROLLER_HPP
@@ -9,21 +9,23 @@
 #include <crow.h>
 #include <nlohmann/json.hpp>
 #include <memory>
-#include <regex>
 
 #include "delegate/ITeamDelegate.hpp"
-#include "common/Constants.hpp"
+#include "common/ResponseCache.hpp"
 
 class TeamController {
     std::shared_ptr<ITeamDelegate> teamDelegate;
+    std::shared_ptr<ResponseCache> responseCache;
 public:
-    explicit TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate);
+    TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate, std::shared_ptr<ResponseCache> responseCache);
 
-    [[nodiscard]] crow::response getTeam(const std::string& teamId) const;
-    [[nodiscard]] crow::response getAllTeams() const;
+    [[nodiscard]] crow::response getTeam(const crow::request& request, const domain::Uuid& teamId) const;
+    [[nodiscard]] crow::response getAllTeams(const crow::request& request) const;
     [[nodiscard]] crow::response SaveTeam(const crow::request& request) const;
-    [[nodiscard]] crow::response UpdateTeam(const crow::request& request, const std::string& teamId) const;
-    [[nodiscard]] crow::response DeleteTeam(const std::string& teamId) const;
+    // --- POST /teams:bulk, a JSON array or NDJSON (application/x-ndjson) of teams ---
+    [[nodiscard]] crow::response ImportTeams(const crow::request& request) const;
+    [[nodiscard]] crow::response UpdateTeam(const crow::request& request, const domain::Uuid& teamId) const;
+    [[nodiscard]] crow::response DeleteTeam(const domain::Uuid& teamId) const;
 };
 
 
@@ -9,17 +9,19 @@
 #include <crow.h>
 
 #include "delegate/ITournamentDelegate.hpp"
-#include "common/Constants.hpp"
+#include "common/ResponseCache.hpp"
 
 class TournamentController {
     std::shared_ptr<ITournamentDelegate> tournamentDelegate;
+    std::shared_ptr<ResponseCache> responseCache;
 public:
-    explicit TournamentController(std::shared_ptr<ITournamentDelegate> tournament);
+    TournamentController(std::shared_ptr<ITournamentDelegate> tournament, std::shared_ptr<ResponseCache> responseCache);
     [[nodiscard]] crow::response CreateTournament(const crow::request &request) const;
     [[nodiscard]] crow::response UpdateTournament(const crow::request &request) const;
-    [[nodiscard]] crow::response GetTournament(const std::string& tournamentId) const;
-    [[nodiscard]] crow::response DeleteTournament(const std::string& tournamentId) const;
-    [[nodiscard]] crow::response ReadAll() const;
+    [[nodiscard]] crow::response GetTournament(const crow::request& request, const domain::Uuid& tournamentId) const;
+    [[nodiscard]] crow::response DeleteTournament(const domain::Uuid& tournamentId) const;
+    [[nodiscard]] crow::response ReadAll(const crow::request &request) const;
+    [[nodiscard]] crow::response GetStandings(const domain::Uuid& tournamentId) const;
 };
 
 
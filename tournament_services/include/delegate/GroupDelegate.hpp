@@ -3,36 +3,47 @@
 
 #include "delegate/IGroupDelegate.hpp"
 #include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITeamRepository.hpp"
+#include "persistence/repository/IAsyncGroupRepository.hpp"
 #include "domain/Tournament.hpp"
 #include "domain/Team.hpp"
+#include "common/ResponseCache.hpp"
 #include <memory>
 
 class IGroupRepository;
 class IQueueMessageProducer;
 
 class GroupDelegate : public IGroupDelegate {
-    std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepository;
+    std::shared_ptr<IRepository<domain::Tournament, domain::Uuid>> tournamentRepository;
     std::shared_ptr<IGroupRepository> groupRepository;
-    std::shared_ptr<IRepository<domain::Team, std::string>> teamRepository;
+    std::shared_ptr<ITeamRepository> teamRepository;
     std::shared_ptr<IQueueMessageProducer> producer;
+    // reads go through the pipeline and never hold a worker thread while the database answers
+    std::shared_ptr<IAsyncRepository<domain::Tournament, domain::Uuid>> asyncTournamentRepository;
+    std::shared_ptr<IAsyncGroupRepository> asyncGroupRepository;
+    std::shared_ptr<ResponseCache> responseCache;
 
     static constexpr int MAX_GROUPS_PER_TOURNAMENT = 8;
     static constexpr int MAX_TEAMS_PER_GROUP = 4;
 
-    void checkAndPublishTournamentReadyEvent(std::string_view tournamentId);
+    void checkAndPublishTournamentReadyEvent(const domain::Uuid& tournamentId);
 
 public:
-    GroupDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepo,
+    GroupDelegate(std::shared_ptr<IRepository<domain::Tournament, domain::Uuid>> tournamentRepo,
                   std::shared_ptr<IGroupRepository> groupRepo,
-                  std::shared_ptr<IRepository<domain::Team, std::string>> teamRepo,
-                  std::shared_ptr<IQueueMessageProducer> producer);
-
-    std::expected<std::vector<domain::Group>, std::string> GetGroups(std::string tournamentId) override;
-    std::expected<domain::Group, std::string> GetGroup(std::string tournamentId, std::string_view groupId) override;
-    std::expected<std::string, std::string> CreateGroup(std::string tournamentId, domain::Group& group) override;
-    std::expected<void, std::string> AddTeamToGroup(std::string_view tournamentId, std::string_view groupId, const domain::Team& team) override;
-    std::expected<void, std::string> UpdateGroupName(std::string_view tournamentId, std::string_view groupId, const domain::Group& groupUpdatePayload) override;
-    std::expected<void, std::string> DeleteGroup(std::string_view tournamentId, std::string groupId) override;
+                  std::shared_ptr<ITeamRepository> teamRepo,
+                  std::shared_ptr<IQueueMessageProducer> producer,
+                  std::shared_ptr<IAsyncRepository<domain::Tournament, domain::Uuid>> asyncTournamentRepo,
+                  std::shared_ptr<IAsyncGroupRepository> asyncGroupRepo,
+                  std::shared_ptr<ResponseCache> responseCache);
+
+    Task<std::expected<std::string, std::string>> GetGroups(domain::Uuid tournamentId) override;
+    Task<std::expected<domain::Group, std::string>> GetGroup(domain::Uuid tournamentId, domain::Uuid groupId) override;
+    Task<std::optional<std::int64_t>> GetGroupVersion(domain::Uuid tournamentId, domain::Uuid groupId) override;
+    std::expected<domain::Uuid, std::string> CreateGroup(const domain::Uuid& tournamentId, domain::Group& group) override;
+    std::expected<void, std::string> AddTeamToGroup(const domain::Uuid& tournamentId, const domain::Uuid& groupId, const domain::Team& team) override;
+    std::expected<void, std::string> UpdateGroupName(const domain::Uuid& tournamentId, const domain::Uuid& groupId, const domain::Group& groupUpdatePayload) override;
+    std::expected<void, std::string> DeleteGroup(const domain::Uuid& tournamentId, const domain::Uuid& groupId) override;
 };
 
 #endif // SERVICE_GROUP_DELEGATE_HPP
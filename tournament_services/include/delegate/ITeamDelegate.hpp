@@ -1,20 +1,31 @@
 #ifndef ITEAM_DELEGATE_HPP
 #define ITEAM_DELEGATE_HPP
 
+#include <cstdint>
 #include <string_view>
 #include <memory>
 #include <expected>
+#include <functional>
+#include <optional>
+#include <vector>
 
 #include "domain/Team.hpp"
+#include "domain/Uuid.hpp"
+#include "persistence/repository/ITeamRepository.hpp"
 
 class ITeamDelegate {
     public:
     virtual ~ITeamDelegate() = default;
-    virtual std::shared_ptr<domain::Team> GetTeam(std::string id) = 0;
+    virtual std::shared_ptr<domain::Team> GetTeam(const domain::Uuid& id) = 0;
+    // Version probe for conditional GETs, empty when the team does not exist.
+    virtual std::optional<std::int64_t> GetTeamVersion(const domain::Uuid& id) = 0;
     virtual std::vector<std::shared_ptr<domain::Team>> GetAllTeams() = 0;
-    virtual std::expected<std::string, std::string> SaveTeam(const domain::Team& team) = 0;
-    virtual std::expected<std::string, std::string> UpdateTeam(const std::string& teamId, const domain::Team& team) = 0;
-    virtual std::expected<void, std::string> DeleteTeam(const std::string& teamId) = 0;
+    virtual std::vector<std::shared_ptr<domain::Team>> GetTeamsPage(const std::optional<domain::Uuid>& after, std::size_t limit) = 0;
+    virtual bool ExportTeams(const std::function<void(std::string_view)>& writeRow, std::size_t limit) = 0;
+    virtual std::expected<domain::Uuid, std::string> SaveTeam(const domain::Team& team) = 0;
+    virtual BulkImportResult ImportTeams(const std::vector<domain::Team>& teams) = 0;
+    virtual std::expected<domain::Uuid, std::string> UpdateTeam(const domain::Uuid& teamId, const domain::Team& team) = 0;
+    virtual std::expected<void, std::string> DeleteTeam(const domain::Uuid& teamId) = 0;
 };
 
 #endif /* ITEAM_DELEGATE_HPP */
@@ -5,21 +5,32 @@
 #ifndef TOURNAMENTS_ITOURNAMENTDELEGATE_HPP
 #define TOURNAMENTS_ITOURNAMENTDELEGATE_HPP
 
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <expected>
+#include <functional>
+#include <optional>
+#include <vector>
 
 #include "domain/Tournament.hpp"
+#include "domain/Standing.hpp"
+#include "domain/Uuid.hpp"
 
 class ITournamentDelegate
 {
 public:
     virtual ~ITournamentDelegate() = default;
-    virtual std::expected<std::string, std::string> CreateTournament(std::shared_ptr<domain::Tournament> tournament) = 0;
-    virtual std::expected<std::string, std::string> UpdateTournament(std::shared_ptr<domain::Tournament> tournament) = 0;
-    virtual std::expected<void, std::string> DeleteTournament(const std::string &tournamentId) = 0;
-    virtual std::shared_ptr<domain::Tournament> GetTournament(std::string_view id) = 0;
+    virtual std::expected<domain::Uuid, std::string> CreateTournament(std::shared_ptr<domain::Tournament> tournament) = 0;
+    virtual std::expected<domain::Uuid, std::string> UpdateTournament(std::shared_ptr<domain::Tournament> tournament) = 0;
+    virtual std::expected<void, std::string> DeleteTournament(const domain::Uuid &tournamentId) = 0;
+    virtual std::shared_ptr<domain::Tournament> GetTournament(const domain::Uuid& id) = 0;
+    // Version probe for conditional GETs, empty when the tournament does not exist.
+    virtual std::optional<std::int64_t> GetTournamentVersion(const domain::Uuid& id) = 0;
     virtual std::vector<std::shared_ptr<domain::Tournament>> ReadAll() = 0;
+    virtual std::vector<std::shared_ptr<domain::Tournament>> ReadPage(const std::optional<domain::Uuid>& after, std::size_t limit) = 0;
+    virtual bool ExportAll(const std::function<void(std::string_view)>& writeRow, std::size_t limit) = 0;
+    virtual std::expected<std::vector<domain::Standing>, std::string> GetStandings(const domain::Uuid& tournamentId) = 0;
 };
 
 #endif // TOURNAMENTS_ITOURNAMENTDELEGATE_HPP
\ No newline at end of file
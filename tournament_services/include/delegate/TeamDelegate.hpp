@@ -9,16 +9,22 @@
 #include "persistence/repository/TeamRepository.hpp" // why not just use the TeamRepository
 #include "domain/Team.hpp"
 #include "ITeamDelegate.hpp"
+#include "common/ResponseCache.hpp"
 
 class TeamDelegate : public ITeamDelegate {
-    std::shared_ptr<IRepository<domain::Team, std::string>> teamRepository;
+    std::shared_ptr<ITeamRepository> teamRepository;
+    std::shared_ptr<ResponseCache> responseCache;
     public:
-    explicit TeamDelegate(std::shared_ptr<IRepository<domain::Team, std::string>> repository);
-    std::shared_ptr<domain::Team> GetTeam(std::string id) override;
+    TeamDelegate(std::shared_ptr<ITeamRepository> repository, std::shared_ptr<ResponseCache> responseCache);
+    std::shared_ptr<domain::Team> GetTeam(const domain::Uuid& id) override;
+    std::optional<std::int64_t> GetTeamVersion(const domain::Uuid& id) override;
     std::vector<std::shared_ptr<domain::Team>> GetAllTeams() override;
-    std::expected<std::string, std::string> SaveTeam( const domain::Team& team) override;
-    std::expected<std::string, std::string> UpdateTeam(const std::string& teamId, const domain::Team& team) override;
-    std::expected<void, std::string> DeleteTeam(const std::string& teamId) override;
+    std::vector<std::shared_ptr<domain::Team>> GetTeamsPage(const std::optional<domain::Uuid>& after, std::size_t limit) override;
+    bool ExportTeams(const std::function<void(std::string_view)>& writeRow, std::size_t limit) override;
+    std::expected<domain::Uuid, std::string> SaveTeam( const domain::Team& team) override;
+    BulkImportResult ImportTeams(const std::vector<domain::Team>& teams) override;
+    std::expected<domain::Uuid, std::string> UpdateTeam(const domain::Uuid& teamId, const domain::Team& team) override;
+    std::expected<void, std::string> DeleteTeam(const domain::Uuid& teamId) override;
 };
 
 
@@ -9,22 +9,30 @@
 #include <expected>
 
 #include "cms/QueueMessageProducer.hpp"
+#include "common/ResponseCache.hpp"
 #include "delegate/ITournamentDelegate.hpp"
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITournamentRepository.hpp"
+#include "persistence/repository/IStandingRepository.hpp"
 
 class TournamentDelegate : public ITournamentDelegate
 {
-    std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepository;
+    std::shared_ptr<ITournamentRepository> tournamentRepository;
     std::shared_ptr<IQueueMessageProducer> producer;
+    std::shared_ptr<IStandingRepository> standingRepository;
+    std::shared_ptr<ResponseCache> responseCache;
 
 public:
-    explicit TournamentDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string>> repository, std::shared_ptr<IQueueMessageProducer> producer);
+    TournamentDelegate(std::shared_ptr<ITournamentRepository> repository, std::shared_ptr<IQueueMessageProducer> producer, std::shared_ptr<IStandingRepository> standingRepository, std::shared_ptr<ResponseCache> responseCache);
 
-    std::expected<std::string, std::string> CreateTournament(std::shared_ptr<domain::Tournament> tournament) override;
-    std::expected<std::string, std::string> UpdateTournament(std::shared_ptr<domain::Tournament> tournament) override;
-    std::shared_ptr<domain::Tournament> GetTournament(std::string_view id) override;
-    std::expected<void, std::string> DeleteTournament(const std::string &teamId) override;
+    std::expected<domain::Uuid, std::string> CreateTournament(std::shared_ptr<domain::Tournament> tournament) override;
+    std::expected<domain::Uuid, std::string> UpdateTournament(std::shared_ptr<domain::Tournament> tournament) override;
+    std::shared_ptr<domain::Tournament> GetTournament(const domain::Uuid& id) override;
+    std::optional<std::int64_t> GetTournamentVersion(const domain::Uuid& id) override;
+    std::expected<void, std::string> DeleteTournament(const domain::Uuid &tournamentId) override;
     std::vector<std::shared_ptr<domain::Tournament>> ReadAll() override;
+    std::vector<std::shared_ptr<domain::Tournament>> ReadPage(const std::optional<domain::Uuid>& after, std::size_t limit) override;
+    bool ExportAll(const std::function<void(std::string_view)>& writeRow, std::size_t limit) override;
+    std::expected<std::vector<domain::Standing>, std::string> GetStandings(const domain::Uuid& tournamentId) override;
 };
 
 #endif // TOURNAMENTS_TOURNAMENTDELEGATE_HPP
\ No newline at end of file
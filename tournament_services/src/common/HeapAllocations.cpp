@@ -0,0 +1,70 @@
+//
+// Created by root on 10/16/26.
+//
+
+#include <cstdlib>
+#include <new>
+
+#include "persistence/configuration/RequestArena.hpp"
+
+// Replaces the global operator new of the service so GET /metrics/request-memory reports the heap
+// allocations requests really make, not only what they take from their arenas. Linked only into
+// executables built with COUNT_HEAP_ALLOCATIONS, the tests run on the standard allocator.
+
+void* operator new(std::size_t size) {
+    RequestArena::CountHeapAllocation();
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+// new_delete_resource takes these only for over-aligned requests, whatever else asks for them is counted too
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    RequestArena::CountHeapAllocation();
+    const auto align = static_cast<std::size_t>(alignment);
+    if (void* memory = std::aligned_alloc(align, (size + align - 1) / align * align)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return ::operator new(size, alignment);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
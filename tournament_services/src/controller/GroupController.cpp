@@ -8,78 +8,116 @@
 #include "delegate/IGroupDelegate.hpp"
 #include "domain/Group.hpp"
 #include "domain/Team.hpp"
-#include "common/Constants.hpp"
+#include "common/ETag.hpp"
+#include "common/JsonWriter.hpp"
+#include "common/RequestDecoder.hpp"
 #include "configuration/RouteDefinition.hpp"
 
 #define JSON_CONTENT_TYPE "application/json"
 #define CONTENT_TYPE_HEADER "content-type"
 
-GroupController::GroupController(std::shared_ptr<IGroupDelegate> delegate) : groupDelegate(std::move(delegate)) {}
+namespace {
+    // POST and PATCH /tournaments/{id}/groups. Like from_json(std::vector<Team>) before it, a team may leave
+    // out its id or name, the delegate rejects teams it cannot find. Ids that are given must be well formed,
+    // they are decoded straight into domain::Uuid.
+    constexpr RequestSchema groupSchema{std::array{
+        FieldRule<domain::Group>{.name = "id", .id = [](domain::Group& group, const domain::Uuid& id) { group.Id() = id; }},
+        FieldRule<domain::Group>{.name = "name", .required = true, .minLength = 1,
+            .text = [](domain::Group& group, std::string_view name) { group.Name() = name; }},
+        FieldRule<domain::Group>{.name = "tournamentId",
+            .id = [](domain::Group& group, const domain::Uuid& tournamentId) { group.TournamentId() = tournamentId; }},
+        FieldRule<domain::Group>{.name = "teams", .kind = FieldKind::Array,
+            .element = [](domain::Group& group) { group.Teams().emplace_back(); }},
+        FieldRule<domain::Group>{.kind = FieldKind::Object, .parent = 3},
+        FieldRule<domain::Group>{.name = "id", .parent = 4,
+            .id = [](domain::Group& group, const domain::Uuid& id) { group.Teams().back().Id = id; }},
+        FieldRule<domain::Group>{.name = "name", .parent = 4,
+            .text = [](domain::Group& group, std::string_view name) { group.Teams().back().Name = name; }},
+    }};
+
+    // POST /tournaments/{id}/groups/{id}/teams
+    constexpr RequestSchema groupTeamSchema{std::array{
+        FieldRule<domain::Team>{.name = "id", .required = true,
+            .id = [](domain::Team& team, const domain::Uuid& id) { team.Id = id; }},
+        FieldRule<domain::Team>{.name = "name", .required = true, .minLength = 1,
+            .text = [](domain::Team& team, std::string_view name) { team.Name = name; }},
+    }};
+}
+
+GroupController::GroupController(std::shared_ptr<IGroupDelegate> delegate, std::shared_ptr<ResponseCache> responseCache)
+    : groupDelegate(std::move(delegate)), responseCache(std::move(responseCache)) {}
 
-crow::response GroupController::GetGroups(const std::string& tournamentId) const {
-    if (!std::regex_match(tournamentId, UUID_REGEX)) {
-        return crow::response(crow::BAD_REQUEST, "Invalid Tournament ID format.");
+Task<crow::response> GroupController::GetGroups(const crow::request& request, domain::Uuid tournamentId) const {
+    const CacheKey key = groupsCacheKey(tournamentId);
+    if (const auto cached = responseCache->Get(key)) {
+        co_return responseCache->Respond(request, key, *cached);
     }
 
-    auto result = groupDelegate->GetGroups(tournamentId);
+    const auto ticket = responseCache->Begin();
+    auto result = co_await groupDelegate->GetGroups(tournamentId);
 
     if (result.has_value()) {
-        nlohmann::json body = result.value();
-        crow::response res(crow::OK, body.dump());
+        // a list has no version of its own, it is only dropped by the writes below it
+        responseCache->Put(key, 0, *result, ticket);
+        crow::response res{crow::OK, std::move(*result)};
         res.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
-        return res;
+        co_return res;
     }
 
-    return crow::response(crow::NOT_FOUND, result.error());
+    co_return crow::response(crow::NOT_FOUND, result.error());
 }
 
-crow::response GroupController::GetGroup(const std::string& tournamentId, const std::string& groupId) const {
-    if (!std::regex_match(tournamentId, UUID_REGEX) || !std::regex_match(groupId, UUID_REGEX)) {
-        return crow::response(crow::BAD_REQUEST, "Invalid ID format.");
+Task<crow::response> GroupController::GetGroup(const crow::request& request, domain::Uuid tournamentId, domain::Uuid groupId) const {
+    const CacheKey key = groupCacheKey(tournamentId, groupId);
+    if (const auto cached = responseCache->Get(key)) {
+        co_return responseCache->Respond(request, key, *cached);
     }
 
-    auto result = groupDelegate->GetGroup(tournamentId, groupId);
+    if (!request.get_header_value(IF_NONE_MATCH_HEADER).empty()) {
+        const auto version = co_await groupDelegate->GetGroupVersion(tournamentId, groupId);
+        if (auto unchanged = version ? responseCache->NotModified(request, *version) : std::nullopt) {
+            co_return std::move(*unchanged);
+        }
+    }
+
+    const auto ticket = responseCache->Begin();
+    auto result = co_await groupDelegate->GetGroup(tournamentId, groupId);
 
     if (result.has_value()) {
-        nlohmann::json body = result.value();
-        crow::response res(crow::OK, body.dump());
+        auto res = jsonResponse(crow::OK, result.value());
+        responseCache->Put(key, result->Version(), res.body, ticket);
         res.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
-        return res;
+        res.add_header(ETAG_HEADER, formatETag(result->Version()));
+        co_return res;
     }
 
-    return crow::response(crow::NOT_FOUND, result.error());
+    co_return crow::response(crow::NOT_FOUND, result.error());
 }
 
-crow::response GroupController::CreateGroup(const crow::request& req, const std::string& tournamentId) const {
-    if (!std::regex_match(tournamentId, UUID_REGEX)) {
-        return crow::response(crow::BAD_REQUEST, "Invalid Tournament ID format.");
-    }
-    if (!nlohmann::json::accept(req.body)) {
-        return crow::response(crow::BAD_REQUEST, "Invalid JSON body.");
+crow::response GroupController::CreateGroup(const crow::request& req, const domain::Uuid& tournamentId) const {
+    auto group = decodeRequest(req.body, groupSchema);
+    if (!group.has_value()) {
+        return badRequest(group.error());
     }
 
-    domain::Group group = nlohmann::json::parse(req.body);
-    auto result = groupDelegate->CreateGroup(tournamentId, group);
+    auto result = groupDelegate->CreateGroup(tournamentId, *group);
 
     if (result.has_value()) {
         crow::response res(crow::CREATED);
-        res.add_header("Location", result.value());
+        res.add_header("Location", result.value().ToString());
         return res;
     }
 
     return crow::response(422, result.error());
 }
 
-crow::response GroupController::AddTeamToGroup(const crow::request& req, const std::string& tournamentId, const std::string& groupId) const {
-    if (!std::regex_match(tournamentId, UUID_REGEX) || !std::regex_match(groupId, UUID_REGEX)) {
-        return crow::response(crow::BAD_REQUEST, "Invalid ID format.");
-    }
-    if (!nlohmann::json::accept(req.body)) {
-        return crow::response(crow::BAD_REQUEST, "Invalid JSON body.");
+crow::response GroupController::AddTeamToGroup(const crow::request& req, const domain::Uuid& tournamentId, const domain::Uuid& groupId) const {
+    const auto team = decodeRequest(req.body, groupTeamSchema);
+    if (!team.has_value()) {
+        return badRequest(team.error());
     }
 
-    domain::Team team = nlohmann::json::parse(req.body);
-    auto result = groupDelegate->AddTeamToGroup(tournamentId, groupId, team);
+    auto result = groupDelegate->AddTeamToGroup(tournamentId, groupId, *team);
 
     if (result.has_value()) {
         return crow::response(crow::NO_CONTENT);
@@ -88,16 +126,18 @@ crow::response GroupController::AddTeamToGroup(const crow::request& req, const s
     return crow::response(422, result.error());
 }
 
-crow::response GroupController::UpdateGroupName(const crow::request& req, const std::string& tournamentId, const std::string& groupId) const {
-    if (!std::regex_match(tournamentId, UUID_REGEX) || !std::regex_match(groupId, UUID_REGEX)) {
-        return crow::response(crow::BAD_REQUEST, "Invalid ID format.");
+crow::response GroupController::UpdateGroupName(const crow::request& req, const domain::Uuid& tournamentId, const domain::Uuid& groupId) const {
+    auto ifMatch = parseIfMatch(req);
+    if (!ifMatch.has_value()) {
+        return std::move(ifMatch.error());
     }
-    if (!nlohmann::json::accept(req.body)) {
-        return crow::response(crow::BAD_REQUEST, "Invalid JSON body.");
+    auto groupPayload = decodeRequest(req.body, groupSchema);
+    if (!groupPayload.has_value()) {
+        return badRequest(groupPayload.error());
     }
 
-    domain::Group groupPayload = nlohmann::json::parse(req.body);
-    auto result = groupDelegate->UpdateGroupName(tournamentId, groupId, groupPayload);
+    groupPayload->Version() = ifMatch->value_or(0);
+    auto result = groupDelegate->UpdateGroupName(tournamentId, groupId, *groupPayload);
 
     if (result.has_value()) {
         return crow::response(crow::NO_CONTENT);
@@ -110,15 +150,14 @@ crow::response GroupController::UpdateGroupName(const crow::request& req, const
     if (error.find("already exists") != std::string::npos) {
         return crow::response(crow::CONFLICT, error);
     }
+    if (error.find("version does not match") != std::string::npos) {
+        return crow::response(PRECONDITION_FAILED, error);
+    }
 
     return crow::response(422, error);
 }
 
-crow::response GroupController::DeleteGroup(const std::string& tournamentId, const std::string& groupId) const {
-    if (!std::regex_match(tournamentId, UUID_REGEX) || !std::regex_match(groupId, UUID_REGEX)) {
-        return crow::response(crow::BAD_REQUEST, "Invalid ID format.");
-    }
-
+crow::response GroupController::DeleteGroup(const domain::Uuid& tournamentId, const domain::Uuid& groupId) const {
     auto result = groupDelegate->DeleteGroup(tournamentId, groupId);
 
     if (result.has_value()) {
@@ -129,9 +168,9 @@ crow::response GroupController::DeleteGroup(const std::string& tournamentId, con
 }
 
 // REGISTRO DE RUTAS
-REGISTER_ROUTE(GroupController, GetGroups,       "/tournaments/<string>/groups",           "GET"_method);
-REGISTER_ROUTE(GroupController, GetGroup,        "/tournaments/<string>/groups/<string>",  "GET"_method);
-REGISTER_ROUTE(GroupController, CreateGroup,     "/tournaments/<string>/groups",           "POST"_method);
-REGISTER_ROUTE(GroupController, AddTeamToGroup,  "/tournaments/<string>/groups/<string>/teams", "POST"_method);
-REGISTER_ROUTE(GroupController, UpdateGroupName, "/tournaments/<string>/groups/<string>",  "PATCH"_method);
-REGISTER_ROUTE(GroupController, DeleteGroup,     "/tournaments/<string>/groups/<string>",  "DELETE"_method);
\ No newline at end of file
+REGISTER_ASYNC_ROUTE(GroupController, GetGroups, "/tournaments/<uuid>/groups",          "GET"_method);
+REGISTER_ASYNC_ROUTE(GroupController, GetGroup,  "/tournaments/<uuid>/groups/<uuid>", "GET"_method);
+REGISTER_ROUTE(GroupController, CreateGroup,     "/tournaments/<uuid>/groups",           "POST"_method);
+REGISTER_ROUTE(GroupController, AddTeamToGroup,  "/tournaments/<uuid>/groups/<uuid>/teams", "POST"_method);
+REGISTER_ROUTE(GroupController, UpdateGroupName, "/tournaments/<uuid>/groups/<uuid>",  "PATCH"_method);
+REGISTER_ROUTE(GroupController, DeleteGroup,     "/tournaments/<uuid>/groups/<uuid>",  "DELETE"_method);
\ No newline at end of file
@@ -0,0 +1,95 @@
+//
+// Created by root on 10/16/26.
+//
+
+#define JSON_CONTENT_TYPE "application/json"
+#define CONTENT_TYPE_HEADER "content-type"
+
+#include <nlohmann/json.hpp>
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/MetricsController.hpp"
+#include "persistence/configuration/RequestArena.hpp"
+#include "persistence/configuration/StatementCatalog.hpp"
+
+MetricsController::MetricsController(std::shared_ptr<IDbConnectionProvider> connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
+
+crow::response MetricsController::GetPoolMetrics() const {
+    const PoolMetrics metrics = connectionProvider->Metrics();
+
+    nlohmann::json histogram = nlohmann::json::array();
+    for (size_t i = 0; i < metrics.waitHistogram.size(); i++) {
+        nlohmann::json bucket = {{"count", metrics.waitHistogram[i]}};
+        if (i < POOL_WAIT_BUCKETS_US.size()) {
+            bucket["leMicros"] = POOL_WAIT_BUCKETS_US[i];
+        } else {
+            bucket["leMicros"] = "+Inf";
+        }
+        histogram.push_back(bucket);
+    }
+
+    nlohmann::json body = {
+        {"poolSize", metrics.poolSize},
+        {"openConnections", metrics.openConnections},
+        {"inUse", metrics.inUse},
+        {"waiters", metrics.waiters},
+        {"checkouts", metrics.checkouts},
+        {"timeouts", metrics.timeouts},
+        {"cancellations", metrics.cancellations},
+        {"checkoutsPerSecond", metrics.checkoutsPerSecond},
+        {"waitHistogram", histogram},
+        {"warmUp", {
+            {"connections", metrics.warmUpConnections},
+            {"millis", metrics.warmUpMillis},
+            {"connectAvgMillis", metrics.warmUpConnectAvgMillis},
+            {"connectMaxMillis", metrics.warmUpConnectMaxMillis}
+        }}
+    };
+
+    crow::response response{crow::OK, body.dump()};
+    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+    return response;
+}
+
+crow::response MetricsController::GetStatementMetrics() const {
+    nlohmann::json body = nlohmann::json::array();
+    for (const auto& statement : StatementCatalog::Instance().Stats()) {
+        body.push_back({
+            {"name", statement.name},
+            {"hits", statement.hits},
+            {"misses", statement.misses}
+        });
+    }
+
+    crow::response response{crow::OK, body.dump()};
+    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+    return response;
+}
+
+crow::response MetricsController::GetRequestMemoryMetrics() const {
+    const RequestArena::Stats totals = RequestArena::Totals();
+    const auto perRequest = [&totals](std::uint64_t count) {
+        return totals.requests == 0 ? 0.0 : static_cast<double>(count) / static_cast<double>(totals.requests);
+    };
+
+    nlohmann::json body = {
+        {"requests", totals.requests},
+        {"arenaAllocations", totals.allocations},
+        {"arenaBytes", totals.bytes},
+        {"arenaBlocks", totals.blocks},
+        {"arenaAllocationsPerRequest", perRequest(totals.allocations)}
+    };
+#ifdef TOURNAMENTS_COUNT_HEAP_ALLOCATIONS
+    // only builds that replace the global operator new know them, elsewhere they would read as zero
+    body["heapAllocations"] = totals.heapAllocations;
+    body["heapAllocationsPerRequest"] = perRequest(totals.heapAllocations);
+#endif
+
+    crow::response response{crow::OK, body.dump()};
+    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+    return response;
+}
+
+REGISTER_ROUTE(MetricsController, GetPoolMetrics, "/metrics/db-pool", "GET"_method)
+REGISTER_ROUTE(MetricsController, GetStatementMetrics, "/metrics/statements", "GET"_method)
+REGISTER_ROUTE(MetricsController, GetRequestMemoryMetrics, "/metrics/request-memory", "GET"_method)
\ No newline at end of file
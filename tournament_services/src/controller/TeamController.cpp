@@ -8,55 +8,143 @@
 #include "configuration/RouteDefinition.hpp"
 #include "controller/TeamController.hpp"
 #include "domain/Utilities.hpp"
+#include "common/ETag.hpp"
+#include "common/JsonWriter.hpp"
+#include "common/Pagination.hpp"
+#include "common/RequestDecoder.hpp"
+#include "common/WireFormat.hpp"
+
+namespace {
+    // every way of creating a team holds its name to the same rule
+    constexpr std::size_t TEAM_NAME_MIN_LENGTH = 1;
+
+    // POST /teams and PATCH /teams/{id}
+    constexpr RequestSchema teamSchema{std::array{
+        FieldRule<domain::Team>{.name = "id", .id = [](domain::Team& team, const domain::Uuid& id) { team.Id = id; }},
+        FieldRule<domain::Team>{.name = "name", .required = true, .minLength = TEAM_NAME_MIN_LENGTH,
+            .text = [](domain::Team& team, std::string_view name) { team.Name = name; }},
+    }};
+
+    std::expected<domain::Team, std::string> parseBulkRow(const nlohmann::json& row, std::size_t index) {
+        if (!row.is_object() || !row.contains("name") || !row["name"].is_string()) {
+            return std::unexpected(std::format("Row {} must be an object with a string name", index));
+        }
+        if (row["name"].get_ref<const std::string&>().size() < TEAM_NAME_MIN_LENGTH) {
+            return std::unexpected(std::format("Row {} must have a non-empty name", index));
+        }
+        return domain::Team{{}, row["name"].get<std::string>()};
+    }
 
+    std::expected<std::vector<domain::Team>, std::string> parseBulkTeams(const crow::request& request) {
+        std::vector<domain::Team> teams;
+        if (request.get_header_value(CONTENT_TYPE_HEADER).find("ndjson") != std::string::npos) {
+            std::string_view body = request.body;
+            while (!body.empty()) {
+                const auto end = body.find('\n');
+                const auto line = body.substr(0, end);
+                body.remove_prefix(end == std::string_view::npos ? body.size() : end + 1);
+                if (line.find_first_not_of(" \t\r") == std::string_view::npos) {
+                    continue;
+                }
+                auto row = nlohmann::json::parse(line, nullptr, false);
+                auto team = parseBulkRow(row, teams.size());
+                if (!team) {
+                    return std::unexpected(team.error());
+                }
+                teams.push_back(std::move(*team));
+            }
+        } else {
+            auto rows = nlohmann::json::parse(request.body, nullptr, false);
+            if (!rows.is_array()) {
+                return std::unexpected("Body must be a JSON array or NDJSON");
+            }
+            teams.reserve(rows.size());
+            for (const auto& row : rows) {
+                auto team = parseBulkRow(row, teams.size());
+                if (!team) {
+                    return std::unexpected(team.error());
+                }
+                teams.push_back(std::move(*team));
+            }
+        }
+        if (teams.empty()) {
+            return std::unexpected("No teams to import");
+        }
+        return teams;
+    }
+}
 
-TeamController::TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate) : teamDelegate(teamDelegate) {}
+TeamController::TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate, std::shared_ptr<ResponseCache> responseCache)
+    : teamDelegate(teamDelegate), responseCache(std::move(responseCache)) {}
 
-crow::response TeamController::getTeam(const std::string& teamId) const {
-    if(!std::regex_match(teamId, UUID_REGEX)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
+crow::response TeamController::getTeam(const crow::request& request, const domain::Uuid& teamId) const {
+    const CacheKey key = teamCacheKey(teamId);
+    if (const auto cached = responseCache->Get(key)) {
+        return responseCache->Respond(request, key, *cached);
     }
 
     try {
+        if (!request.get_header_value(IF_NONE_MATCH_HEADER).empty()) {
+            const auto version = teamDelegate->GetTeamVersion(teamId);
+            if (auto unchanged = version ? responseCache->NotModified(request, *version) : std::nullopt) {
+                return std::move(*unchanged);
+            }
+        }
+        const auto ticket = responseCache->Begin();
         if(auto team = teamDelegate->GetTeam(teamId); team != nullptr) {
-            nlohmann::json body = team;
-            auto response = crow::response{crow::OK, body.dump()};
+            auto response = jsonResponse(crow::OK, team);
+            responseCache->Put(key, team->Version, response.body, ticket);
             response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+            response.add_header(ETAG_HEADER, formatETag(team->Version));
             return response;
         }
         return crow::response{crow::NOT_FOUND, "Team not found"};
     } catch (const domain::NotFoundException& e) {
         return crow::response{crow::NOT_FOUND, "Team not found"};
+    } catch (const ConnectionUnavailableException&) {
+        // answered 503 by the route
+        throw;
     } catch (const std::exception& e) {
+        if (deadlineExceeded(e)) {
+            // answered 504 by the route
+            throw;
+        }
         return crow::response{crow::INTERNAL_SERVER_ERROR, "An internal error occurred."};
     }
 }
 
-crow::response TeamController::getAllTeams() const {
+crow::response TeamController::getAllTeams(const crow::request& request) const {
+    auto page = parsePageRequest(request);
+    if (!page.has_value()) {
+        return crow::response{crow::BAD_REQUEST, page.error()};
+    }
 
-    nlohmann::json body = teamDelegate->GetAllTeams();
-    crow::response response{200, body.dump()};
-    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+    if (!page->has_value()) {
+        return exportJsonArray("/teams", [this](const auto& writeRow, std::size_t limit) { return teamDelegate->ExportTeams(writeRow, limit); });
+    }
+
+    const auto teams = teamDelegate->GetTeamsPage((*page)->after, (*page)->limit);
+    auto response = wireResponse(request, crow::OK, teams);
+    if (!teams.empty()) {
+        addNextPageLink(response, "/teams", **page, teams.size(), teams.back()->Id);
+    }
     return response;
 }
 
 crow::response TeamController::SaveTeam(const crow::request& request) const {
     crow::response response;
 
-    if(!nlohmann::json::accept(request.body)) {
-        response.code = crow::BAD_REQUEST;
-        return response;
+    const auto team = decodeRequest(request.body, teamSchema);
+    if (!team.has_value()) {
+        return badRequest(team.error());
     }
 
-    auto requestBody = nlohmann::json::parse(request.body);
-    domain::Team team = requestBody;
-
     // Devuelve un std::expected
-    auto createdIdResult = teamDelegate->SaveTeam(team);
+    auto createdIdResult = teamDelegate->SaveTeam(*team);
 
     if (createdIdResult.has_value()) {
         response.code = crow::CREATED; // 201
-        response.add_header("location", createdIdResult.value());
+        response.add_header("location", createdIdResult.value().ToString());
     } else {
         const std::string& errorMessage = createdIdResult.error();
         if (errorMessage.find("already exists") != std::string::npos) {
@@ -71,23 +159,49 @@ crow::response TeamController::SaveTeam(const crow::request& request) const {
     return response;
 }
 
-crow::response TeamController::UpdateTeam(const crow::request& request, const std::string& teamId) const {
+crow::response TeamController::ImportTeams(const crow::request& request) const {
+    auto teams = parseBulkTeams(request);
+    if (!teams) {
+        return crow::response{crow::BAD_REQUEST, teams.error()};
+    }
+
+    const BulkImportResult result = teamDelegate->ImportTeams(*teams);
+
+    nlohmann::json ids = nlohmann::json::array();
+    for (const auto& id : result.ids) {
+        ids.push_back(id.IsNil() ? nlohmann::json() : nlohmann::json(id.ToString()));
+    }
+    nlohmann::json conflicts = nlohmann::json::array();
+    for (const auto row : result.conflicts) {
+        conflicts.push_back({{"row", row}, {"name", (*teams)[row].Name}, {"error", domain::DuplicateEntryException().what()}});
+    }
+    nlohmann::json body = {
+        {"created", teams->size() - result.conflicts.size()},
+        {"ids", ids},
+        {"conflicts", conflicts}
+    };
+
+    crow::response response{crow::OK, body.dump()};
+    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+    return response;
+}
+
+crow::response TeamController::UpdateTeam(const crow::request& request, const domain::Uuid& teamId) const {
     crow::response response;
 
-    // Validar el formato del ID
-    if(!std::regex_match(teamId, UUID_REGEX)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
+    auto ifMatch = parseIfMatch(request);
+    if (!ifMatch.has_value()) {
+        return std::move(ifMatch.error());
     }
 
     // Validar y parsear el cuerpo JSON
-    if(!nlohmann::json::accept(request.body)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid JSON body"};
+    auto team = decodeRequest(request.body, teamSchema);
+    if (!team.has_value()) {
+        return badRequest(team.error());
     }
+    team->Version = ifMatch->value_or(0);
 
-    auto requestBody = nlohmann::json::parse(request.body);
-    domain::Team team = requestBody;
-
-    auto updateResult = teamDelegate->UpdateTeam(teamId, team);
+    auto updateResult = teamDelegate->UpdateTeam(teamId, *team);
 
     if (updateResult.has_value()) {
         response.code = crow::NO_CONTENT; // 204
@@ -99,6 +213,9 @@ crow::response TeamController::UpdateTeam(const crow::request& request, const st
         } else if (errorMessage.find("already exists") != std::string::npos) {
             response.code = crow::CONFLICT; // 409
             response.body = errorMessage;
+        } else if (errorMessage.find("version does not match") != std::string::npos) {
+            response.code = PRECONDITION_FAILED; // 412
+            response.body = errorMessage;
         } else {
             response.code = crow::INTERNAL_SERVER_ERROR; // 500
             response.body = errorMessage;
@@ -108,11 +225,7 @@ crow::response TeamController::UpdateTeam(const crow::request& request, const st
     return response;
 }
 
-crow::response TeamController::DeleteTeam(const std::string& teamId) const {
-    if(!std::regex_match(teamId, UUID_REGEX)) {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
-    }
-
+crow::response TeamController::DeleteTeam(const domain::Uuid& teamId) const {
     auto deleteResult = teamDelegate->DeleteTeam(teamId);
 
     if (deleteResult.has_value()) {
@@ -124,8 +237,9 @@ crow::response TeamController::DeleteTeam(const std::string& teamId) const {
     }
 }
 
-REGISTER_ROUTE(TeamController, getTeam, "/teams/<string>", "GET"_method)
+REGISTER_ROUTE(TeamController, getTeam, "/teams/<uuid>", "GET"_method)
 REGISTER_ROUTE(TeamController, getAllTeams, "/teams", "GET"_method)
 REGISTER_ROUTE(TeamController, SaveTeam, "/teams", "POST"_method)
-REGISTER_ROUTE(TeamController, UpdateTeam, "/teams/<string>", "PATCH"_method)
-REGISTER_ROUTE(TeamController, DeleteTeam, "/teams/<string>", "DELETE"_method)
\ No newline at end of file
+REGISTER_ROUTE(TeamController, ImportTeams, "/teams:bulk", "POST"_method)
+REGISTER_ROUTE(TeamController, UpdateTeam, "/teams/<uuid>", "PATCH"_method)
+REGISTER_ROUTE(TeamController, DeleteTeam, "/teams/<uuid>", "DELETE"_method)
\ No newline at end of file
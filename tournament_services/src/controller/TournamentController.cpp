@@ -14,24 +14,45 @@
 #include <expected>
 #include "domain/Tournament.hpp"
 #include "domain/Utilities.hpp"
+#include "common/ETag.hpp"
+#include "common/JsonWriter.hpp"
+#include "common/Pagination.hpp"
+#include "common/RequestDecoder.hpp"
+#include "common/WireFormat.hpp"
+
+namespace {
+    // POST and PATCH /tournaments, the format is optional and keeps the Tournament defaults for what it leaves out
+    constexpr RequestSchema tournamentSchema{std::array{
+        FieldRule<domain::Tournament>{.name = "id", .id = [](domain::Tournament& tournament, const domain::Uuid& id) { tournament.Id() = id; }},
+        FieldRule<domain::Tournament>{.name = "name", .required = true, .minLength = 1,
+            .text = [](domain::Tournament& tournament, std::string_view name) { tournament.Name() = name; }},
+        FieldRule<domain::Tournament>{.name = "format", .kind = FieldKind::Object},
+        FieldRule<domain::Tournament>{.name = "maxTeamsPerGroup", .kind = FieldKind::Integer, .parent = 2, .minimum = 1,
+            .number = [](domain::Tournament& tournament, std::int64_t teams) { tournament.Format().MaxTeamsPerGroup() = static_cast<int>(teams); }},
+        FieldRule<domain::Tournament>{.name = "numberOfGroups", .kind = FieldKind::Integer, .parent = 2, .minimum = 1,
+            .number = [](domain::Tournament& tournament, std::int64_t groups) { tournament.Format().NumberOfGroups() = static_cast<int>(groups); }},
+        FieldRule<domain::Tournament>{.name = "type", .parent = 2, .oneOf = {"ROUND_ROBIN", "NFL"},
+            .text = [](domain::Tournament& tournament, std::string_view type) { tournament.Format().Type() = domain::fromString(type); }},
+    }};
+}
 
-TournamentController::TournamentController(std::shared_ptr<ITournamentDelegate> delegate) : tournamentDelegate(std::move(delegate)) {}
+TournamentController::TournamentController(std::shared_ptr<ITournamentDelegate> delegate, std::shared_ptr<ResponseCache> responseCache)
+    : tournamentDelegate(std::move(delegate)), responseCache(std::move(responseCache)) {}
 
 crow::response TournamentController::CreateTournament(const crow::request &request) const
 {
     crow::response response;
-    if(!nlohmann::json::accept(request.body)) {
-        response.code = crow::BAD_REQUEST;
-        return response;
+    auto body = decodeRequest(request.body, tournamentSchema);
+    if (!body.has_value()) {
+        return badRequest(body.error());
     }
-    
-    nlohmann::json body = nlohmann::json::parse(request.body);
-    const std::shared_ptr<domain::Tournament> tournament = std::make_shared<domain::Tournament>(body);
+
+    const std::shared_ptr<domain::Tournament> tournament = std::make_shared<domain::Tournament>(std::move(*body));
 
     auto createdIdResult = tournamentDelegate->CreateTournament(tournament);
     if (createdIdResult.has_value()) {
         response.code = crow::CREATED; // 201
-        response.add_header("location", createdIdResult.value());
+        response.add_header("location", createdIdResult.value().ToString());
     } else {
         const std::string& errorMessage = createdIdResult.error();
         if (errorMessage.find("already exists") != std::string::npos) {
@@ -48,12 +69,16 @@ crow::response TournamentController::CreateTournament(const crow::request &reque
 crow::response TournamentController::UpdateTournament(const crow::request &request) const
 {
     crow::response response;
-    if(!nlohmann::json::accept(request.body)) {
-        response.code = crow::BAD_REQUEST;
-        return response;
+    auto ifMatch = parseIfMatch(request);
+    if (!ifMatch.has_value()) {
+        return std::move(ifMatch.error());
     }
-    nlohmann::json body = nlohmann::json::parse(request.body);
-    const std::shared_ptr<domain::Tournament> tournament = std::make_shared<domain::Tournament>(body);
+    auto body = decodeRequest(request.body, tournamentSchema);
+    if (!body.has_value()) {
+        return badRequest(body.error());
+    }
+    const std::shared_ptr<domain::Tournament> tournament = std::make_shared<domain::Tournament>(std::move(*body));
+    tournament->Version() = ifMatch->value_or(0);
 
     auto updateResult = tournamentDelegate->UpdateTournament(tournament);
     if (updateResult.has_value()) {
@@ -66,6 +91,9 @@ crow::response TournamentController::UpdateTournament(const crow::request &reque
         } else if (errorMessage.find("already exists") != std::string::npos) {
             response.code = crow::CONFLICT; // 409
             response.body = errorMessage;
+        } else if (errorMessage.find("version does not match") != std::string::npos) {
+            response.code = PRECONDITION_FAILED; // 412
+            response.body = errorMessage;
         } else {
             response.code = crow::INTERNAL_SERVER_ERROR; // 500
             response.body = errorMessage;
@@ -74,30 +102,37 @@ crow::response TournamentController::UpdateTournament(const crow::request &reque
     return response;
 }
 
-crow::response TournamentController::GetTournament(const std::string &tournamentId) const
+crow::response TournamentController::GetTournament(const crow::request &request, const domain::Uuid &tournamentId) const
 {
-    if (!std::regex_match(tournamentId, ID_VALUE))
+    const CacheKey key = tournamentCacheKey(tournamentId);
+    if (const auto cached = responseCache->Get(key))
+    {
+        return responseCache->Respond(request, key, *cached);
+    }
+
+    if (!request.get_header_value(IF_NONE_MATCH_HEADER).empty())
     {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
+        const auto version = tournamentDelegate->GetTournamentVersion(tournamentId);
+        if (auto unchanged = version ? responseCache->NotModified(request, *version) : std::nullopt)
+        {
+            return std::move(*unchanged);
+        }
     }
 
+    const auto ticket = responseCache->Begin();
     if (auto tournament = tournamentDelegate->GetTournament(tournamentId); tournament != nullptr)
     {
-        nlohmann::json body = tournament;
-        auto response = crow::response{crow::OK, body.dump()};
+        auto response = jsonResponse(crow::OK, tournament);
+        responseCache->Put(key, tournament->Version(), response.body, ticket);
         response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+        response.add_header(ETAG_HEADER, formatETag(tournament->Version()));
         return response;
     }
     return crow::response{crow::NOT_FOUND, "tournament not found"};
 }
 
-crow::response TournamentController::DeleteTournament(const std::string &tournamentId) const
+crow::response TournamentController::DeleteTournament(const domain::Uuid &tournamentId) const
 {
-    if (!std::regex_match(tournamentId, UUID_REGEX))
-    {
-        return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
-    }
-
     auto deleteResult = tournamentDelegate->DeleteTournament(tournamentId);
 
     if (deleteResult.has_value())
@@ -112,19 +147,45 @@ crow::response TournamentController::DeleteTournament(const std::string &tournam
     }
 }
 
-crow::response TournamentController::ReadAll() const
+crow::response TournamentController::ReadAll(const crow::request &request) const
 {
-    nlohmann::json body = tournamentDelegate->ReadAll();
-    crow::response response;
-    response.code = crow::OK;
-    response.body = body.dump();
-    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+    auto page = parsePageRequest(request);
+    if (!page.has_value())
+    {
+        return crow::response{crow::BAD_REQUEST, page.error()};
+    }
+
+    if (!page->has_value())
+    {
+        return exportJsonArray("/tournaments", [this](const auto& writeRow, std::size_t limit) { return tournamentDelegate->ExportAll(writeRow, limit); });
+    }
 
+    const auto tournaments = tournamentDelegate->ReadPage((*page)->after, (*page)->limit);
+    auto response = wireResponse(request, crow::OK, tournaments);
+    if (!tournaments.empty())
+    {
+        addNextPageLink(response, "/tournaments", **page, tournaments.size(), tournaments.back()->Id());
+    }
+
+    return response;
+}
+
+crow::response TournamentController::GetStandings(const domain::Uuid &tournamentId) const
+{
+    auto standings = tournamentDelegate->GetStandings(tournamentId);
+    if (!standings.has_value())
+    {
+        return crow::response{crow::NOT_FOUND, standings.error()};
+    }
+
+    auto response = jsonResponse(crow::OK, standings.value());
+    response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
     return response;
 }
 
 REGISTER_ROUTE(TournamentController, CreateTournament, "/tournaments", "POST"_method)
 REGISTER_ROUTE(TournamentController, UpdateTournament, "/tournaments", "PATCH"_method)
-REGISTER_ROUTE(TournamentController, GetTournament, "/tournaments/<string>", "GET"_method)
-REGISTER_ROUTE(TournamentController, DeleteTournament, "/tournaments/<string>", "DELETE"_method)
-REGISTER_ROUTE(TournamentController, ReadAll, "/tournaments", "GET"_method)
\ No newline at end of file
+REGISTER_ROUTE(TournamentController, GetTournament, "/tournaments/<uuid>", "GET"_method)
+REGISTER_ROUTE(TournamentController, DeleteTournament, "/tournaments/<uuid>", "DELETE"_method)
+REGISTER_ROUTE(TournamentController, ReadAll, "/tournaments", "GET"_method)
+REGISTER_ROUTE(TournamentController, GetStandings, "/tournaments/<uuid>/standings", "GET"_method)
\ No newline at end of file
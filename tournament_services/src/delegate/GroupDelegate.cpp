@@ -9,48 +9,50 @@
 #include "persistence/repository/IGroupRepository.hpp"
 #include "persistence/repository/TeamRepository.hpp"
 #include "cms/IQueueMessageProducer.hpp"
+#include <unordered_set>
 #include <utility>
 #include <format>
 
-GroupDelegate::GroupDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepo,
+GroupDelegate::GroupDelegate(std::shared_ptr<IRepository<domain::Tournament, domain::Uuid>> tournamentRepo,
                              std::shared_ptr<IGroupRepository> groupRepo,
-                             std::shared_ptr<IRepository<domain::Team, std::string>> teamRepo,
-                             std::shared_ptr<IQueueMessageProducer> producer)
+                             std::shared_ptr<ITeamRepository> teamRepo,
+                             std::shared_ptr<IQueueMessageProducer> producer,
+                             std::shared_ptr<IAsyncRepository<domain::Tournament, domain::Uuid>> asyncTournamentRepo,
+                             std::shared_ptr<IAsyncGroupRepository> asyncGroupRepo,
+                             std::shared_ptr<ResponseCache> responseCache)
     : tournamentRepository(std::move(tournamentRepo)),
       groupRepository(std::move(groupRepo)),
       teamRepository(std::move(teamRepo)),
-      producer(std::move(producer)) {}
+      producer(std::move(producer)),
+      asyncTournamentRepository(std::move(asyncTournamentRepo)),
+      asyncGroupRepository(std::move(asyncGroupRepo)),
+      responseCache(std::move(responseCache)) {}
 
-std::expected<std::vector<domain::Group>, std::string> GroupDelegate::GetGroups(std::string tournamentId) {
-    if (!tournamentRepository->ReadById(tournamentId)) {
-        return std::unexpected("Tournament not found.");
+Task<std::expected<std::string, std::string>> GroupDelegate::GetGroups(domain::Uuid tournamentId) {
+    auto groups = co_await asyncGroupRepository->FindJsonByTournamentId(tournamentId);
+    if (!groups) {
+        co_return std::unexpected("Tournament not found.");
     }
-
-    auto groupsAsPtrs = groupRepository->FindByTournamentId(tournamentId);
-    std::vector<domain::Group> groupsAsValues;
-    groupsAsValues.reserve(groupsAsPtrs.size());
-
-    for (const auto& groupPtr : groupsAsPtrs) {
-        if (groupPtr) {
-            groupsAsValues.push_back(*groupPtr);
-        }
-    }
-
-    return groupsAsValues;
+    co_return std::move(*groups);
 }
 
-std::expected<domain::Group, std::string> GroupDelegate::GetGroup(std::string tournamentId, std::string_view groupId) {
-    if (!tournamentRepository->ReadById(tournamentId)) {
-        return std::unexpected("Tournament not found.");
+Task<std::expected<domain::Group, std::string>> GroupDelegate::GetGroup(domain::Uuid tournamentId, domain::Uuid groupId) {
+    if (!co_await asyncTournamentRepository->ReadById(tournamentId)) {
+        co_return std::unexpected("Tournament not found.");
     }
-    auto group = groupRepository->FindByTournamentIdAndGroupId(tournamentId, groupId);
+    auto group = co_await asyncGroupRepository->FindByTournamentIdAndGroupId(tournamentId, groupId);
     if (!group) {
-        return std::unexpected("Group not found in this tournament.");
+        co_return std::unexpected("Group not found in this tournament.");
     }
-    return *group;
+    // the repository built the group for this call alone
+    co_return std::move(*group);
+}
+
+Task<std::optional<std::int64_t>> GroupDelegate::GetGroupVersion(domain::Uuid tournamentId, domain::Uuid groupId) {
+    co_return co_await asyncGroupRepository->FindVersion(tournamentId, groupId);
 }
 
-std::expected<std::string, std::string> GroupDelegate::CreateGroup(const std::string tournamentId, domain::Group& group) {
+std::expected<domain::Uuid, std::string> GroupDelegate::CreateGroup(const domain::Uuid& tournamentId, domain::Group& group) {
     std::shared_ptr<domain::Tournament> tournament = tournamentRepository->ReadById(tournamentId);
     if (!tournament) {
         return std::unexpected("Tournament not found.");
@@ -65,18 +67,37 @@ std::expected<std::string, std::string> GroupDelegate::CreateGroup(const std::st
         return std::unexpected(std::format("A group cannot have more than {} teams.", MAX_TEAMS_PER_GROUP));
     }
 
+    // one lookup for all teams and one for their memberships, however many teams the group brings
+    std::vector<domain::Uuid> teamIds;
+    teamIds.reserve(group.Teams().size());
     for (const auto& team : group.Teams()) {
-        if (!teamRepository->ReadById(team.Id)) {
-            return std::unexpected(std::format("Team with ID {} does not exist.", team.Id));
+        teamIds.push_back(team.Id);
+    }
+
+    if (!teamIds.empty()) {
+        std::unordered_set<domain::Uuid> existingTeamIds;
+        for (const auto& team : teamRepository->ReadByIds(teamIds)) {
+            existingTeamIds.insert(team->Id);
         }
-        if (groupRepository->FindByTournamentIdAndTeamId(tournamentId, team.Id)) {
-            return std::unexpected(std::format("Team {} is already in another group in this tournament.", team.Name));
+        for (const auto& team : group.Teams()) {
+            if (!existingTeamIds.contains(team.Id)) {
+                return std::unexpected(std::format("Team with ID {} does not exist.", team.Id));
+            }
+        }
+
+        const auto groupedTeamIds = groupRepository->FindGroupedTeamIds(tournamentId, teamIds);
+        const std::unordered_set<domain::Uuid> grouped(groupedTeamIds.begin(), groupedTeamIds.end());
+        for (const auto& team : group.Teams()) {
+            if (grouped.contains(team.Id)) {
+                return std::unexpected(std::format("Team {} is already in another group in this tournament.", team.Name));
+            }
         }
     }
 
     group.TournamentId() = tournamentId;
+    const ResponseCache::Invalidation invalidation(*responseCache, {groupsCacheKey(tournamentId)});
     try {
-        std::string newGroupId = groupRepository->Create(group);
+        const domain::Uuid newGroupId = groupRepository->Create(group);
         checkAndPublishTournamentReadyEvent(tournamentId);
         return newGroupId;
     } catch (const domain::DuplicateEntryException& e) {
@@ -84,30 +105,26 @@ std::expected<std::string, std::string> GroupDelegate::CreateGroup(const std::st
     }
 }
 
-std::expected<void, std::string> GroupDelegate::AddTeamToGroup(std::string_view tournamentId, std::string_view groupId, const domain::Team& team) {
-    auto group = groupRepository->FindByTournamentIdAndGroupId(tournamentId, groupId);
-    if (!group) {
-        return std::unexpected("Group not found in this tournament.");
-    }
-
-    if (group->Teams().size() >= MAX_TEAMS_PER_GROUP) {
-        return std::unexpected("Group is already full.");
-    }
-
-    if (!teamRepository->ReadById(team.Id)) {
-        return std::unexpected(std::format("Team with ID {} does not exist.", team.Id));
-    }
-
-    if (groupRepository->FindByTournamentIdAndTeamId(tournamentId, team.Id)) {
-        return std::unexpected(std::format("Team {} is already in a group in this tournament.", team.Name));
+std::expected<void, std::string> GroupDelegate::AddTeamToGroup(const domain::Uuid& tournamentId, const domain::Uuid& groupId, const domain::Team& team) {
+    const ResponseCache::Invalidation invalidation(*responseCache, {groupCacheKey(tournamentId, groupId), groupsCacheKey(tournamentId)});
+    switch (groupRepository->AddTeamToGroup(tournamentId, groupId, team.Id, MAX_TEAMS_PER_GROUP)) {
+        case AddTeamStatus::GroupNotFound:
+            return std::unexpected("Group not found in this tournament.");
+        case AddTeamStatus::GroupFull:
+            return std::unexpected("Group is already full.");
+        case AddTeamStatus::TeamNotFound:
+            return std::unexpected(std::format("Team with ID {} does not exist.", team.Id));
+        case AddTeamStatus::TeamAlreadyGrouped:
+            return std::unexpected(std::format("Team {} is already in a group in this tournament.", team.Name));
+        case AddTeamStatus::Added:
+            break;
     }
 
-    groupRepository->UpdateGroupAddTeam(groupId, team);
     checkAndPublishTournamentReadyEvent(tournamentId);
     return {};
 }
 
-std::expected<void, std::string> GroupDelegate::UpdateGroupName(std::string_view tournamentId, std::string_view groupId, const domain::Group& groupUpdatePayload) {
+std::expected<void, std::string> GroupDelegate::UpdateGroupName(const domain::Uuid& tournamentId, const domain::Uuid& groupId, const domain::Group& groupUpdatePayload) {
     auto group = groupRepository->FindByTournamentIdAndGroupId(tournamentId, groupId);
     if (!group) {
         return std::unexpected("Group not found in this tournament.");
@@ -115,22 +132,28 @@ std::expected<void, std::string> GroupDelegate::UpdateGroupName(std::string_view
 
     group->Name() = groupUpdatePayload.Name();
     group->TournamentId() = tournamentId;
+    // only the version the client sent conditions the write, not the one read above
+    group->Version() = groupUpdatePayload.Version();
 
+    const ResponseCache::Invalidation invalidation(*responseCache, {groupCacheKey(tournamentId, groupId), groupsCacheKey(tournamentId)});
     try {
         groupRepository->Update(*group);
         return {};
     } catch (const domain::NotFoundException& e) {
         return std::unexpected(e.what());
+    } catch (const domain::VersionMismatchException& e) {
+        return std::unexpected(e.what());
     } catch (const domain::DuplicateEntryException& e) {
         return std::unexpected(e.what());
     }
 }
 
-std::expected<void, std::string> GroupDelegate::DeleteGroup(std::string_view tournamentId, std::string groupId) {
+std::expected<void, std::string> GroupDelegate::DeleteGroup(const domain::Uuid& tournamentId, const domain::Uuid& groupId) {
     if (!groupRepository->FindByTournamentIdAndGroupId(tournamentId, groupId)) {
         return std::unexpected("Group not found in this tournament.");
     }
 
+    const ResponseCache::Invalidation invalidation(*responseCache, {groupCacheKey(tournamentId, groupId), groupsCacheKey(tournamentId)});
     try {
         groupRepository->Delete(groupId);
         return {};
@@ -140,7 +163,7 @@ std::expected<void, std::string> GroupDelegate::DeleteGroup(std::string_view tou
 }
 
 // Lógica del Evento
-void GroupDelegate::checkAndPublishTournamentReadyEvent(std::string_view tournamentId) {
+void GroupDelegate::checkAndPublishTournamentReadyEvent(const domain::Uuid& tournamentId) {
     auto groups = groupRepository->FindByTournamentId(tournamentId);
 
     if (groups.size() != MAX_GROUPS_PER_TOURNAMENT) {
@@ -153,5 +176,5 @@ void GroupDelegate::checkAndPublishTournamentReadyEvent(std::string_view tournam
         }
     }
 
-    producer->SendMessage(tournamentId, "tournament.ready");
+    producer->SendMessage(tournamentId.ToString(), "tournament.ready");
 }
\ No newline at end of file
@@ -6,18 +6,31 @@
 
 #include <utility>
 
-TeamDelegate::TeamDelegate(std::shared_ptr<IRepository<domain::Team, std::string> > repository) : teamRepository(std::move(repository)) {
+TeamDelegate::TeamDelegate(std::shared_ptr<ITeamRepository> repository, std::shared_ptr<ResponseCache> responseCache)
+    : teamRepository(std::move(repository)), responseCache(std::move(responseCache)) {
 }
 
 std::vector<std::shared_ptr<domain::Team>> TeamDelegate::GetAllTeams() {
     return teamRepository->ReadAll();
 }
 
-std::shared_ptr<domain::Team> TeamDelegate::GetTeam(std::string id) {
-    return teamRepository->ReadById(id.data());
+std::vector<std::shared_ptr<domain::Team>> TeamDelegate::GetTeamsPage(const std::optional<domain::Uuid>& after, std::size_t limit) {
+    return teamRepository->ReadPage(after, limit);
 }
 
-std::expected<std::string, std::string> TeamDelegate::SaveTeam(const domain::Team& team){
+bool TeamDelegate::ExportTeams(const std::function<void(std::string_view)>& writeRow, std::size_t limit) {
+    return teamRepository->ExportAll(writeRow, limit);
+}
+
+std::shared_ptr<domain::Team> TeamDelegate::GetTeam(const domain::Uuid& id) {
+    return teamRepository->ReadById(id);
+}
+
+std::optional<std::int64_t> TeamDelegate::GetTeamVersion(const domain::Uuid& id) {
+    return teamRepository->ReadVersion(id);
+}
+
+std::expected<domain::Uuid, std::string> TeamDelegate::SaveTeam(const domain::Team& team){
     try {
         return teamRepository->Create(team);
     } catch (const domain::DuplicateEntryException& e) {
@@ -25,18 +38,26 @@ std::expected<std::string, std::string> TeamDelegate::SaveTeam(const domain::Tea
     }
 }
 
-std::expected<std::string, std::string> TeamDelegate::UpdateTeam(const std::string& teamId, const domain::Team& team) {
+BulkImportResult TeamDelegate::ImportTeams(const std::vector<domain::Team>& teams) {
+    return teamRepository->CreateMany(teams);
+}
+
+std::expected<domain::Uuid, std::string> TeamDelegate::UpdateTeam(const domain::Uuid& teamId, const domain::Team& team) {
+    const ResponseCache::Invalidation invalidation(*responseCache, {teamCacheKey(teamId)});
     try {
-        domain::Team teamToUpdate{teamId, team.Name};
+        domain::Team teamToUpdate{teamId, team.Name, team.Version};
         return teamRepository->Update(teamToUpdate);
     } catch (const domain::NotFoundException& e) {
         return std::unexpected(e.what());
+    } catch (const domain::VersionMismatchException& e) {
+        return std::unexpected(e.what());
     } catch (const domain::DuplicateEntryException& e) {
         return std::unexpected(e.what());
     }
 }
 
-std::expected<void, std::string> TeamDelegate::DeleteTeam(const std::string& teamId) {
+std::expected<void, std::string> TeamDelegate::DeleteTeam(const domain::Uuid& teamId) {
+    const ResponseCache::Invalidation invalidation(*responseCache, {teamCacheKey(teamId)});
     try {
         teamRepository->Delete(teamId);
         return {};
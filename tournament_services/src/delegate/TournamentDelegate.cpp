@@ -1,55 +1,67 @@
 //
 // Created by tomas on 8/31/25.
 //
+#include <algorithm>
 #include <string_view>
 #include <memory>
 #include <expected>
 
 #include "delegate/TournamentDelegate.hpp"
 #include "domain/Utilities.hpp"
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITournamentRepository.hpp"
 
-TournamentDelegate::TournamentDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string>> repository, std::shared_ptr<IQueueMessageProducer> producer) : tournamentRepository(std::move(repository)), producer(std::move(producer))
+TournamentDelegate::TournamentDelegate(std::shared_ptr<ITournamentRepository> repository, std::shared_ptr<IQueueMessageProducer> producer, std::shared_ptr<IStandingRepository> standingRepository, std::shared_ptr<ResponseCache> responseCache)
+    : tournamentRepository(std::move(repository)), producer(std::move(producer)), standingRepository(std::move(standingRepository)), responseCache(std::move(responseCache))
 {
 }
 
-std::expected<std::string, std::string> TournamentDelegate::CreateTournament(std::shared_ptr<domain::Tournament> tournament)
+std::expected<domain::Uuid, std::string> TournamentDelegate::CreateTournament(std::shared_ptr<domain::Tournament> tournament)
 {
     try {
         std::shared_ptr<domain::Tournament> tp = std::move(tournament);
-        std::string id = tournamentRepository->Create(*tp);
-        producer->SendMessage(id, "tournament.created");
+        const domain::Uuid id = tournamentRepository->Create(*tp);
+        producer->SendMessage(id.ToString(), "tournament.created");
         return id;
     } catch (const domain::DuplicateEntryException& e) {
         return std::unexpected(e.what());
     }
 }
 
-std::expected<std::string, std::string> TournamentDelegate::UpdateTournament(std::shared_ptr<domain::Tournament> tournament)
+std::expected<domain::Uuid, std::string> TournamentDelegate::UpdateTournament(std::shared_ptr<domain::Tournament> tournament)
 {
+    const ResponseCache::Invalidation invalidation(*responseCache, {tournamentCacheKey(tournament->Id())});
     try {
         std::shared_ptr<domain::Tournament> tp = std::move(tournament);
-        std::string id = tournamentRepository->Update(*tp);
-        producer->SendMessage(id, "tournament.updated");
+        const domain::Uuid id = tournamentRepository->Update(*tp);
+        producer->SendMessage(id.ToString(), "tournament.updated");
         return id;
     } catch (const domain::NotFoundException& e) {
         return std::unexpected(e.what());
+    } catch (const domain::VersionMismatchException& e) {
+        return std::unexpected(e.what());
     } catch (const domain::DuplicateEntryException& e) {
         return std::unexpected(e.what());
     }
 }
 
-std::shared_ptr<domain::Tournament> TournamentDelegate::GetTournament(std::string_view id)
+std::shared_ptr<domain::Tournament> TournamentDelegate::GetTournament(const domain::Uuid& id)
+{
+    return tournamentRepository->ReadById(id);
+}
+
+std::optional<std::int64_t> TournamentDelegate::GetTournamentVersion(const domain::Uuid& id)
 {
-    return tournamentRepository->ReadById(id.data());
+    return tournamentRepository->ReadVersion(id);
 }
 
-std::expected<void, std::string> TournamentDelegate::DeleteTournament(const std::string &tournamentId)
+std::expected<void, std::string> TournamentDelegate::DeleteTournament(const domain::Uuid &tournamentId)
 {
+    // the groups go with the tournament
+    const ResponseCache::Invalidation invalidation(*responseCache, {tournamentCacheKey(tournamentId)}, true);
     try
     {
         tournamentRepository->Delete(tournamentId);
-        producer->SendMessage(tournamentId, "tournament.deleted");
+        producer->SendMessage(tournamentId.ToString(), "tournament.deleted");
         return {};
     }
     catch (const domain::NotFoundException &e)
@@ -61,4 +73,24 @@ std::expected<void, std::string> TournamentDelegate::DeleteTournament(const std:
 std::vector<std::shared_ptr<domain::Tournament>> TournamentDelegate::ReadAll()
 {
     return tournamentRepository->ReadAll();
+}
+
+std::vector<std::shared_ptr<domain::Tournament>> TournamentDelegate::ReadPage(const std::optional<domain::Uuid>& after, std::size_t limit)
+{
+    return tournamentRepository->ReadPage(after, limit);
+}
+
+bool TournamentDelegate::ExportAll(const std::function<void(std::string_view)>& writeRow, std::size_t limit)
+{
+    return tournamentRepository->ExportAll(writeRow, limit);
+}
+
+std::expected<std::vector<domain::Standing>, std::string> TournamentDelegate::GetStandings(const domain::Uuid& tournamentId)
+{
+    auto standings = standingRepository->FindByTournamentId(tournamentId);
+    if (!standings.has_value()) {
+        return std::unexpected("Tournament not found.");
+    }
+    std::ranges::sort(*standings, domain::RanksAbove);
+    return std::move(*standings);
 }
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <zlib.h>
+
+#include "common/Compression.hpp"
+#include "common/ResponseCache.hpp"
+
+namespace {
+    constexpr domain::Uuid TEAM = *domain::Uuid::Parse("6f1c8a2e-0b7a-4e1f-9c1d-0b7a8e1f2a3b");
+    constexpr domain::Uuid TOURNAMENT = *domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11");
+
+    std::string inflateBody(const std::string& encoded, int windowBits) {
+        z_stream stream{};
+        inflateInit2(&stream, windowBits);
+        std::string body(1 << 16, '\0');
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(encoded.data()));
+        stream.avail_in = static_cast<uInt>(encoded.size());
+        stream.next_out = reinterpret_cast<Bytef*>(body.data());
+        stream.avail_out = static_cast<uInt>(body.size());
+        inflate(&stream, Z_FINISH);
+        body.resize(stream.total_out);
+        inflateEnd(&stream);
+        return body;
+    }
+
+    std::string teamsBody() {
+        std::string body = "[";
+        for (int i = 0; i < 64; ++i) {
+            body.append(i == 0 ? "" : ",").append(R"({"id":"6f1c2b9e-0000-4000-8000-000000000000","name":"Team"})");
+        }
+        return body.append("]");
+    }
+}
+
+TEST(CompressionTest, NegotiatesTheHighestWeightedCodingItSupports) {
+    EXPECT_EQ(ContentCoding::Identity, negotiateCoding(""));
+    EXPECT_EQ(ContentCoding::Deflate, negotiateCoding("deflate"));
+    EXPECT_EQ(ContentCoding::Gzip, negotiateCoding("deflate;q=0.5, GZIP"));
+    EXPECT_EQ(ContentCoding::Deflate, negotiateCoding("gzip;q=0, *"));
+    EXPECT_EQ(ContentCoding::Identity, negotiateCoding("br, gzip;q=0"));
+    EXPECT_EQ(codingAvailable(ContentCoding::Zstd) ? ContentCoding::Zstd : ContentCoding::Gzip, negotiateCoding("gzip, zstd"));
+}
+
+TEST(CompressionTest, LargeBodyIsEncodedAndRoundTrips) {
+    const ResponseCompression compression(1024);
+    crow::request request;
+    request.add_header(ACCEPT_ENCODING_HEADER, "gzip");
+    crow::response response{crow::OK, teamsBody()};
+    response.add_header(ETAG_HEADER, formatETag(4));
+
+    compression.Apply(request, response);
+
+    EXPECT_EQ("gzip", response.get_header_value(CONTENT_ENCODING_HEADER));
+    EXPECT_EQ("\"4-gzip\"", response.get_header_value(ETAG_HEADER));
+    EXPECT_EQ(ACCEPT_ENCODING_HEADER, response.get_header_value(VARY_HEADER));
+    EXPECT_LT(response.body.size(), teamsBody().size());
+    EXPECT_EQ(teamsBody(), inflateBody(response.body, 15 + 16));
+    EXPECT_EQ(teamsBody(), inflateBody(compression.Encode(teamsBody(), ContentCoding::Deflate), 15));
+}
+
+TEST(CompressionTest, SmallBodiesAndErrorsGoOutAsTheyAre) {
+    const ResponseCompression compression(1024);
+    crow::request request;
+    request.add_header(ACCEPT_ENCODING_HEADER, "gzip");
+
+    crow::response small{crow::OK, R"({"id":"1"})"};
+    compression.Apply(request, small);
+    crow::response error{crow::BAD_REQUEST, teamsBody()};
+    compression.Apply(request, error);
+
+    EXPECT_TRUE(small.get_header_value(CONTENT_ENCODING_HEADER).empty());
+    EXPECT_TRUE(small.get_header_value(VARY_HEADER).empty());
+    EXPECT_EQ(teamsBody(), error.body);
+}
+
+TEST(CompressionTest, CachedBodyIsEncodedOnceForAllHits) {
+    ResponseCache cache(1 << 20, {}, ResponseCompression(1024));
+    cache.Put(groupsCacheKey(TOURNAMENT), 0, teamsBody(), cache.Begin());
+    const std::size_t identityBytes = cache.UsedBytes();
+    crow::request request;
+    request.add_header(ACCEPT_ENCODING_HEADER, "gzip");
+
+    const auto first = cache.Respond(request, groupsCacheKey(TOURNAMENT), *cache.Get(groupsCacheKey(TOURNAMENT)));
+    const auto cached = cache.Get(groupsCacheKey(TOURNAMENT));
+    const auto second = cache.Respond(request, groupsCacheKey(TOURNAMENT), *cached);
+
+    ASSERT_NE(nullptr, cached->encoded[static_cast<std::size_t>(ContentCoding::Gzip) - 1]);
+    EXPECT_EQ(identityBytes + first.body.size(), cache.UsedBytes());
+    EXPECT_EQ(first.body, second.body);
+    EXPECT_EQ("gzip", second.get_header_value(CONTENT_ENCODING_HEADER));
+    EXPECT_EQ(teamsBody(), inflateBody(second.body, 15 + 16));
+}
+
+TEST(CompressionTest, EncodedCopyOfAReplacedBodyIsDropped) {
+    ResponseCache cache(1 << 20, {}, ResponseCompression(1024));
+    cache.Put(groupsCacheKey(TOURNAMENT), 0, teamsBody(), cache.Begin());
+    const auto stale = cache.Get(groupsCacheKey(TOURNAMENT));
+    cache.Invalidate(groupsCacheKey(TOURNAMENT));
+    cache.Put(groupsCacheKey(TOURNAMENT), 0, teamsBody() + " ", cache.Begin());
+
+    cache.PutEncoded(groupsCacheKey(TOURNAMENT), stale->body, ContentCoding::Gzip,
+                     std::make_shared<const std::string>(ResponseCompression(1024).Encode(*stale->body, ContentCoding::Gzip)));
+
+    EXPECT_EQ(nullptr, cache.Get(groupsCacheKey(TOURNAMENT))->encoded[static_cast<std::size_t>(ContentCoding::Gzip) - 1]);
+}
+
+TEST(CompressionTest, EachCodingHasItsOwnETag) {
+    ResponseCache cache(1 << 20, {}, ResponseCompression(1024));
+    cache.Put(teamCacheKey(TEAM), 7, teamsBody(), cache.Begin());
+    crow::request gzip;
+    gzip.add_header(ACCEPT_ENCODING_HEADER, "gzip");
+    crow::request revalidateGzip;
+    revalidateGzip.add_header(ACCEPT_ENCODING_HEADER, "gzip");
+    revalidateGzip.add_header(IF_NONE_MATCH_HEADER, "\"7-gzip\"");
+    crow::request revalidateIdentity;
+    revalidateIdentity.add_header(IF_NONE_MATCH_HEADER, "\"7-gzip\"");
+
+    const auto encoded = cache.Respond(gzip, teamCacheKey(TEAM), *cache.Get(teamCacheKey(TEAM)));
+    const auto notModified = cache.Respond(revalidateGzip, teamCacheKey(TEAM), *cache.Get(teamCacheKey(TEAM)));
+    const auto identity = cache.Respond(revalidateIdentity, teamCacheKey(TEAM), *cache.Get(teamCacheKey(TEAM)));
+
+    EXPECT_EQ("\"7-gzip\"", encoded.get_header_value(ETAG_HEADER));
+    EXPECT_EQ(crow::NOT_MODIFIED, notModified.code);
+    EXPECT_EQ("\"7-gzip\"", notModified.get_header_value(ETAG_HEADER));
+    EXPECT_EQ("Accept, Accept-Encoding", notModified.get_header_value(VARY_HEADER));
+    EXPECT_EQ(crow::OK, identity.code);
+    EXPECT_EQ("\"7\"", identity.get_header_value(ETAG_HEADER));
+    EXPECT_EQ(teamsBody(), identity.body);
+}
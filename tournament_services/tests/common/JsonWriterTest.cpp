@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "common/JsonWriter.hpp"
+#include "domain/Utilities.hpp"
+
+namespace {
+    constexpr domain::Uuid GROUP = *domain::Uuid::Parse("9b2f4c1a-3e5d-4f6a-8b7c-1d2e3f4a5b6c");
+    constexpr domain::Uuid TOURNAMENT = *domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11");
+    constexpr domain::Uuid BEARS = *domain::Uuid::Parse("00000000-0000-4000-8000-000000000001");
+    constexpr domain::Uuid LIONS = *domain::Uuid::Parse("00000000-0000-4000-8000-000000000002");
+
+    template<typename T>
+    std::string write(const T& value) {
+        std::string out;
+        JsonWriter(out).Write(value);
+        return out;
+    }
+}
+
+TEST(JsonWriterTest, GroupsMatchTheDomDump) {
+    auto group = std::make_shared<domain::Group>("Group A", GROUP);
+    group->TournamentId() = TOURNAMENT;
+    group->Teams().push_back({BEARS, "Bears"});
+    group->Teams().push_back({LIONS, "Lions"});
+    const std::vector groups{group, std::make_shared<domain::Group>("Group B")};
+
+    nlohmann::json expected = groups;
+    EXPECT_EQ(expected.dump(), write(groups));
+}
+
+TEST(JsonWriterTest, TeamsInGroupsKeepAnEmptyId) {
+    auto group = std::make_shared<domain::Group>("Group A", GROUP);
+    group->TournamentId() = TOURNAMENT;
+    group->Teams().push_back({{}, "Bears"});
+
+    nlohmann::json expected = group;
+    EXPECT_EQ(expected.dump(), write(group));
+    EXPECT_NE(std::string::npos, write(group).find(R"({"id":"","name":"Bears"})"));
+}
+
+TEST(JsonWriterTest, TournamentsAndTeamsMatchTheDomDump) {
+    auto tournament = std::make_shared<domain::Tournament>("Cup", domain::TournamentFormat(2, 8, domain::TournamentType::ROUND_ROBIN));
+    tournament->Id() = TOURNAMENT;
+    nlohmann::json expectedTournament = tournament;
+    EXPECT_EQ(expectedTournament.dump(), write(tournament));
+
+    const std::vector teams{std::make_shared<domain::Team>(domain::Team{BEARS, "Bears"}), std::make_shared<domain::Team>(domain::Team{{}, "Lions"})};
+    nlohmann::json expectedTeams = teams;
+    EXPECT_EQ(expectedTeams.dump(), write(teams));
+
+    const std::vector standings{domain::Standing{BEARS, "Bears", 3, 1, 0, -7}};
+    nlohmann::json expectedStandings = standings;
+    EXPECT_EQ(expectedStandings.dump(), write(standings));
+}
+
+TEST(JsonWriterTest, StringsAreEscapedLikeTheDomDump) {
+    const std::string name = "quote\" slash\\ tab\t newline\n bell\x07 caf\xC3\xA9";
+    EXPECT_EQ(nlohmann::json(name).dump(), write(name));
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "common/RequestDecoder.hpp"
+#include "domain/Group.hpp"
+
+namespace {
+    constexpr RequestSchema schema{std::array{
+        FieldRule<domain::Group>{.name = "name", .required = true, .minLength = 1,
+            .text = [](domain::Group& group, std::string_view name) { group.Name() = name; }},
+        FieldRule<domain::Group>{.name = "teams", .kind = FieldKind::Array,
+            .element = [](domain::Group& group) { group.Teams().emplace_back(); }},
+        FieldRule<domain::Group>{.kind = FieldKind::Object, .parent = 1},
+        FieldRule<domain::Group>{.name = "id", .parent = 2, .required = true,
+            .id = [](domain::Group& group, const domain::Uuid& id) { group.Teams().back().Id = id; }},
+        FieldRule<domain::Group>{.name = "size", .kind = FieldKind::Integer, .minimum = 1, .maximum = 8},
+        FieldRule<domain::Group>{.name = "kind", .oneOf = {"A", "B"}},
+    }};
+}
+
+TEST(RequestDecoderTest, ValidBodyDecodesInOnePass) {
+    const auto group = decodeRequest(R"({"name":"Group A","unknown":{"nested":[1,2]},"teams":[{"id":"00000000-0000-4000-8000-000000000001"},{"id":"00000000-0000-4000-8000-000000000002"}],"size":4,"kind":"B"})", schema);
+
+    ASSERT_TRUE(group.has_value());
+    EXPECT_EQ("Group A", group->Name());
+    ASSERT_EQ(2, group->Teams().size());
+    EXPECT_EQ("00000000-0000-4000-8000-000000000002", group->Teams()[1].Id.ToString());
+}
+
+TEST(RequestDecoderTest, EveryViolationIsReportedWithItsPath) {
+    const auto group = decodeRequest(R"({"teams":[{"id":"00000000-0000-4000-8000-000000000001"},{},"t-3"],"size":12,"kind":"C","name":null})", schema);
+
+    ASSERT_FALSE(group.has_value());
+    const auto& violations = group.error().violations;
+    ASSERT_EQ(5, violations.size());
+    EXPECT_EQ("teams[1].id", violations[0].field);
+    EXPECT_EQ("is required", violations[0].message);
+    EXPECT_EQ("teams[2]", violations[1].field);
+    EXPECT_EQ("must be an object", violations[1].message);
+    EXPECT_EQ("size", violations[2].field);
+    EXPECT_EQ("must be between 1 and 8", violations[2].message);
+    EXPECT_EQ("kind", violations[3].field);
+    EXPECT_EQ("must be one of A, B", violations[3].message);
+    EXPECT_EQ("name", violations[4].field);
+    EXPECT_EQ("is required", violations[4].message);
+}
+
+TEST(RequestDecoderTest, MalformedOrNonObjectBodiesAreRejected) {
+    const auto malformed = decodeRequest(R"({"name":)", schema);
+    ASSERT_FALSE(malformed.has_value());
+    EXPECT_EQ("Invalid JSON body", malformed.error().error);
+
+    const auto array = decodeRequest(R"(["Group A"])", schema);
+    ASSERT_FALSE(array.has_value());
+    EXPECT_EQ("body must be a JSON object", array.error().violations[0].message);
+}
+
+TEST(RequestDecoderTest, BadRequestCarriesTheViolationsAsJson) {
+    const auto response = badRequest(decodeRequest(R"({"name":""})", schema).error());
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+    const auto body = nlohmann::json::parse(response.body);
+    EXPECT_EQ("Invalid request body", body["error"]);
+    EXPECT_EQ("name", body["violations"][0]["field"]);
+    EXPECT_EQ("must not be empty", body["violations"][0]["message"]);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <format>
+#include <string>
+#include <thread>
+
+#include "common/ResponseCache.hpp"
+
+namespace {
+    constexpr domain::Uuid TEAM = *domain::Uuid::Parse("6f1c8a2e-0b7a-4e1f-9c1d-0b7a8e1f2a3b");
+    constexpr domain::Uuid TOURNAMENT = *domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11");
+    constexpr domain::Uuid OTHER_TOURNAMENT = *domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a12");
+    constexpr domain::Uuid GROUP = *domain::Uuid::Parse("9b2f4c1a-3e5d-4f6a-8b7c-1d2e3f4a5b6c");
+
+    domain::Uuid teamId(int n) {
+        return domain::Uuid::Parse(std::format("00000000-0000-4000-8000-{:012}", n)).value();
+    }
+}
+
+TEST(ResponseCacheTest, HitReturnsTheStoredBodyAndVersion) {
+    ResponseCache cache(1 << 16);
+    EXPECT_FALSE(cache.Get(teamCacheKey(TEAM)).has_value());
+
+    cache.Put(teamCacheKey(TEAM), 7, R"({"name":"Bears"})", cache.Begin());
+
+    const auto cached = cache.Get(teamCacheKey(TEAM));
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_EQ(7, cached->version);
+    EXPECT_EQ(R"({"name":"Bears"})", *cached->body);
+}
+
+TEST(ResponseCacheTest, IdsInEitherCaseShareOneEntry) {
+    ResponseCache cache(1 << 16);
+    const auto upper = domain::Uuid::Parse("6F1C8A2E-0B7A-4E1F-9C1D-0B7A8E1F2A3B").value();
+    const auto lower = domain::Uuid::Parse("6f1c8a2e-0b7a-4e1f-9c1d-0b7a8e1f2a3b").value();
+    cache.Put(teamCacheKey(upper), 3, "{}", cache.Begin());
+
+    EXPECT_TRUE(cache.Get(teamCacheKey(lower)).has_value());
+    cache.Invalidate(teamCacheKey(lower));
+    EXPECT_FALSE(cache.Get(teamCacheKey(upper)).has_value());
+}
+
+TEST(ResponseCacheTest, EmptyKeyIsNotCached) {
+    ResponseCache cache(1 << 16);
+    cache.Put(CacheKey(), 1, "{}", cache.Begin());
+
+    EXPECT_FALSE(cache.Get(CacheKey()).has_value());
+    EXPECT_EQ(0u, cache.UsedBytes());
+}
+
+TEST(ResponseCacheTest, EntriesExpireAfterMaxAge) {
+    ResponseCache cache(1 << 16, {}, ResponseCompression(), std::chrono::milliseconds(5));
+    cache.Put(teamCacheKey(TEAM), 1, "{}", cache.Begin());
+    EXPECT_TRUE(cache.Get(teamCacheKey(TEAM)).has_value());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    EXPECT_FALSE(cache.Get(teamCacheKey(TEAM)).has_value());
+}
+
+TEST(ResponseCacheTest, DisabledCacheStoresNothing) {
+    ResponseCache cache;
+    cache.Put(teamCacheKey(TEAM), 1, "{}", cache.Begin());
+
+    EXPECT_FALSE(cache.Enabled());
+    EXPECT_FALSE(cache.Get(teamCacheKey(TEAM)).has_value());
+}
+
+TEST(ResponseCacheTest, ReadThatRacedAWriteIsNotCached) {
+    ResponseCache cache(1 << 16);
+    const auto ticket = cache.Begin();
+    cache.Invalidate(teamCacheKey(TEAM));
+
+    cache.Put(teamCacheKey(TEAM), 1, "{}", ticket);
+
+    EXPECT_FALSE(cache.Get(teamCacheKey(TEAM)).has_value());
+}
+
+TEST(ResponseCacheTest, InvalidationGuardDropsTheTournamentSubtree) {
+    ResponseCache cache(1 << 16);
+    cache.Put(tournamentCacheKey(TOURNAMENT), 1, "{}", cache.Begin());
+    cache.Put(groupsCacheKey(TOURNAMENT), 0, "[]", cache.Begin());
+    cache.Put(groupCacheKey(TOURNAMENT, GROUP), 2, "{}", cache.Begin());
+    cache.Put(tournamentCacheKey(OTHER_TOURNAMENT), 1, "{}", cache.Begin());
+
+    {
+        ResponseCache::Invalidation invalidation(cache, {tournamentCacheKey(TOURNAMENT)}, true);
+        EXPECT_TRUE(cache.Get(groupCacheKey(TOURNAMENT, GROUP)).has_value());
+    }
+
+    EXPECT_FALSE(cache.Get(tournamentCacheKey(TOURNAMENT)).has_value());
+    EXPECT_FALSE(cache.Get(groupsCacheKey(TOURNAMENT)).has_value());
+    EXPECT_FALSE(cache.Get(groupCacheKey(TOURNAMENT, GROUP)).has_value());
+    EXPECT_TRUE(cache.Get(tournamentCacheKey(OTHER_TOURNAMENT)).has_value());
+}
+
+TEST(ResponseCacheTest, ClockKeepsRecentlyReadEntriesWithinTheBudget) {
+    // room for four entries of this size, the fifth has to evict one
+    const std::string body(400, 'x');
+    ResponseCache cache(2200);
+    for (int id = 1; id <= 4; ++id) {
+        cache.Put(teamCacheKey(teamId(id)), 1, body, cache.Begin());
+    }
+    ASSERT_TRUE(cache.Get(teamCacheKey(teamId(1))).has_value());
+
+    cache.Put(teamCacheKey(teamId(5)), 1, body, cache.Begin());
+
+    EXPECT_LE(cache.UsedBytes(), 2200u);
+    EXPECT_TRUE(cache.Get(teamCacheKey(teamId(1))).has_value());
+    EXPECT_TRUE(cache.Get(teamCacheKey(teamId(5))).has_value());
+    int kept = 0;
+    for (int id = 2; id <= 4; ++id) {
+        kept += cache.Get(teamCacheKey(teamId(id))).has_value();
+    }
+    EXPECT_EQ(2, kept);
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "common/JsonWriter.hpp"
+#include "common/WireFormat.hpp"
+#include "domain/Utilities.hpp"
+
+TEST(WireFormatTest, BinaryOnlyWhenTheClientWeighsItAtLeastAsHighAsJson) {
+    EXPECT_EQ(WireFormat::Json, acceptedFormat(""));
+    EXPECT_EQ(WireFormat::Json, acceptedFormat("*/*"));
+    EXPECT_EQ(WireFormat::MessagePack, acceptedFormat("application/msgpack"));
+    EXPECT_EQ(WireFormat::MessagePack, acceptedFormat("application/x-msgpack, */*"));
+    EXPECT_EQ(WireFormat::Cbor, acceptedFormat("application/json;q=0.5, application/cbor"));
+    EXPECT_EQ(WireFormat::Json, acceptedFormat("application/cbor;q=0.4, application/json"));
+}
+
+TEST(WireFormatTest, JsonResponseIsReencodedInTheAcceptedFormat) {
+    const domain::Team team{domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000001").value(), "Bears"};
+    crow::request request;
+    request.add_header("Accept", "application/msgpack");
+    auto response = jsonResponse(crow::OK, team);
+    response.add_header("content-type", "application/json");
+
+    encodeResponse(request, response);
+
+    EXPECT_EQ("application/msgpack", response.get_header_value("content-type"));
+    EXPECT_EQ("Accept", response.get_header_value("Vary"));
+    const auto decoded = nlohmann::json::from_msgpack(response.body);
+    EXPECT_EQ(team.Id.ToString(), decoded["id"]);
+    EXPECT_EQ(team.Name, decoded["name"]);
+    EXPECT_EQ(nlohmann::json(team), decoded);
+}
+
+TEST(WireFormatTest, NestedJsonIsTranslatedItemByItem) {
+    const std::string body = R"({"a":[1,-40,300,70000,-5000000000,[]],"b":{"c":true,"d":null,"e":1.5},"f":"x"})";
+    for (const auto* accept : {"application/msgpack", "application/cbor"}) {
+        crow::request request;
+        request.add_header("Accept", accept);
+        crow::response response{crow::OK, body};
+        response.add_header("content-type", "application/json");
+
+        encodeResponse(request, response);
+
+        const auto decoded = std::string_view(accept) == "application/msgpack"
+            ? nlohmann::json::from_msgpack(response.body)
+            : nlohmann::json::from_cbor(response.body);
+        EXPECT_EQ(nlohmann::json::parse(body), decoded) << accept;
+    }
+}
+
+TEST(WireFormatTest, DescriptorsWriteTheBytesOfTheDocument) {
+    const std::vector<domain::Team> teams{{domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000001").value(), "Bears"}, {domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000002").value(), "Lions"}};
+    crow::request msgpack;
+    msgpack.add_header("Accept", "application/msgpack");
+    crow::request cbor;
+    cbor.add_header("Accept", "application/cbor");
+
+    const auto packed = wireResponse(msgpack, crow::OK, teams);
+    const auto tagged = wireResponse(cbor, crow::OK, teams);
+
+    const auto expectedPacked = nlohmann::json::to_msgpack(nlohmann::json(teams));
+    const auto expectedTagged = nlohmann::json::to_cbor(nlohmann::json(teams));
+    EXPECT_EQ(std::string(expectedPacked.begin(), expectedPacked.end()), packed.body);
+    EXPECT_EQ(std::string(expectedTagged.begin(), expectedTagged.end()), tagged.body);
+    EXPECT_EQ("application/msgpack", packed.get_header_value("content-type"));
+    EXPECT_EQ("Accept", tagged.get_header_value("Vary"));
+}
+
+TEST(WireFormatTest, EachFormatHasItsOwnETag) {
+    crow::request request;
+    request.add_header("Accept", "application/cbor");
+    crow::response response{crow::OK, R"({"id":"t-1"})"};
+    response.add_header("content-type", "application/json");
+    response.add_header(ETAG_HEADER, formatETag(3));
+
+    encodeResponse(request, response);
+
+    EXPECT_EQ("\"3-cbor\"", response.get_header_value(ETAG_HEADER));
+    EXPECT_EQ(std::optional<std::int64_t>(3), parseETag(response.get_header_value(ETAG_HEADER), true));
+}
+
+TEST(WireFormatTest, TextResponsesAreLeftAlone) {
+    crow::request request;
+    request.add_header("Accept", "application/cbor");
+    crow::response response{crow::NOT_FOUND, "Team not found"};
+
+    encodeResponse(request, response);
+
+    EXPECT_EQ("Team not found", response.body);
+    EXPECT_TRUE(response.get_header_value("Vary").empty());
+}
+
+TEST(WireFormatTest, BinaryRequestBodyReachesControllersAsJson) {
+    crow::request request;
+    request.add_header("content-type", "application/cbor");
+    const auto cbor = nlohmann::json::to_cbor(nlohmann::json{{"name", "Bears"}});
+    request.body.assign(cbor.begin(), cbor.end());
+
+    const auto decoded = jsonRequest(request);
+
+    ASSERT_TRUE(decoded.has_value());
+    ASSERT_NE(nullptr, *decoded);
+    EXPECT_EQ(R"({"name":"Bears"})", (*decoded)->body);
+    EXPECT_EQ("application/json", (*decoded)->get_header_value("content-type"));
+}
+
+TEST(WireFormatTest, JsonBodyPassesThroughAndMalformedBinaryIs400) {
+    crow::request json;
+    json.add_header("content-type", "application/json");
+    json.body = R"({"name":"Bears"})";
+    const auto passthrough = jsonRequest(json);
+    ASSERT_TRUE(passthrough.has_value());
+    EXPECT_EQ(nullptr, *passthrough);
+
+    crow::request broken;
+    broken.add_header("content-type", "application/msgpack");
+    broken.body = "\xc1";
+    const auto rejected = jsonRequest(broken);
+    ASSERT_FALSE(rejected.has_value());
+    EXPECT_EQ(crow::BAD_REQUEST, rejected.error().code);
+}
+
+TEST(WireFormatTest, BinaryStringThatIsNotUtf8Is400) {
+    crow::request request;
+    request.add_header("content-type", "application/msgpack");
+    // {"name": "\xff\xfe"}
+    request.body = std::string("\x81\xa4name\xa2\xff\xfe", 9);
+
+    const auto rejected = jsonRequest(request);
+
+    ASSERT_FALSE(rejected.has_value());
+    EXPECT_EQ(crow::BAD_REQUEST, rejected.error().code);
+}
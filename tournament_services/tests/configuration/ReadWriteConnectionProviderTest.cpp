@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "configuration/RouteDefinition.hpp"
+#include "persistence/async/ReadWriteQueryExecutor.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/ReadWriteConnectionProvider.hpp"
+#include "persistence/configuration/ReadYourWrites.hpp"
+
+class DbConnectionProviderMock : public IDbConnectionProvider {
+public:
+    MOCK_METHOD(PooledConnection, Connection, (ConnectionIntent intent), (override));
+    MOCK_METHOD(PoolMetrics, Metrics, (), (override));
+};
+
+class FakeConnection : public IDbConnection {};
+
+class AsyncQueryExecutorMock : public IAsyncQueryExecutor {
+public:
+    MOCK_METHOD(void, Submit, (PendingQuery& query), (override));
+};
+
+class ReadWriteConnectionProviderTest : public ::testing::Test {
+protected:
+    std::shared_ptr<DbConnectionProviderMock> primaryMock;
+    std::shared_ptr<DbConnectionProviderMock> replicaMock;
+    FakeConnection primaryConnection;
+    FakeConnection replicaConnection;
+
+    void SetUp() override {
+        primaryMock = std::make_shared<DbConnectionProviderMock>();
+        replicaMock = std::make_shared<DbConnectionProviderMock>();
+        ON_CALL(*primaryMock, Connection(::testing::_))
+            .WillByDefault([this](ConnectionIntent) { return PooledConnection(&primaryConnection, [](IDbConnection*) {}); });
+        ON_CALL(*replicaMock, Connection(::testing::_))
+            .WillByDefault([this](ConnectionIntent) { return PooledConnection(&replicaConnection, [](IDbConnection*) {}); });
+    }
+
+    ReadWriteConnectionProvider provider(std::chrono::milliseconds window) {
+        return ReadWriteConnectionProvider(primaryMock, replicaMock, window);
+    }
+};
+
+TEST_F(ReadWriteConnectionProviderTest, ReadsGoToReplicaAndWritesToPrimary) {
+    ReadYourWrites readYourWrites;
+    ReadYourWrites::Scope scope(&readYourWrites);
+    auto split = provider(std::chrono::milliseconds(0));
+    EXPECT_CALL(*replicaMock, Connection(ConnectionIntent::Read)).Times(1);
+    EXPECT_CALL(*primaryMock, Connection(ConnectionIntent::Write)).Times(1);
+
+    auto read = split.Connection(ConnectionIntent::Read);
+    auto write = split.Connection(ConnectionIntent::Write);
+
+    EXPECT_EQ(&replicaConnection, &*read);
+    EXPECT_EQ(&primaryConnection, &*write);
+}
+
+TEST_F(ReadWriteConnectionProviderTest, ReadAfterWriteStaysOnPrimaryWithinWindow) {
+    ReadYourWrites readYourWrites;
+    ReadYourWrites::Scope scope(&readYourWrites);
+    auto split = provider(std::chrono::minutes(1));
+    EXPECT_CALL(*primaryMock, Connection(::testing::_)).Times(2);
+    EXPECT_CALL(*replicaMock, Connection(::testing::_)).Times(0);
+
+    auto write = split.Connection(ConnectionIntent::Write);
+    auto read = split.Connection(ConnectionIntent::Read);
+
+    EXPECT_EQ(&primaryConnection, &*read);
+}
+
+TEST_F(ReadWriteConnectionProviderTest, ReadAfterWindowGoesBackToReplica) {
+    ReadYourWrites readYourWrites;
+    ReadYourWrites::Scope scope(&readYourWrites);
+    auto split = provider(std::chrono::milliseconds(5));
+    EXPECT_CALL(*primaryMock, Connection(ConnectionIntent::Write)).Times(1);
+    EXPECT_CALL(*replicaMock, Connection(ConnectionIntent::Read)).Times(1);
+
+    split.Connection(ConnectionIntent::Write);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    auto read = split.Connection(ConnectionIntent::Read);
+
+    EXPECT_EQ(&replicaConnection, &*read);
+}
+
+TEST_F(ReadWriteConnectionProviderTest, PinHandedToTheClientKeepsItsNextRequestOnPrimary) {
+    auto split = provider(std::chrono::minutes(1));
+    EXPECT_CALL(*primaryMock, Connection(::testing::_)).Times(2);
+    EXPECT_CALL(*replicaMock, Connection(::testing::_)).Times(0);
+
+    crow::response written;
+    {
+        ReadYourWrites post;
+        ReadYourWrites::Scope scope(&post);
+        split.Connection(ConnectionIntent::Write);
+        ASSERT_TRUE(post.Wrote());
+        pinClient(written, post);
+    }
+
+    const std::string& setCookie = written.get_header_value("Set-Cookie");
+    ASSERT_TRUE(setCookie.starts_with(READ_YOUR_WRITES_COOKIE "="));
+    crow::request get;
+    get.add_header("Cookie", "theme=dark; " + setCookie.substr(0, setCookie.find(';')));
+    ReadYourWrites next(readYourWritesPin(get));
+    ReadYourWrites::Scope scope(&next);
+    auto read = split.Connection(ConnectionIntent::Read);
+
+    EXPECT_EQ(&primaryConnection, &*read);
+}
+
+TEST_F(ReadWriteConnectionProviderTest, RequestWithoutPinReadsReplica) {
+    auto split = provider(std::chrono::minutes(1));
+    EXPECT_CALL(*replicaMock, Connection(ConnectionIntent::Read)).Times(1);
+
+    crow::request get;
+    get.add_header("Cookie", READ_YOUR_WRITES_COOKIE "=not-a-time");
+    ReadYourWrites readYourWrites(readYourWritesPin(get));
+    ReadYourWrites::Scope scope(&readYourWrites);
+    auto read = split.Connection(ConnectionIntent::Read);
+
+    EXPECT_EQ(&replicaConnection, &*read);
+    crow::response response;
+    pinClient(response, readYourWrites);
+    EXPECT_TRUE(response.get_header_value("Set-Cookie").empty());
+}
+
+TEST_F(ReadWriteConnectionProviderTest, AsyncReadsGoToReplicaUntilTheRequestWrites) {
+    auto primaryExecutor = std::make_shared<AsyncQueryExecutorMock>();
+    auto replicaExecutor = std::make_shared<AsyncQueryExecutorMock>();
+    ReadWriteQueryExecutor split(primaryExecutor, replicaExecutor, std::chrono::minutes(1));
+    ReadYourWrites readYourWrites;
+    ReadYourWrites::Scope scope(&readYourWrites);
+    PendingQuery read{};
+    PendingQuery write{};
+    write.intent = ConnectionIntent::Write;
+
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(*replicaExecutor, Submit(testing::Ref(read)));
+        EXPECT_CALL(*primaryExecutor, Submit(testing::Ref(write)));
+        EXPECT_CALL(*primaryExecutor, Submit(testing::Ref(read)));
+    }
+
+    split.Submit(read);
+    split.Submit(write);
+    split.Submit(read);
+}
+
+TEST_F(ReadWriteConnectionProviderTest, MetricsAddBothPools) {
+    auto split = provider(std::chrono::milliseconds(0));
+    PoolMetrics primaryMetrics;
+    primaryMetrics.poolSize = 4;
+    primaryMetrics.checkouts = 10;
+    PoolMetrics replicaMetrics;
+    replicaMetrics.poolSize = 8;
+    replicaMetrics.checkouts = 30;
+    EXPECT_CALL(*primaryMock, Metrics()).WillOnce(testing::Return(primaryMetrics));
+    EXPECT_CALL(*replicaMock, Metrics()).WillOnce(testing::Return(replicaMetrics));
+
+    const PoolMetrics metrics = split.Metrics();
+
+    EXPECT_EQ(12, metrics.poolSize);
+    EXPECT_EQ(40, metrics.checkouts);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <string>
+
+#include "persistence/async/QueryResult.hpp"
+#include "persistence/configuration/RequestArena.hpp"
+
+TEST(RequestArenaTest, QueryResultIsAllocatedFromTheArena) {
+    RequestArena arena;
+    {
+        QueryResult result(&arena);
+        result.Reserve(2, 2);
+        result.AddColumn("id");
+        result.AddColumn("document");
+        result.AddCell("6f1c2b9e-0000-4000-8000-000000000001");
+        result.AddCell(R"({"name": "Group A", "teams": [{"id": "6f1c2b9e-0000-4000-8000-000000000002", "name": "Bears"}]})");
+        result.AddCell("6f1c2b9e-0000-4000-8000-000000000003");
+        result.AddCell(std::nullopt);
+
+        ASSERT_EQ(2, result.Size());
+        EXPECT_EQ("6f1c2b9e-0000-4000-8000-000000000003", result.Text(1, "id"));
+        EXPECT_TRUE(result.IsNull(1, "document"));
+        EXPECT_THROW(result.Text(2, "id"), std::out_of_range);
+    }
+
+    EXPECT_GE(arena.Allocations(), 5);
+    EXPECT_EQ(1, arena.Blocks());
+}
+
+TEST(RequestArenaTest, ScopeRestoresTheEnclosingArena) {
+    EXPECT_EQ(nullptr, RequestArena::Active());
+    EXPECT_EQ(std::pmr::get_default_resource(), RequestArena::Current());
+
+    RequestArena outer;
+    RequestArena inner;
+    {
+        RequestArena::Scope outerScope(&outer);
+        {
+            RequestArena::Scope innerScope(&inner);
+            EXPECT_EQ(&inner, RequestArena::Current());
+        }
+        EXPECT_EQ(&outer, RequestArena::Active());
+    }
+    EXPECT_EQ(nullptr, RequestArena::Active());
+}
+
+TEST(RequestArenaTest, ReleasedArenaIsCountedInTheTotals) {
+    const RequestArena::Stats before = RequestArena::Totals();
+    {
+        RequestArena arena;
+        std::pmr::string body(256, 'x', &arena);
+    }
+    const RequestArena::Stats after = RequestArena::Totals();
+
+    EXPECT_EQ(before.requests + 1, after.requests);
+    EXPECT_EQ(before.allocations + 1, after.allocations);
+    EXPECT_EQ(before.blocks + 1, after.blocks);
+    EXPECT_LE(before.bytes + 257, after.bytes);
+}
+
+TEST(RequestArenaTest, HeapAllocationsAreCountedOnceForTheArenaInScope) {
+    RequestArena arena;
+    {
+        RequestArena::Scope scope(&arena);
+        RequestArena::CountHeapAllocation();
+        {
+            // a query resuming inline sets the same arena again
+            RequestArena::Scope resumed(&arena);
+            RequestArena::CountHeapAllocation();
+        }
+    }
+    RequestArena::CountHeapAllocation();
+
+    EXPECT_EQ(2, arena.HeapAllocations());
+}
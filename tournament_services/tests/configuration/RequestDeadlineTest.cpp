@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+
+#include "configuration/RouteDefinition.hpp"
+#include "persistence/async/QueryResult.hpp"
+#include "persistence/configuration/RequestDeadline.hpp"
+
+using namespace std::chrono_literals;
+
+TEST(RequestDeadlineTest, ConfiguredBudgetSetsTheDeadline) {
+    const auto before = RequestDeadline::Clock::now();
+    const auto deadline = requestDeadline(crow::request{}, 500ms);
+
+    ASSERT_TRUE(deadline.has_value());
+    EXPECT_GE(*deadline, before + 500ms);
+    EXPECT_LE(*deadline, RequestDeadline::Clock::now() + 500ms);
+}
+
+TEST(RequestDeadlineTest, HeaderShortensButNeverExtendsTheBudget) {
+    crow::request shorter;
+    shorter.add_header("X-Request-Timeout", "50");
+    const auto shortened = requestDeadline(shorter, 500ms);
+    EXPECT_LE(*shortened, RequestDeadline::Clock::now() + 50ms);
+
+    crow::request longer;
+    longer.add_header("X-Request-Timeout", "60000");
+    const auto capped = requestDeadline(longer, 500ms);
+    EXPECT_LE(*capped, RequestDeadline::Clock::now() + 500ms);
+}
+
+TEST(RequestDeadlineTest, NoBudgetAndNoValidHeaderMeansNoDeadline) {
+    EXPECT_FALSE(requestDeadline(crow::request{}, 0ms).has_value());
+
+    crow::request malformed;
+    malformed.add_header("X-Request-Timeout", "soon");
+    EXPECT_FALSE(requestDeadline(malformed, 0ms).has_value());
+
+    crow::request headerOnly;
+    headerOnly.add_header("X-Request-Timeout", "250");
+    EXPECT_TRUE(requestDeadline(headerOnly, 0ms).has_value());
+}
+
+TEST(RequestDeadlineTest, ScopeRestoresTheEnclosingDeadline) {
+    const auto outer = RequestDeadline::Clock::now() + 1s;
+    RequestDeadline::Scope request(outer);
+    {
+        RequestDeadline::Scope resumed(RequestDeadline::Clock::now() - 1ms);
+        EXPECT_TRUE(RequestDeadline::Expired());
+    }
+    EXPECT_EQ(outer, RequestDeadline::Current());
+    EXPECT_FALSE(RequestDeadline::Expired());
+    EXPECT_LE(RequestDeadline::Bound(1h), outer);
+}
+
+TEST(RequestDeadlineTest, CancelledStatementsAndExpiredRequestsAnswer504) {
+    EXPECT_EQ(crow::GATEWAY_TIMEOUT, asyncFailure(std::make_exception_ptr(QueryException("canceling statement", "57014"))).code);
+    EXPECT_EQ(crow::GATEWAY_TIMEOUT, asyncFailure(std::make_exception_ptr(DeadlineExceededException())).code);
+    EXPECT_EQ(crow::SERVICE_UNAVAILABLE, asyncFailure(std::make_exception_ptr(ConnectionUnavailableException())).code);
+
+    EXPECT_FALSE(deadlineExceeded(std::runtime_error("boom")));
+    RequestDeadline::Scope expired(RequestDeadline::Clock::now() - 1ms);
+    EXPECT_TRUE(deadlineExceeded(std::runtime_error("boom")));
+}
@@ -0,0 +1,54 @@
+//
+// Created by root on 10/16/26.
+//
+
+#ifndef TOURNAMENTS_ROUTEHARNESS_HPP
+#define TOURNAMENTS_ROUTEHARNESS_HPP
+
+#include <algorithm>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <crow.h>
+#include <Hypodermic/Hypodermic.h>
+
+#include "common/Compression.hpp"
+#include "configuration/RouteDefinition.hpp"
+#include "configuration/RunConfiguration.hpp"
+
+// Runs requests through the routes REGISTER_ROUTE and REGISTER_ASYNC_ROUTE registered for the given paths,
+// wrapper included, with the controller under test where the service would resolve its own. The paths are
+// in Crow's syntax, as the registry holds them, and must all belong to Controller.
+template<typename Controller>
+class RouteHarness {
+    crow::SimpleApp app;
+
+public:
+    RouteHarness(std::shared_ptr<Controller> controller, std::initializer_list<std::string_view> paths) {
+        Hypodermic::ContainerBuilder builder;
+        builder.registerInstance(std::make_shared<config::RunConfiguration>());
+        builder.registerInstance(std::make_shared<ResponseCompression>());
+        builder.registerInstance(std::move(controller));
+        const std::shared_ptr<Hypodermic::Container> container = builder.build();
+
+        for (auto& route : routeRegistry()) {
+            if (std::ranges::find(paths, std::string_view(route.path)) != paths.end()) {
+                route.binder(app, container);
+            }
+        }
+        app.validate();
+    }
+
+    crow::response Handle(crow::HTTPMethod method, std::string url) {
+        crow::request request;
+        request.method = method;
+        request.url = std::move(url);
+        crow::response response;
+        app.handle_full(request, response);
+        return response;
+    }
+};
+
+#endif //TOURNAMENTS_ROUTEHARNESS_HPP
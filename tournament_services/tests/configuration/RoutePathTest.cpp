@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include "configuration/RoutePath.hpp"
+
+namespace {
+    struct GroupsProbe {
+        int Get(const crow::request&, const domain::Uuid&, const domain::Uuid&) const { return 0; }
+        int List(const domain::Uuid&) const { return 0; }
+        int Open(const std::string&) const { return 0; }
+        int Page(std::int64_t) const { return 0; }
+    };
+
+    using GroupRoute = RoutePath<"/tournaments/<uuid>/groups/<uuid>">;
+}
+
+TEST(RoutePathTest, UuidPlaceholdersReachCrowAsStrings) {
+    EXPECT_EQ("/tournaments/<string>/groups/<string>", std::string_view(GroupRoute::crow.value));
+    EXPECT_EQ("/teams", std::string_view(RoutePath<"/teams">::crow.value));
+    ASSERT_EQ(2, GroupRoute::parameters.size());
+    EXPECT_EQ(PathParameter::Uuid, GroupRoute::parameters[1]);
+    EXPECT_EQ(PathParameter::Int, RoutePath<"/pages/<int>">::parameters[0]);
+}
+
+TEST(RoutePathTest, ControllerMethodMustTakeTheDeclaredParameters) {
+    static_assert(GroupRoute::Accepts<GroupsProbe, decltype(&GroupsProbe::Get)>);
+    static_assert(!GroupRoute::Accepts<GroupsProbe, decltype(&GroupsProbe::List)>);
+    static_assert(RoutePath<"/pages/<int>">::Accepts<GroupsProbe, decltype(&GroupsProbe::Page)>);
+    static_assert(!RoutePath<"/pages/<uuid>">::Accepts<GroupsProbe, decltype(&GroupsProbe::Page)>);
+    static_assert(!RoutePath<"/files/<uuid>">::Accepts<GroupsProbe, decltype(&GroupsProbe::Open)>);
+    static_assert(RoutePath<"/files/<string>">::Accepts<GroupsProbe, decltype(&GroupsProbe::Open)>);
+}
+
+TEST(RoutePathTest, UuidParametersAreParsedOnce) {
+    const std::string id = "6F1C2B9E-8D6F-4D8E-9A4C-5F0B7C2F3A11";
+
+    const auto parsed = GroupRoute::Parse(id, std::string("9b2f4c1a-3e5d-4f6a-8b7c-1d2e3f4a5b6c"));
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_EQ("6f1c2b9e-8d6f-4d8e-9a4c-5f0b7c2f3a11", std::get<0>(*parsed).ToString());
+    EXPECT_EQ("9b2f4c1a-3e5d-4f6a-8b7c-1d2e3f4a5b6c", std::get<1>(*parsed).ToString());
+
+    const auto file = RoutePath<"/files/<string>">::Parse(std::string("mfasd#*"));
+    ASSERT_TRUE(file.has_value());
+    EXPECT_EQ("mfasd#*", std::get<0>(*file));
+}
+
+TEST(RoutePathTest, MalformedUuidParametersAreRejected) {
+    const std::string id = "6f1c2b9e-8d6f-4d8e-9a4c-5f0b7c2f3a11";
+
+    EXPECT_FALSE(GroupRoute::Parse(id, std::string("group-abc")).has_value());
+    EXPECT_FALSE(RoutePath<"/teams/<uuid>">::Parse(std::string("mfasd#*")).has_value());
+}
+
+// Los controladores ya no validan los ids, la ruta es la única que los revisa.
+TEST(RoutePathTest, ControllerRoutesRejectMalformedIds) {
+    const std::string id = "6f1c2b9e-8d6f-4d8e-9a4c-5f0b7c2f3a11";
+
+    for (const std::string invalid : {"", "mfasd#*", "not-a-uuid"}) {
+        EXPECT_FALSE(RoutePath<"/teams/<uuid>">::Parse(invalid).has_value());
+        EXPECT_FALSE(RoutePath<"/tournaments/<uuid>">::Parse(invalid).has_value());
+        EXPECT_FALSE(RoutePath<"/tournaments/<uuid>/standings">::Parse(invalid).has_value());
+        EXPECT_FALSE(RoutePath<"/tournaments/<uuid>/groups">::Parse(invalid).has_value());
+        EXPECT_FALSE(GroupRoute::Parse(invalid, id).has_value());
+        EXPECT_FALSE(RoutePath<"/tournaments/<uuid>/groups/<uuid>/teams">::Parse(id, invalid).has_value());
+    }
+    EXPECT_TRUE(RoutePath<"/tournaments/<uuid>/groups/<uuid>/teams">::Parse(id, id).has_value());
+}
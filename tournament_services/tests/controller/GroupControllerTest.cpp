@@ -11,16 +11,23 @@
 #include "controller/GroupController.hpp"
 #include "domain/Group.hpp"
 #include "domain/Team.hpp"
-#include "common/Constants.hpp"
+#include "persistence/async/Task.hpp"
+#include "../configuration/RouteHarness.hpp"
+
+template<typename T>
+Task<T> readyTask(T value) {
+    co_return value;
+}
 
 class GroupDelegateMock : public IGroupDelegate {
 public:
-    MOCK_METHOD((std::expected<std::vector<domain::Group>, std::string>), GetGroups, (std::string tournamentId), (override));
-    MOCK_METHOD((std::expected<domain::Group, std::string>), GetGroup, (std::string tournamentId, std::string_view groupId), (override));
-    MOCK_METHOD((std::expected<std::string, std::string>), CreateGroup, (std::string tournamentId, domain::Group& group), (override));
-    MOCK_METHOD((std::expected<void, std::string>), AddTeamToGroup, (std::string_view tournamentId, std::string_view groupId, const domain::Team& team), (override));
-    MOCK_METHOD((std::expected<void, std::string>), UpdateGroupName, (std::string_view tournamentId, std::string_view groupId, const domain::Group& groupUpdatePayload), (override));
-    MOCK_METHOD((std::expected<void, std::string>), DeleteGroup, (std::string_view tournamentId, std::string groupId), (override));
+    MOCK_METHOD((Task<std::expected<std::string, std::string>>), GetGroups, (domain::Uuid tournamentId), (override));
+    MOCK_METHOD((Task<std::expected<domain::Group, std::string>>), GetGroup, (domain::Uuid tournamentId, domain::Uuid groupId), (override));
+    MOCK_METHOD((Task<std::optional<std::int64_t>>), GetGroupVersion, (domain::Uuid tournamentId, domain::Uuid groupId), (override));
+    MOCK_METHOD((std::expected<domain::Uuid, std::string>), CreateGroup, (const domain::Uuid& tournamentId, domain::Group& group), (override));
+    MOCK_METHOD((std::expected<void, std::string>), AddTeamToGroup, (const domain::Uuid& tournamentId, const domain::Uuid& groupId, const domain::Team& team), (override));
+    MOCK_METHOD((std::expected<void, std::string>), UpdateGroupName, (const domain::Uuid& tournamentId, const domain::Uuid& groupId, const domain::Group& groupUpdatePayload), (override));
+    MOCK_METHOD((std::expected<void, std::string>), DeleteGroup, (const domain::Uuid& tournamentId, const domain::Uuid& groupId), (override));
 };
 
 class GroupControllerTest : public ::testing::Test {
@@ -28,24 +35,25 @@ protected:
     std::shared_ptr<GroupDelegateMock> groupDelegateMock;
     std::shared_ptr<GroupController> groupController;
 
-    const std::string VALID_TOURNAMENT_ID = "0b9b3f3e-8f4b-4a3e-9c1d-0b7a8e1f2a3b";
-    const std::string VALID_GROUP_ID = "c4e1b8a1-3b7c-4c6e-8d2f-1c5a9b3d4e5f";
+    static constexpr domain::Uuid VALID_TOURNAMENT_ID = *domain::Uuid::Parse("0b9b3f3e-8f4b-4a3e-9c1d-0b7a8e1f2a3b");
+    static constexpr domain::Uuid VALID_GROUP_ID = *domain::Uuid::Parse("c4e1b8a1-3b7c-4c6e-8d2f-1c5a9b3d4e5f");
 
     void SetUp() override {
         groupDelegateMock = std::make_shared<GroupDelegateMock>();
-        groupController = std::make_shared<GroupController>(groupDelegateMock);
+        groupController = std::make_shared<GroupController>(groupDelegateMock, std::make_shared<ResponseCache>());
     }
 };
 
 // --- Pruebas para GET /tournaments/{id}/groups ---
 TEST_F(GroupControllerTest, GetGroups_Success200) {
-    std::vector<domain::Group> groups = {domain::Group("Group A"), domain::Group("Group B")};
+    const std::string groups = R"([{"id" : "g-1", "name" : "Group A", "teams" : []}, {"id" : "g-2", "name" : "Group B", "teams" : []}])";
     EXPECT_CALL(*groupDelegateMock, GetGroups(VALID_TOURNAMENT_ID))
-        .WillOnce(testing::Return(groups));
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::expected<std::string, std::string>{groups}))));
 
-    crow::response res = groupController->GetGroups(VALID_TOURNAMENT_ID);
+    crow::response res = SyncWait(groupController->GetGroups(crow::request{}, VALID_TOURNAMENT_ID));
 
     EXPECT_EQ(res.code, crow::OK);
+    EXPECT_EQ(groups, res.body);
     auto body = nlohmann::json::parse(res.body);
     ASSERT_EQ(body.size(), 2);
     EXPECT_EQ(body[0]["name"], "Group A");
@@ -53,9 +61,9 @@ TEST_F(GroupControllerTest, GetGroups_Success200) {
 
 TEST_F(GroupControllerTest, GetGroups_TournamentNotFound404) {
     EXPECT_CALL(*groupDelegateMock, GetGroups(VALID_TOURNAMENT_ID))
-        .WillOnce(testing::Return(std::unexpected("Tournament not found.")));
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::expected<std::string, std::string>{std::unexpected("Tournament not found.")}))));
 
-    crow::response res = groupController->GetGroups(VALID_TOURNAMENT_ID);
+    crow::response res = SyncWait(groupController->GetGroups(crow::request{}, VALID_TOURNAMENT_ID));
 
     EXPECT_EQ(res.code, crow::NOT_FOUND);
 }
@@ -63,30 +71,58 @@ TEST_F(GroupControllerTest, GetGroups_TournamentNotFound404) {
 // Pruebas para GET /tournaments/{id}/groups/{id}
 TEST_F(GroupControllerTest, GetGroup_Success200) {
     domain::Group group("Group A", VALID_GROUP_ID);
+    group.Version() = 1;
     EXPECT_CALL(*groupDelegateMock, GetGroup(VALID_TOURNAMENT_ID, VALID_GROUP_ID))
-        .WillOnce(testing::Return(group));
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::expected<domain::Group, std::string>{group}))));
 
-    crow::response res = groupController->GetGroup(VALID_TOURNAMENT_ID, VALID_GROUP_ID);
+    crow::response res = SyncWait(groupController->GetGroup(crow::request{}, VALID_TOURNAMENT_ID, VALID_GROUP_ID));
 
     EXPECT_EQ(res.code, crow::OK);
     auto body = nlohmann::json::parse(res.body);
-    EXPECT_EQ(body["id"], VALID_GROUP_ID);
+    EXPECT_EQ(body["id"], VALID_GROUP_ID.ToString());
     EXPECT_EQ(body["name"], "Group A");
+    EXPECT_EQ(res.get_header_value("ETag"), "\"1\"");
+}
+
+TEST_F(GroupControllerTest, GetGroup_IfNoneMatchCurrent_304WithoutReadingTheGroup) {
+    EXPECT_CALL(*groupDelegateMock, GetGroupVersion(VALID_TOURNAMENT_ID, VALID_GROUP_ID))
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::optional<std::int64_t>{6}))));
+    EXPECT_CALL(*groupDelegateMock, GetGroup(::testing::_, ::testing::_))
+        .Times(0);
+
+    crow::request req;
+    req.add_header("If-None-Match", "\"6\"");
+    crow::response res = SyncWait(groupController->GetGroup(req, VALID_TOURNAMENT_ID, VALID_GROUP_ID));
+
+    EXPECT_EQ(res.code, crow::NOT_MODIFIED);
+    EXPECT_EQ(res.get_header_value("ETag"), "\"6\"");
 }
 
 TEST_F(GroupControllerTest, GetGroup_NotFound404) {
     EXPECT_CALL(*groupDelegateMock, GetGroup(VALID_TOURNAMENT_ID, VALID_GROUP_ID))
-        .WillOnce(testing::Return(std::unexpected("Group not found.")));
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::expected<domain::Group, std::string>{std::unexpected("Group not found.")}))));
 
-    crow::response res = groupController->GetGroup(VALID_TOURNAMENT_ID, VALID_GROUP_ID);
+    crow::response res = SyncWait(groupController->GetGroup(crow::request{}, VALID_TOURNAMENT_ID, VALID_GROUP_ID));
 
     EXPECT_EQ(res.code, crow::NOT_FOUND);
 }
 
+TEST_F(GroupControllerTest, GetGroup_InvalidId400WithoutDelegateCall) {
+    // La ruta asincrona responde sin suspenderse cuando el id no es valido.
+    EXPECT_CALL(*groupDelegateMock, GetGroupVersion(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(*groupDelegateMock, GetGroup(::testing::_, ::testing::_)).Times(0);
+    RouteHarness routes(groupController, {"/tournaments/<string>/groups/<string>"});
+
+    crow::response res = routes.Handle(crow::HTTPMethod::Get, "/tournaments/" + VALID_TOURNAMENT_ID.ToString() + "/groups/not-a-uuid");
+
+    EXPECT_EQ(res.code, crow::BAD_REQUEST);
+    EXPECT_EQ(res.body, domain::INVALID_ID_MESSAGE);
+}
+
 // Pruebas para POST /tournaments/{id}/groups
 
 TEST_F(GroupControllerTest, CreateGroup_Success201) {
-    const std::string newGroupId = "new-group-id-789";
+    constexpr domain::Uuid newGroupId = *domain::Uuid::Parse("7a3e9c1d-0b7a-4e1f-8b2c-3d4e5f6a7b8c");
     domain::Group capturedGroup;
     nlohmann::json requestBody = {{"name", "Group C"}};
     crow::request req;
@@ -95,16 +131,52 @@ TEST_F(GroupControllerTest, CreateGroup_Success201) {
     EXPECT_CALL(*groupDelegateMock, CreateGroup(VALID_TOURNAMENT_ID, ::testing::_))
         .WillOnce(testing::DoAll(
             testing::SaveArg<1>(&capturedGroup), // Captura el objeto Group
-            testing::Return(newGroupId)
+            testing::Return(std::expected<domain::Uuid, std::string>{newGroupId})
         ));
 
     crow::response res = groupController->CreateGroup(req, VALID_TOURNAMENT_ID);
 
     EXPECT_EQ(res.code, crow::CREATED);
-    EXPECT_EQ(res.get_header_value("Location"), newGroupId);
+    EXPECT_EQ(res.get_header_value("Location"), newGroupId.ToString());
     EXPECT_EQ(capturedGroup.Name(), "Group C"); // Verifica la transformación JSON -> Objeto
 }
 
+TEST_F(GroupControllerTest, CreateGroup_TeamsKeepTheirOptionalIdAndName) {
+    domain::Group capturedGroup;
+    crow::request req;
+    req.body = R"({"name": "Group C", "teams": [{"name": "Bears"}, {"id": "3f7c2a1e-5d4b-4c8a-9e6f-2b1d0c9a8e7f"}]})";
+
+    EXPECT_CALL(*groupDelegateMock, CreateGroup(VALID_TOURNAMENT_ID, ::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<1>(&capturedGroup),
+            testing::Return(std::expected<domain::Uuid, std::string>{VALID_GROUP_ID})
+        ));
+
+    crow::response res = groupController->CreateGroup(req, VALID_TOURNAMENT_ID);
+
+    EXPECT_EQ(res.code, crow::CREATED);
+    ASSERT_EQ(2, capturedGroup.Teams().size());
+    EXPECT_TRUE(capturedGroup.Teams()[0].Id.IsNil());
+    EXPECT_EQ("Bears", capturedGroup.Teams()[0].Name);
+    EXPECT_EQ("3f7c2a1e-5d4b-4c8a-9e6f-2b1d0c9a8e7f", capturedGroup.Teams()[1].Id.ToString());
+    EXPECT_EQ("", capturedGroup.Teams()[1].Name);
+}
+
+TEST_F(GroupControllerTest, CreateGroup_MalformedTeamId400WithoutDelegateCall) {
+    crow::request req;
+    req.body = R"({"name": "Group C", "teams": [{"id": "team-2"}]})";
+
+    EXPECT_CALL(*groupDelegateMock, CreateGroup(::testing::_, ::testing::_)).Times(0);
+
+    crow::response res = groupController->CreateGroup(req, VALID_TOURNAMENT_ID);
+
+    EXPECT_EQ(res.code, crow::BAD_REQUEST);
+    auto body = nlohmann::json::parse(res.body);
+    ASSERT_EQ(1, body["violations"].size());
+    EXPECT_EQ("teams[0].id", body["violations"][0]["field"]);
+    EXPECT_EQ(domain::INVALID_ID_MESSAGE, body["violations"][0]["message"].get<std::string>());
+}
+
 TEST_F(GroupControllerTest, CreateGroup_Unprocessable422) {
     nlohmann::json requestBody = {{"name", "Group D"}};
     crow::request req;
@@ -123,7 +195,7 @@ TEST_F(GroupControllerTest, CreateGroup_Unprocessable422) {
 
 TEST_F(GroupControllerTest, AddTeamToGroup_Success204) {
     domain::Team capturedTeam;
-    nlohmann::json requestBody = {{"id", "team-123"}, {"name", "Team Rocket"}};
+    nlohmann::json requestBody = {{"id", "3f7c2a1e-5d4b-4c8a-9e6f-2b1d0c9a8e7f"}, {"name", "Team Rocket"}};
     crow::request req;
     req.body = requestBody.dump();
 
@@ -136,13 +208,13 @@ TEST_F(GroupControllerTest, AddTeamToGroup_Success204) {
     crow::response res = groupController->AddTeamToGroup(req, VALID_TOURNAMENT_ID, VALID_GROUP_ID);
 
     EXPECT_EQ(res.code, crow::NO_CONTENT);
-    EXPECT_EQ(capturedTeam.Id, "team-123");
+    EXPECT_EQ(capturedTeam.Id.ToString(), "3f7c2a1e-5d4b-4c8a-9e6f-2b1d0c9a8e7f");
     EXPECT_EQ(capturedTeam.Name, "Team Rocket");
 }
 
 TEST_F(GroupControllerTest, AddTeamToGroup_GroupIsFull422) {
     crow::request req;
-    req.body = R"({"id": "team-123", "name": "Team Aqua"})";
+    req.body = R"({"id": "3f7c2a1e-5d4b-4c8a-9e6f-2b1d0c9a8e7f", "name": "Team Aqua"})";
     
     EXPECT_CALL(*groupDelegateMock, AddTeamToGroup(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(testing::Return(std::unexpected("Group is already full.")));
@@ -155,16 +227,31 @@ TEST_F(GroupControllerTest, AddTeamToGroup_GroupIsFull422) {
 
 TEST_F(GroupControllerTest, AddTeamToGroup_TeamNotFound422) {
     crow::request req;
-    req.body = R"({"id": "non-existent-team", "name": "Ghost Team"})";
+    req.body = R"({"id": "9a8b7c6d-5e4f-4a3b-8c2d-1e0f9a8b7c6d", "name": "Ghost Team"})";
 
     EXPECT_CALL(*groupDelegateMock, AddTeamToGroup(::testing::_, ::testing::_, ::testing::_))
-        .WillOnce(testing::Return(std::unexpected("Team with ID non-existent-team does not exist.")));
+        .WillOnce(testing::Return(std::unexpected("Team with ID 9a8b7c6d-5e4f-4a3b-8c2d-1e0f9a8b7c6d does not exist.")));
 
     crow::response res = groupController->AddTeamToGroup(req, VALID_TOURNAMENT_ID, VALID_GROUP_ID);
 
     EXPECT_EQ(res.code, 422);
 }
 
+TEST_F(GroupControllerTest, AddTeamToGroup_MalformedId400WithoutDelegateCall) {
+    crow::request req;
+    req.body = R"({"id": "team-123", "name": "Team Aqua"})";
+
+    EXPECT_CALL(*groupDelegateMock, AddTeamToGroup(::testing::_, ::testing::_, ::testing::_)).Times(0);
+
+    crow::response res = groupController->AddTeamToGroup(req, VALID_TOURNAMENT_ID, VALID_GROUP_ID);
+
+    EXPECT_EQ(res.code, crow::BAD_REQUEST);
+    auto body = nlohmann::json::parse(res.body);
+    ASSERT_EQ(1, body["violations"].size());
+    EXPECT_EQ("id", body["violations"][0]["field"]);
+    EXPECT_EQ(domain::INVALID_ID_MESSAGE, body["violations"][0]["message"].get<std::string>());
+}
+
 // Pruebas para PATCH /tournaments/{id}/groups/{id}
 
 TEST_F(GroupControllerTest, UpdateGroupName_Success204) {
@@ -208,6 +295,23 @@ TEST_F(GroupControllerTest, UpdateGroupName_Conflict409) {
     EXPECT_EQ(res.code, crow::CONFLICT);
 }
 
+TEST_F(GroupControllerTest, UpdateGroupName_IfMatchStale412) {
+    crow::request req;
+    req.body = R"({"name": "New Group Name"})";
+    req.add_header("If-Match", "\"4\"");
+    domain::Group capturedGroup;
+
+    EXPECT_CALL(*groupDelegateMock, UpdateGroupName(::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<2>(&capturedGroup),
+            testing::Return(std::unexpected("Entry was modified, version does not match."))));
+
+    crow::response res = groupController->UpdateGroupName(req, VALID_TOURNAMENT_ID, VALID_GROUP_ID);
+
+    EXPECT_EQ(res.code, 412);
+    EXPECT_EQ(capturedGroup.Version(), 4);
+}
+
 // Pruebas para DELETE /tournaments/{id}/groups/{id}
 
 TEST_F(GroupControllerTest, DeleteGroup_Success204) {
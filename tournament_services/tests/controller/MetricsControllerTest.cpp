@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <crow.h>
+#include <nlohmann/json.hpp>
+
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "controller/MetricsController.hpp"
+#include "persistence/configuration/RequestArena.hpp"
+#include "persistence/configuration/StatementCatalog.hpp"
+
+class DbConnectionProviderMock : public IDbConnectionProvider {
+public:
+    MOCK_METHOD(PooledConnection, Connection, (ConnectionIntent intent), (override));
+    MOCK_METHOD(PoolMetrics, Metrics, (), (override));
+};
+
+class MetricsControllerTest : public ::testing::Test {
+protected:
+    std::shared_ptr<DbConnectionProviderMock> connectionProviderMock;
+    std::shared_ptr<MetricsController> metricsController;
+
+    void SetUp() override {
+        connectionProviderMock = std::make_shared<DbConnectionProviderMock>();
+        metricsController = std::make_shared<MetricsController>(connectionProviderMock);
+    }
+};
+
+TEST_F(MetricsControllerTest, GetPoolMetrics_ReturnsCounters200) {
+    PoolMetrics metrics;
+    metrics.poolSize = 4;
+    metrics.openConnections = 3;
+    metrics.inUse = 3;
+    metrics.waiters = 2;
+    metrics.checkouts = 120;
+    metrics.timeouts = 1;
+    metrics.cancellations = 2;
+    metrics.checkoutsPerSecond = 40.0;
+    metrics.waitHistogram[0] = 100;
+    metrics.waitHistogram[POOL_WAIT_BUCKETS_US.size()] = 1;
+    metrics.warmUpConnections = 4;
+    metrics.warmUpConnectMaxMillis = 12.5;
+
+    EXPECT_CALL(*connectionProviderMock, Metrics())
+        .WillOnce(testing::Return(metrics));
+
+    crow::response response = metricsController->GetPoolMetrics();
+    auto body = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(crow::OK, response.code);
+    EXPECT_EQ(4, body["poolSize"]);
+    EXPECT_EQ(3, body["openConnections"]);
+    EXPECT_EQ(3, body["inUse"]);
+    EXPECT_EQ(2, body["waiters"]);
+    EXPECT_EQ(120, body["checkouts"]);
+    EXPECT_EQ(1, body["timeouts"]);
+    EXPECT_EQ(2, body["cancellations"]);
+    EXPECT_DOUBLE_EQ(40.0, body["checkoutsPerSecond"].get<double>());
+    ASSERT_EQ(POOL_WAIT_BUCKETS_US.size() + 1, body["waitHistogram"].size());
+    EXPECT_EQ(100, body["waitHistogram"][0]["count"]);
+    EXPECT_EQ("+Inf", body["waitHistogram"].back()["leMicros"]);
+    EXPECT_EQ(4, body["warmUp"]["connections"]);
+    EXPECT_DOUBLE_EQ(12.5, body["warmUp"]["connectMaxMillis"].get<double>());
+}
+
+TEST_F(MetricsControllerTest, GetStatementMetrics_ListsHitsAndMisses200) {
+    const PreparedStatement statement = StatementCatalog::Declare("metrics_test_statement", "select 1");
+    StatementCatalog::Instance().Miss(statement);
+    StatementCatalog::Instance().Hit(statement);
+    StatementCatalog::Instance().Hit(statement);
+
+    crow::response response = metricsController->GetStatementMetrics();
+    auto body = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(crow::OK, response.code);
+    ASSERT_TRUE(body.is_array());
+    auto entry = std::find_if(body.begin(), body.end(), [](const nlohmann::json& item) {
+        return item["name"] == "metrics_test_statement";
+    });
+    ASSERT_NE(body.end(), entry);
+    EXPECT_EQ(2, (*entry)["hits"]);
+    EXPECT_EQ(1, (*entry)["misses"]);
+}
+
+TEST_F(MetricsControllerTest, GetRequestMemoryMetrics_CountsReleasedArenas200) {
+    {
+        RequestArena arena;
+        arena.allocate(64);
+    }
+
+    crow::response response = metricsController->GetRequestMemoryMetrics();
+    auto body = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(crow::OK, response.code);
+    EXPECT_GE(body["requests"].get<std::uint64_t>(), 1);
+    EXPECT_GE(body["arenaAllocations"].get<std::uint64_t>(), 1);
+    EXPECT_GE(body["arenaBlocks"].get<std::uint64_t>(), 1);
+    EXPECT_GT(body["arenaAllocationsPerRequest"].get<double>(), 0);
+    // las pruebas no reemplazan operator new, no hay conteo de heap que reportar
+    EXPECT_FALSE(body.contains("heapAllocationsPerRequest"));
+}
@@ -1,29 +1,46 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <crow.h>
+#include <format>
 
 #include "domain/Team.hpp"
 #include "delegate/ITeamDelegate.hpp"
 #include "controller/TeamController.hpp"
+#include "common/Pagination.hpp"
 #include "domain/Utilities.hpp"
+#include "../configuration/RouteHarness.hpp"
+
+namespace {
+    constexpr domain::Uuid NEW_TEAM = *domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000000");
+
+    domain::Uuid teamId(int n) {
+        return domain::Uuid::Parse(std::format("6f1c2b9e-0000-4000-8000-{:012}", n)).value();
+    }
+}
 
 class TeamDelegateMock : public ITeamDelegate {
     public:
-    MOCK_METHOD(std::shared_ptr<domain::Team>, GetTeam, (const std::string id), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Team>, GetTeam, (const domain::Uuid& id), (override));
+    MOCK_METHOD(std::optional<std::int64_t>, GetTeamVersion, (const domain::Uuid& id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, GetAllTeams, (), (override));
-    MOCK_METHOD((std::expected<std::string, std::string>), SaveTeam, (const domain::Team& team), (override));
-    MOCK_METHOD((std::expected<std::string, std::string>), UpdateTeam, (const std::string& teamId, const domain::Team& team), (override));
-    MOCK_METHOD((std::expected<void, std::string>), DeleteTeam, (const std::string& teamId), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, GetTeamsPage, (const std::optional<domain::Uuid>& after, std::size_t limit), (override));
+    MOCK_METHOD(bool, ExportTeams, (const std::function<void(std::string_view)>& writeRow, std::size_t limit), (override));
+    MOCK_METHOD((std::expected<domain::Uuid, std::string>), SaveTeam, (const domain::Team& team), (override));
+    MOCK_METHOD(BulkImportResult, ImportTeams, (const std::vector<domain::Team>& teams), (override));
+    MOCK_METHOD((std::expected<domain::Uuid, std::string>), UpdateTeam, (const domain::Uuid& teamId, const domain::Team& team), (override));
+    MOCK_METHOD((std::expected<void, std::string>), DeleteTeam, (const domain::Uuid& teamId), (override));
 };
 
 class TeamControllerTest : public ::testing::Test{
 protected:
     std::shared_ptr<TeamDelegateMock> teamDelegateMock;
+    std::shared_ptr<ResponseCache> responseCache;
     std::shared_ptr<TeamController> teamController;
 
     void SetUp() override {
         teamDelegateMock = std::make_shared<TeamDelegateMock>();
-        teamController = std::make_shared<TeamController>(TeamController(teamDelegateMock));
+        responseCache = std::make_shared<ResponseCache>(1 << 20);
+        teamController = std::make_shared<TeamController>(teamDelegateMock, responseCache);
     }
 
     // TearDown() function
@@ -38,7 +55,7 @@ TEST_F(TeamControllerTest, SaveTeamTest_Success201) {
     EXPECT_CALL(*teamDelegateMock, SaveTeam(::testing::_))
         .WillOnce(testing::DoAll(
                 testing::SaveArg<0>(&capturedTeam),
-                testing::Return(std::expected<std::string, std::string>{"new-id"})
+                testing::Return(std::expected<domain::Uuid, std::string>{NEW_TEAM})
             )
         );
 
@@ -51,7 +68,7 @@ TEST_F(TeamControllerTest, SaveTeamTest_Success201) {
     testing::Mock::VerifyAndClearExpectations(&teamDelegateMock);
 
     EXPECT_EQ(crow::CREATED, response.code);
-    EXPECT_EQ("new-id", response.get_header_value("location"));
+    EXPECT_EQ(NEW_TEAM.ToString(), response.get_header_value("location"));
     EXPECT_EQ(teamRequestBody.at("name").get<std::string>(), capturedTeam.Name);
 }
 
@@ -70,65 +87,188 @@ TEST_F(TeamControllerTest, SaveTeam_Conflict409) {
     EXPECT_EQ(crow::CONFLICT, response.code);
 }
 
+TEST_F(TeamControllerTest, ImportTeams_ReportsConflictsPerRow200) {
+    std::vector<domain::Team> capturedTeams;
+    EXPECT_CALL(*teamDelegateMock, ImportTeams(::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<0>(&capturedTeams),
+            testing::Return(BulkImportResult{{teamId(1), {}, teamId(3)}, {1}})));
+
+    crow::request request;
+    request.body = R"([{"name": "Team 1"}, {"name": "Taken"}, {"name": "Team 3"}])";
+
+    crow::response response = teamController->ImportTeams(request);
+    auto body = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(crow::OK, response.code);
+    ASSERT_EQ(3, capturedTeams.size());
+    EXPECT_EQ("Team 3", capturedTeams[2].Name);
+    EXPECT_EQ(2, body["created"]);
+    EXPECT_EQ(teamId(3).ToString(), body["ids"][2]);
+    EXPECT_TRUE(body["ids"][1].is_null());
+    ASSERT_EQ(1, body["conflicts"].size());
+    EXPECT_EQ(1, body["conflicts"][0]["row"]);
+    EXPECT_EQ("Taken", body["conflicts"][0]["name"]);
+}
+
+TEST_F(TeamControllerTest, ImportTeams_AcceptsNdjson200) {
+    std::vector<domain::Team> capturedTeams;
+    EXPECT_CALL(*teamDelegateMock, ImportTeams(::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<0>(&capturedTeams),
+            testing::Return(BulkImportResult{{teamId(1), teamId(2)}, {}})));
+
+    crow::request request;
+    request.add_header("content-type", "application/x-ndjson");
+    request.body = "{\"name\": \"Team 1\"}\n\n{\"name\": \"Team 2\"}\n";
+
+    crow::response response = teamController->ImportTeams(request);
+
+    EXPECT_EQ(crow::OK, response.code);
+    ASSERT_EQ(2, capturedTeams.size());
+    EXPECT_EQ("Team 2", capturedTeams[1].Name);
+}
+
+TEST_F(TeamControllerTest, ImportTeams_InvalidRow400) {
+    EXPECT_CALL(*teamDelegateMock, ImportTeams(::testing::_)).Times(0);
+
+    crow::request request;
+    request.body = R"([{"name": "Team 1"}, {"title": "no name"}])";
+
+    crow::response response = teamController->ImportTeams(request);
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+    EXPECT_EQ("Row 1 must be an object with a string name", response.body);
+}
+
+TEST_F(TeamControllerTest, ImportTeams_EmptyName400) {
+    // POST /teams rechaza un nombre vacío, la importación también
+    EXPECT_CALL(*teamDelegateMock, ImportTeams(::testing::_)).Times(0);
+
+    crow::request request;
+    request.add_header("content-type", "application/x-ndjson");
+    request.body = "{\"name\": \"Team 1\"}\n{\"name\": \"\"}\n";
+
+    crow::response response = teamController->ImportTeams(request);
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+    EXPECT_EQ("Row 1 must have a non-empty name", response.body);
+}
+
 TEST_F(TeamControllerTest, GetTeamById_OK200) {
-    const std::string validUuid = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
-    std::shared_ptr<domain::Team> expectedTeam = std::make_shared<domain::Team>(domain::Team{validUuid,  "Team Name"});
+    constexpr domain::Uuid validUuid = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    std::shared_ptr<domain::Team> expectedTeam = std::make_shared<domain::Team>(domain::Team{validUuid,  "Team Name", 3});
 
+    EXPECT_CALL(*teamDelegateMock, GetTeamVersion(testing::_)).Times(0);
     EXPECT_CALL(*teamDelegateMock, GetTeam(testing::Eq(validUuid)))
         .WillOnce(testing::Return(expectedTeam));
 
-    crow::response response = teamController->getTeam(validUuid);
+    crow::response response = teamController->getTeam(crow::request{}, validUuid);
     auto jsonResponse = crow::json::load(response.body);
 
     EXPECT_EQ(crow::OK, response.code);
-    EXPECT_EQ(expectedTeam->Id, jsonResponse["id"]);
+    EXPECT_EQ(expectedTeam->Id.ToString(), jsonResponse["id"]);
     EXPECT_EQ(expectedTeam->Name, jsonResponse["name"]);
+    EXPECT_EQ("\"3\"", response.get_header_value("ETag"));
+}
+
+TEST_F(TeamControllerTest, GetTeamById_ErrorFormat400) {
+    // La ruta registrada valida el id antes de llegar al controlador.
+    EXPECT_CALL(*teamDelegateMock, GetTeamVersion(testing::_)).Times(0);
+    EXPECT_CALL(*teamDelegateMock, GetTeam(testing::_)).Times(0);
+    RouteHarness routes(teamController, {"/teams/<string>"});
+
+    crow::response badRequest = routes.Handle(crow::HTTPMethod::Get, "/teams/mfasd*");
+    EXPECT_EQ(crow::BAD_REQUEST, badRequest.code);
+    EXPECT_EQ(domain::INVALID_ID_MESSAGE, badRequest.body);
+
+    badRequest = routes.Handle(crow::HTTPMethod::Get, "/teams/8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3");
+    EXPECT_EQ(crow::BAD_REQUEST, badRequest.code);
+    EXPECT_EQ(domain::INVALID_ID_MESSAGE, badRequest.body);
+}
+
+TEST_F(TeamControllerTest, GetTeam_IfNoneMatchCurrent_304WithoutReadingTheTeam) {
+    constexpr domain::Uuid validUuid = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    EXPECT_CALL(*teamDelegateMock, GetTeamVersion(testing::Eq(validUuid)))
+        .WillOnce(testing::Return(std::optional<std::int64_t>{3}));
+    EXPECT_CALL(*teamDelegateMock, GetTeam(testing::_)).Times(0);
+
+    crow::request request;
+    request.add_header("If-None-Match", "\"2\", W/\"3\"");
+    crow::response response = teamController->getTeam(request, validUuid);
+
+    EXPECT_EQ(crow::NOT_MODIFIED, response.code);
+    EXPECT_TRUE(response.body.empty());
+    EXPECT_EQ("\"3\"", response.get_header_value("ETag"));
+}
+
+TEST_F(TeamControllerTest, GetTeam_IfNoneMatchStale_200WithCurrentETag) {
+    constexpr domain::Uuid validUuid = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    EXPECT_CALL(*teamDelegateMock, GetTeamVersion(testing::Eq(validUuid)))
+        .WillOnce(testing::Return(std::optional<std::int64_t>{4}));
+    EXPECT_CALL(*teamDelegateMock, GetTeam(testing::Eq(validUuid)))
+        .WillOnce(testing::Return(std::make_shared<domain::Team>(domain::Team{validUuid, "Team Name", 4})));
+
+    crow::request request;
+    request.add_header("If-None-Match", "\"3\"");
+    crow::response response = teamController->getTeam(request, validUuid);
+
+    EXPECT_EQ(crow::OK, response.code);
+    EXPECT_EQ("\"4\"", response.get_header_value("ETag"));
+}
+
+TEST_F(TeamControllerTest, GetTeam_SecondReadServedFromCache) {
+    constexpr domain::Uuid validUuid = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    EXPECT_CALL(*teamDelegateMock, GetTeam(testing::Eq(validUuid)))
+        .WillOnce(testing::Return(std::make_shared<domain::Team>(domain::Team{validUuid, "Team Name", 5})));
+    EXPECT_CALL(*teamDelegateMock, GetTeamVersion(testing::_)).Times(0);
+
+    const crow::response first = teamController->getTeam(crow::request{}, validUuid);
+    const crow::response second = teamController->getTeam(crow::request{}, validUuid);
+    crow::request revalidate;
+    revalidate.add_header("If-None-Match", "\"5\"");
+    const crow::response notModified = teamController->getTeam(revalidate, validUuid);
+
+    EXPECT_EQ(crow::OK, second.code);
+    EXPECT_EQ(first.body, second.body);
+    EXPECT_EQ("\"5\"", second.get_header_value("ETag"));
+    EXPECT_EQ(crow::NOT_MODIFIED, notModified.code);
 }
 
 TEST_F(TeamControllerTest, GetTeamNotFound_nullptr404) {
-    const std::string validUuid = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
+    constexpr domain::Uuid validUuid = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
     EXPECT_CALL(*teamDelegateMock, GetTeam(testing::Eq(validUuid)))
         .WillOnce(testing::Return(nullptr));
 
-    crow::response response = teamController->getTeam(validUuid);
+    crow::response response = teamController->getTeam(crow::request{}, validUuid);
 
     EXPECT_EQ(crow::NOT_FOUND, response.code);
 }
 
 TEST_F(TeamControllerTest, GetTeamNotFound_WhenDelegateThrows_404) {
-    const std::string validUuid = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
+    constexpr domain::Uuid validUuid = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
 
     // Simulamos que el Delegate lanza la excepción NotFoundException
     EXPECT_CALL(*teamDelegateMock, GetTeam(testing::Eq(validUuid)))
         .WillOnce(testing::Throw(domain::NotFoundException()));
 
-    crow::response response = teamController->getTeam(validUuid);
+    crow::response response = teamController->getTeam(crow::request{}, validUuid);
 
     // Verificamos que el resultado sigue siendo 404 Not Found
     EXPECT_EQ(crow::NOT_FOUND, response.code);
 }
 
-TEST_F(TeamControllerTest, GetTeamById_ErrorFormat400) {
-    crow::response badRequest = teamController->getTeam("");
-
-    EXPECT_EQ(badRequest.code, crow::BAD_REQUEST);
-
-    badRequest = teamController->getTeam("mfasd#*");
-    EXPECT_EQ(badRequest.code, crow::BAD_REQUEST);
-}
-
 TEST_F(TeamControllerTest, GetAllTeams_ReturnsListOfTeams200) {
-    // Preparamos los datos de prueba
-    auto team1 = std::make_shared<domain::Team>(domain::Team{"id-1", "Team 1"});
-    auto team2 = std::make_shared<domain::Team>(domain::Team{"id-2", "Team 2"});
-    std::vector<std::shared_ptr<domain::Team>> expectedTeams = {team1, team2};
-
-    // Simulamos la respuesta del Delegate
-    EXPECT_CALL(*teamDelegateMock, GetAllTeams())
-        .WillOnce(testing::Return(expectedTeams));
+    // Simulamos las filas ya serializadas que entrega el Delegate
+    EXPECT_CALL(*teamDelegateMock, ExportTeams(::testing::_, MAX_EXPORT_ROWS))
+        .WillOnce([](const std::function<void(std::string_view)>& writeRow, std::size_t) {
+            writeRow(R"({"id": "id-1", "name": "Team 1"})");
+            writeRow(R"({"id": "id-2", "name": "Team 2"})");
+            return true;
+        });
 
     // Llamamos al Controller
-    crow::response response = teamController->getAllTeams();
+    crow::response response = teamController->getAllTeams(crow::request{});
     auto jsonResponse = nlohmann::json::parse(response.body);
 
     // Verificamos la respuesta
@@ -140,15 +280,12 @@ TEST_F(TeamControllerTest, GetAllTeams_ReturnsListOfTeams200) {
 }
 
 TEST_F(TeamControllerTest, GetAllTeams_ReturnsEmptyList200) {
-    // Preparamos una lista vacía
-    std::vector<std::shared_ptr<domain::Team>> emptyList;
-
-    // Simulamos la respuesta del Delegate
-    EXPECT_CALL(*teamDelegateMock, GetAllTeams())
-        .WillOnce(testing::Return(emptyList));
+    // Simulamos que el Delegate no entrega filas
+    EXPECT_CALL(*teamDelegateMock, ExportTeams(::testing::_, ::testing::_))
+        .WillOnce(testing::Return(true));
 
     // Llamamos al Controller
-    crow::response response = teamController->getAllTeams();
+    crow::response response = teamController->getAllTeams(crow::request{});
     auto jsonResponse = nlohmann::json::parse(response.body);
 
     // Verificamos la respuesta
@@ -157,17 +294,61 @@ TEST_F(TeamControllerTest, GetAllTeams_ReturnsEmptyList200) {
     EXPECT_EQ(0, jsonResponse.size());
 }
 
+TEST_F(TeamControllerTest, GetAllTeams_PageLinksToNextPage200) {
+    constexpr domain::Uuid lastId = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    crow::request request;
+    request.url_params = crow::query_string("/teams?limit=2&after=0a1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+
+    EXPECT_CALL(*teamDelegateMock, GetTeamsPage(domain::Uuid::Parse("0a1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b"), 2))
+        .WillOnce(testing::Return(std::vector{
+            std::make_shared<domain::Team>(domain::Team{*domain::Uuid::Parse("1a1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b"), "Team 1"}),
+            std::make_shared<domain::Team>(domain::Team{lastId, "Team 2"})}));
+
+    crow::response response = teamController->getAllTeams(request);
+    auto jsonResponse = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(crow::OK, response.code);
+    ASSERT_EQ(2, jsonResponse.size());
+    EXPECT_EQ("Team 2", jsonResponse[1]["name"]);
+    EXPECT_EQ("</teams?limit=2&after=" + lastId.ToString() + ">; rel=\"next\"", response.get_header_value("Link"));
+}
+
+TEST_F(TeamControllerTest, GetAllTeams_ExportOverCap413) {
+    // el repositorio rechaza la colección antes de leer filas, no se pide ninguna página
+    EXPECT_CALL(*teamDelegateMock, ExportTeams(::testing::_, MAX_EXPORT_ROWS))
+        .WillOnce(testing::Return(false));
+    EXPECT_CALL(*teamDelegateMock, GetTeamsPage(::testing::_, ::testing::_))
+        .Times(0);
+
+    crow::response response = teamController->getAllTeams(crow::request{});
+
+    EXPECT_EQ(PAYLOAD_TOO_LARGE, response.code);
+    EXPECT_EQ(std::format("More than {} entries, page through them with ?limit=", MAX_EXPORT_ROWS), response.body);
+    EXPECT_EQ(std::format("</teams?limit={}>; rel=\"first\"", MAX_PAGE_SIZE), response.get_header_value("Link"));
+}
+
+TEST_F(TeamControllerTest, GetAllTeams_InvalidLimit400) {
+    crow::request request;
+    request.url_params = crow::query_string("/teams?limit=0");
+
+    EXPECT_CALL(*teamDelegateMock, GetTeamsPage(::testing::_, ::testing::_)).Times(0);
+
+    crow::response response = teamController->getAllTeams(request);
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+}
+
 TEST_F(TeamControllerTest, UpdateTeam_Success204) {
-    const std::string teamIdToUpdate = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
+    constexpr domain::Uuid teamIdToUpdate = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
     domain::Team capturedTeam;
-    std::string capturedId;
+    domain::Uuid capturedId;
 
     // Capturamos los argumentos que se le pasan al Delegate
     EXPECT_CALL(*teamDelegateMock, UpdateTeam(::testing::_, ::testing::_))
         .WillOnce(testing::DoAll(
             testing::SaveArg<0>(&capturedId),
             testing::SaveArg<1>(&capturedTeam),
-            testing::Return(std::expected<std::string, std::string>{teamIdToUpdate}) // Simulamos una respuesta exitosa
+            testing::Return(std::expected<domain::Uuid, std::string>{teamIdToUpdate}) // Simulamos una respuesta exitosa
         ));
 
     nlohmann::json teamRequestBody = {{"name", "Updated Team Name"}};
@@ -185,7 +366,7 @@ TEST_F(TeamControllerTest, UpdateTeam_Success204) {
 }
 
 TEST_F(TeamControllerTest, UpdateTeam_NotFound404) {
-    const std::string teamIdToUpdate = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
+    constexpr domain::Uuid teamIdToUpdate = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
 
     // Simulamos que el Delegate lanza una NotFoundException
     EXPECT_CALL(*teamDelegateMock, UpdateTeam(::testing::_, ::testing::_))
@@ -202,7 +383,7 @@ TEST_F(TeamControllerTest, UpdateTeam_NotFound404) {
 }
 
 TEST_F(TeamControllerTest, UpdateTeam_Conflict409) {
-    const std::string teamIdToUpdate = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
+    constexpr domain::Uuid teamIdToUpdate = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
 
     // Simulamos que el Delegate lanza una DuplicateEntryException
     EXPECT_CALL(*teamDelegateMock, UpdateTeam(::testing::_, ::testing::_))
@@ -218,10 +399,53 @@ TEST_F(TeamControllerTest, UpdateTeam_Conflict409) {
     EXPECT_EQ(crow::CONFLICT, response.code);
 }
 
+TEST_F(TeamControllerTest, UpdateTeam_IfMatchStale_412) {
+    constexpr domain::Uuid teamIdToUpdate = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    domain::Team capturedTeam;
+
+    EXPECT_CALL(*teamDelegateMock, UpdateTeam(::testing::_, ::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<1>(&capturedTeam),
+            testing::Return(std::unexpected(domain::VersionMismatchException().what()))));
+
+    crow::request teamRequest;
+    teamRequest.body = nlohmann::json{{"name", "Updated Team Name"}}.dump();
+    teamRequest.add_header("If-Match", "\"7\"");
+
+    crow::response response = teamController->UpdateTeam(teamRequest, teamIdToUpdate);
+
+    EXPECT_EQ(412, response.code);
+    EXPECT_EQ(7, capturedTeam.Version);
+}
+
+TEST_F(TeamControllerTest, UpdateTeam_MalformedIfMatch_400) {
+    EXPECT_CALL(*teamDelegateMock, UpdateTeam(::testing::_, ::testing::_)).Times(0);
+
+    crow::request teamRequest;
+    teamRequest.body = nlohmann::json{{"name", "Updated Team Name"}}.dump();
+    teamRequest.add_header("If-Match", "7");
+
+    crow::response response = teamController->UpdateTeam(teamRequest, *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b"));
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+}
+
+TEST_F(TeamControllerTest, UpdateTeam_WeakIfMatch_412) {
+    EXPECT_CALL(*teamDelegateMock, UpdateTeam(::testing::_, ::testing::_)).Times(0);
+
+    crow::request teamRequest;
+    teamRequest.body = nlohmann::json{{"name", "Updated Team Name"}}.dump();
+    teamRequest.add_header("If-Match", "W/\"7\"");
+
+    crow::response response = teamController->UpdateTeam(teamRequest, *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b"));
+
+    EXPECT_EQ(412, response.code);
+}
+
 // --- Pruebas para DELETE /teams/{id} ---
 
 TEST_F(TeamControllerTest, DeleteTeam_Success204) {
-    const std::string teamIdToDelete = "feb3b050-f7b8-4610-808a-1b01b8d61f2e";
+    constexpr domain::Uuid teamIdToDelete = *domain::Uuid::Parse("feb3b050-f7b8-4610-808a-1b01b8d61f2e");
 
     // Simulamos que el delegate procesa el borrado y devuelve un 'expected' exitoso.
     EXPECT_CALL(*teamDelegateMock, DeleteTeam(teamIdToDelete))
@@ -234,7 +458,7 @@ TEST_F(TeamControllerTest, DeleteTeam_Success204) {
 }
 
 TEST_F(TeamControllerTest, DeleteTeam_NotFound404) {
-    const std::string teamIdToDelete = "feb3b050-f7b8-4610-808a-1b01b8d61f2e";
+    constexpr domain::Uuid teamIdToDelete = *domain::Uuid::Parse("feb3b050-f7b8-4610-808a-1b01b8d61f2e");
 
     // Simulamos que el delegate devuelve un error porque el equipo no se encontró.
     EXPECT_CALL(*teamDelegateMock, DeleteTeam(teamIdToDelete))
@@ -247,10 +471,11 @@ TEST_F(TeamControllerTest, DeleteTeam_NotFound404) {
 }
 
 TEST_F(TeamControllerTest, DeleteTeam_InvalidFormat400) {
-    // La validación ocurre antes de llamar al delegate.
-    const std::string invalidId = "not-a-uuid";
+    EXPECT_CALL(*teamDelegateMock, DeleteTeam(testing::_)).Times(0);
+    RouteHarness routes(teamController, {"/teams/<string>"});
 
-    crow::response response = teamController->DeleteTeam(invalidId);
+    crow::response response = routes.Handle(crow::HTTPMethod::Delete, "/teams/not-a-uuid");
 
     EXPECT_EQ(crow::BAD_REQUEST, response.code);
-}
\ No newline at end of file
+    EXPECT_EQ(domain::INVALID_ID_MESSAGE, response.body);
+}
@@ -5,15 +5,26 @@
 #include "domain/Team.hpp"
 #include "delegate/ITournamentDelegate.hpp"
 #include "controller/TournamentController.hpp"
+#include "common/Pagination.hpp"
 #include "domain/Utilities.hpp"
+#include "../configuration/RouteHarness.hpp"
+
+namespace {
+    constexpr domain::Uuid NEW_TOURNAMENT = *domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11");
+    constexpr domain::Uuid TEAM_A = *domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000001");
+}
 
 class TournamentDelegateMock : public ITournamentDelegate {
     public:
-    MOCK_METHOD(std::shared_ptr<domain::Tournament>, GetTournament, (const std::string_view id), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Tournament>, GetTournament, (const domain::Uuid& id), (override));
+    MOCK_METHOD(std::optional<std::int64_t>, GetTournamentVersion, (const domain::Uuid& id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
-    MOCK_METHOD((std::expected<std::string, std::string>), CreateTournament, (const std::shared_ptr<domain::Tournament> tournament), (override));
-    MOCK_METHOD((std::expected<std::string, std::string>), UpdateTournament, (const std::shared_ptr<domain::Tournament> tournament), (override));
-    MOCK_METHOD((std::expected<void, std::string>), DeleteTournament, (const std::string& tournamentId), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadPage, (const std::optional<domain::Uuid>& after, std::size_t limit), (override));
+    MOCK_METHOD(bool, ExportAll, (const std::function<void(std::string_view)>& writeRow, std::size_t limit), (override));
+    MOCK_METHOD((std::expected<domain::Uuid, std::string>), CreateTournament, (const std::shared_ptr<domain::Tournament> tournament), (override));
+    MOCK_METHOD((std::expected<domain::Uuid, std::string>), UpdateTournament, (const std::shared_ptr<domain::Tournament> tournament), (override));
+    MOCK_METHOD((std::expected<void, std::string>), DeleteTournament, (const domain::Uuid& tournamentId), (override));
+    MOCK_METHOD((std::expected<std::vector<domain::Standing>, std::string>), GetStandings, (const domain::Uuid& tournamentId), (override));
 };
 
 class TournamentControllerTest : public ::testing::Test{
@@ -23,7 +34,7 @@ protected:
 
     void SetUp() override {
         tournamentDelegateMock = std::make_shared<TournamentDelegateMock>();
-        tournamentController = std::make_shared<TournamentController>(TournamentController(tournamentDelegateMock));
+        tournamentController = std::make_shared<TournamentController>(tournamentDelegateMock, std::make_shared<ResponseCache>());
     }
 
     // TearDown() function
@@ -40,7 +51,7 @@ TEST_F(TournamentControllerTest, CreateTournament_Success201) {
     EXPECT_CALL(*tournamentDelegateMock, CreateTournament(::testing::_))
         .WillOnce(testing::DoAll(
                 testing::SaveArg<0>(&capturedTournament),
-                testing::Return(std::expected<std::string, std::string>{"new-id"})
+                testing::Return(std::expected<domain::Uuid, std::string>{NEW_TOURNAMENT})
             )
         );
 
@@ -53,7 +64,7 @@ TEST_F(TournamentControllerTest, CreateTournament_Success201) {
     testing::Mock::VerifyAndClearExpectations(&tournamentDelegateMock);
 
     EXPECT_EQ(crow::CREATED, response.code);
-    EXPECT_EQ("new-id", response.get_header_value("location"));
+    EXPECT_EQ(NEW_TOURNAMENT.ToString(), response.get_header_value("location"));
     EXPECT_EQ(tournamentRequestBody.at("name").get<std::string>(), capturedTournament.Name());
 }
 
@@ -70,57 +81,79 @@ TEST_F(TournamentControllerTest, CreateTournament_Conflict409) {
     EXPECT_EQ(crow::CONFLICT, response.code);
 }
 
+TEST_F(TournamentControllerTest, CreateTournament_InvalidBody400WithoutDelegateCall) {
+    EXPECT_CALL(*tournamentDelegateMock, CreateTournament(::testing::_)).Times(0);
+
+    crow::request tournamentRequest;
+    tournamentRequest.body = R"({"format": {"numberOfGroups": 0, "type": "KNOCKOUT"}})";
+
+    crow::response response = tournamentController->CreateTournament(tournamentRequest);
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+    auto jsonResponse = nlohmann::json::parse(response.body);
+    ASSERT_EQ(3, jsonResponse["violations"].size());
+    EXPECT_EQ("format.numberOfGroups", jsonResponse["violations"][0]["field"]);
+    EXPECT_EQ("format.type", jsonResponse["violations"][1]["field"]);
+    EXPECT_EQ("name", jsonResponse["violations"][2]["field"]);
+}
+
 // --- Pruebas para GET /tournaments/{id} ---
 
 TEST_F(TournamentControllerTest, GetTournamentById_OK200) {
-    const std::string validUuid = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
+    constexpr domain::Uuid validUuid = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
     auto expectedTournament = std::make_shared<domain::Tournament>();
     expectedTournament->Id() = validUuid;
     expectedTournament->Name() = "Tournament Name";
+    expectedTournament->Version() = 2;
     // Mas datos sobre los grupos, etc podrian incluirse aqui
 
     EXPECT_CALL(*tournamentDelegateMock, GetTournament(testing::Eq(validUuid)))
         .WillOnce(testing::Return(expectedTournament));
 
-    crow::response response = tournamentController->GetTournament(validUuid);
+    crow::response response = tournamentController->GetTournament(crow::request{}, validUuid);
     auto jsonResponse = crow::json::load(response.body);
 
     EXPECT_EQ(crow::OK, response.code);
-    EXPECT_EQ(expectedTournament->Id(), jsonResponse["id"]);
+    EXPECT_EQ(expectedTournament->Id().ToString(), jsonResponse["id"]);
     EXPECT_EQ(expectedTournament->Name(), jsonResponse["name"]);
+    EXPECT_EQ("\"2\"", response.get_header_value("ETag"));
+}
+
+TEST_F(TournamentControllerTest, GetTournament_IfNoneMatchCurrent_304WithoutReadingTheTournament) {
+    constexpr domain::Uuid validUuid = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    EXPECT_CALL(*tournamentDelegateMock, GetTournamentVersion(testing::Eq(validUuid)))
+        .WillOnce(testing::Return(std::optional<std::int64_t>{2}));
+    EXPECT_CALL(*tournamentDelegateMock, GetTournament(testing::_)).Times(0);
+
+    crow::request request;
+    request.add_header("If-None-Match", "\"2\"");
+    crow::response response = tournamentController->GetTournament(request, validUuid);
+
+    EXPECT_EQ(crow::NOT_MODIFIED, response.code);
+    EXPECT_EQ("\"2\"", response.get_header_value("ETag"));
 }
 
 TEST_F(TournamentControllerTest, GetTournamentNotFound_nullptr404) {
-    const std::string validUuid = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
+    constexpr domain::Uuid validUuid = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
     EXPECT_CALL(*tournamentDelegateMock, GetTournament(testing::Eq(validUuid)))
         .WillOnce(testing::Return(nullptr));
 
-    crow::response response = tournamentController->GetTournament(validUuid);
+    crow::response response = tournamentController->GetTournament(crow::request{}, validUuid);
 
     EXPECT_EQ(crow::NOT_FOUND, response.code);
 }
 
-TEST_F(TournamentControllerTest, GetTournamentById_ErrorFormat400) {
-    crow::response badRequest = tournamentController->GetTournament("");
-    EXPECT_EQ(badRequest.code, crow::BAD_REQUEST);
-
-    badRequest = tournamentController->GetTournament("mfasd#*");
-    EXPECT_EQ(badRequest.code, crow::BAD_REQUEST);
-}
-
 // --- Pruebas para GET /tournaments ---
 
 TEST_F(TournamentControllerTest, ReadAll_ReturnsListOfTournaments200) {
-    auto tournament1 = std::make_shared<domain::Tournament>();
-    auto tournament2 = std::make_shared<domain::Tournament>();
-    tournament1->Id() = "id-1"; tournament1->Name() = "Tournament 1";
-    tournament2->Id() = "id-2"; tournament2->Name() = "Tournament 2";
-    std::vector<std::shared_ptr<domain::Tournament>> expectedTournaments = {tournament1, tournament2};
-
-    EXPECT_CALL(*tournamentDelegateMock, ReadAll())
-        .WillOnce(testing::Return(expectedTournaments));
-
-    crow::response response = tournamentController->ReadAll();
+    EXPECT_CALL(*tournamentDelegateMock, ExportAll(::testing::_, MAX_EXPORT_ROWS))
+        .WillOnce([](const std::function<void(std::string_view)>& writeRow, std::size_t) {
+            writeRow(R"({"id": "id-1", "name": "Tournament 1"})");
+            writeRow(R"({"id": "id-2", "name": "Tournament 2"})");
+            return true;
+        });
+
+    crow::response response = tournamentController->ReadAll(crow::request{});
     auto jsonResponse = nlohmann::json::parse(response.body);
 
     EXPECT_EQ(crow::OK, response.code);
@@ -131,12 +164,10 @@ TEST_F(TournamentControllerTest, ReadAll_ReturnsListOfTournaments200) {
 }
 
 TEST_F(TournamentControllerTest, ReadAll_ReturnsEmptyList200) {
-    std::vector<std::shared_ptr<domain::Tournament>> emptyList;
-
-    EXPECT_CALL(*tournamentDelegateMock, ReadAll())
-        .WillOnce(testing::Return(emptyList));
+    EXPECT_CALL(*tournamentDelegateMock, ExportAll(::testing::_, ::testing::_))
+        .WillOnce(testing::Return(true));
 
-    crow::response response = tournamentController->ReadAll();
+    crow::response response = tournamentController->ReadAll(crow::request{});
     auto jsonResponse = nlohmann::json::parse(response.body);
 
     EXPECT_EQ(crow::OK, response.code);
@@ -144,16 +175,28 @@ TEST_F(TournamentControllerTest, ReadAll_ReturnsEmptyList200) {
     EXPECT_EQ(0, jsonResponse.size());
 }
 
+TEST_F(TournamentControllerTest, ReadAll_ExportOverCap413) {
+    EXPECT_CALL(*tournamentDelegateMock, ExportAll(::testing::_, MAX_EXPORT_ROWS))
+        .WillOnce(testing::Return(false));
+    EXPECT_CALL(*tournamentDelegateMock, ReadPage(::testing::_, ::testing::_))
+        .Times(0);
+
+    crow::response response = tournamentController->ReadAll(crow::request{});
+
+    EXPECT_EQ(PAYLOAD_TOO_LARGE, response.code);
+    EXPECT_EQ(std::format("</tournaments?limit={}>; rel=\"first\"", MAX_PAGE_SIZE), response.get_header_value("Link"));
+}
+
 // --- Pruebas para PATCH /tournaments/{id} ---
 
 TEST_F(TournamentControllerTest, UpdateTournament_Success204) {
-    const std::string tournamentIdToUpdate = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
+    constexpr domain::Uuid tournamentIdToUpdate = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
     std::shared_ptr<domain::Tournament> capturedTournament;
 
     EXPECT_CALL(*tournamentDelegateMock, UpdateTournament(::testing::_))
         .WillOnce(testing::DoAll(
             testing::SaveArg<0>(&capturedTournament),
-            testing::Return(std::expected<std::string, std::string>{tournamentIdToUpdate})
+            testing::Return(std::expected<domain::Uuid, std::string>{tournamentIdToUpdate})
         ));
 
     nlohmann::json tournamentRequestBody = {{"id", tournamentIdToUpdate}, {"name", "Updated Tournament Name"}};
@@ -169,7 +212,7 @@ TEST_F(TournamentControllerTest, UpdateTournament_Success204) {
 }
 
 TEST_F(TournamentControllerTest, UpdateTournament_NotFound404) {
-    const std::string tournamentIdToUpdate = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
+    constexpr domain::Uuid tournamentIdToUpdate = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
 
     EXPECT_CALL(*tournamentDelegateMock, UpdateTournament(::testing::_))
     .WillOnce(testing::Return(std::unexpected("Entry not found.")));
@@ -184,7 +227,7 @@ TEST_F(TournamentControllerTest, UpdateTournament_NotFound404) {
 }
 
 TEST_F(TournamentControllerTest, UpdateTournament_Conflict409) {
-    const std::string tournamentIdToUpdate = "8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b";
+    constexpr domain::Uuid tournamentIdToUpdate = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
 
     EXPECT_CALL(*tournamentDelegateMock, UpdateTournament(::testing::_))
     .WillOnce(testing::Return(std::unexpected("Entry already exists.")));
@@ -198,10 +241,40 @@ TEST_F(TournamentControllerTest, UpdateTournament_Conflict409) {
     EXPECT_EQ(crow::CONFLICT, response.code);
 }
 
+TEST_F(TournamentControllerTest, UpdateTournament_IfMatchStale_412) {
+    constexpr domain::Uuid tournamentIdToUpdate = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    std::shared_ptr<domain::Tournament> capturedTournament;
+
+    EXPECT_CALL(*tournamentDelegateMock, UpdateTournament(::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<0>(&capturedTournament),
+            testing::Return(std::unexpected(domain::VersionMismatchException().what()))));
+
+    crow::request tournamentRequest;
+    tournamentRequest.body = nlohmann::json{{"id", tournamentIdToUpdate}, {"name", "Tournament Name"}}.dump();
+    tournamentRequest.add_header("If-Match", "\"5\"");
+
+    crow::response response = tournamentController->UpdateTournament(tournamentRequest);
+
+    EXPECT_EQ(412, response.code);
+    EXPECT_EQ(5, capturedTournament->Version());
+}
+
+TEST_F(TournamentControllerTest, GetTournamentById_ErrorFormat400) {
+    // La ruta registrada valida el id antes de llegar al controlador.
+    EXPECT_CALL(*tournamentDelegateMock, GetTournament(testing::_)).Times(0);
+    RouteHarness routes(tournamentController, {"/tournaments/<string>"});
+
+    crow::response response = routes.Handle(crow::HTTPMethod::Get, "/tournaments/mfasd*");
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+    EXPECT_EQ(domain::INVALID_ID_MESSAGE, response.body);
+}
+
 // --- Pruebas para DELETE /tournaments/{id} ---
 
 TEST_F(TournamentControllerTest, DeleteTournament_Success204) {
-    const std::string tournamentIdToDelete = "feb3b050-f7b8-4610-808a-1b01b8d61f2e";
+    constexpr domain::Uuid tournamentIdToDelete = *domain::Uuid::Parse("feb3b050-f7b8-4610-808a-1b01b8d61f2e");
 
     EXPECT_CALL(*tournamentDelegateMock, DeleteTournament(tournamentIdToDelete))
         .WillOnce(testing::Return(std::expected<void, std::string>{}));
@@ -212,7 +285,7 @@ TEST_F(TournamentControllerTest, DeleteTournament_Success204) {
 }
 
 TEST_F(TournamentControllerTest, DeleteTournament_NotFound404) {
-    const std::string tournamentIdToDelete = "feb3b050-f7b8-4610-808a-1b01b8d61f2e";
+    constexpr domain::Uuid tournamentIdToDelete = *domain::Uuid::Parse("feb3b050-f7b8-4610-808a-1b01b8d61f2e");
 
     EXPECT_CALL(*tournamentDelegateMock, DeleteTournament(tournamentIdToDelete))
         .WillOnce(testing::Return(std::unexpected("Entry not found.")));
@@ -223,9 +296,69 @@ TEST_F(TournamentControllerTest, DeleteTournament_NotFound404) {
 }
 
 TEST_F(TournamentControllerTest, DeleteTournament_InvalidFormat400) {
-    crow::response badRequest = tournamentController->DeleteTournament("");
-    EXPECT_EQ(badRequest.code, crow::BAD_REQUEST);
+    EXPECT_CALL(*tournamentDelegateMock, DeleteTournament(testing::_)).Times(0);
+    RouteHarness routes(tournamentController, {"/tournaments/<string>"});
 
-    badRequest = tournamentController->DeleteTournament("mfasd#*");
-    EXPECT_EQ(badRequest.code, crow::BAD_REQUEST);
-}
\ No newline at end of file
+    crow::response response = routes.Handle(crow::HTTPMethod::Delete, "/tournaments/not-a-uuid");
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+    EXPECT_EQ(domain::INVALID_ID_MESSAGE, response.body);
+}
+
+TEST_F(TournamentControllerTest, ReadAll_LastPageHasNoNextLink200) {
+    crow::request request;
+    request.url_params = crow::query_string("/tournaments?limit=5");
+
+    auto tournament = std::make_shared<domain::Tournament>();
+    tournament->Id() = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    tournament->Name() = "Cup";
+    EXPECT_CALL(*tournamentDelegateMock, ReadPage(std::optional<domain::Uuid>{}, 5))
+        .WillOnce(testing::Return(std::vector{tournament}));
+
+    crow::response response = tournamentController->ReadAll(request);
+    auto jsonResponse = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(crow::OK, response.code);
+    ASSERT_EQ(1, jsonResponse.size());
+    EXPECT_EQ("", response.get_header_value("Link"));
+}
+
+TEST_F(TournamentControllerTest, GetStandings_OK200) {
+    constexpr domain::Uuid tournamentId = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    std::vector<domain::Standing> standings{{TEAM_A, "Team A", 3, 1, 0, 17}};
+    EXPECT_CALL(*tournamentDelegateMock, GetStandings(tournamentId))
+        .WillOnce(testing::Return(std::expected<std::vector<domain::Standing>, std::string>{standings}));
+
+    crow::response response = tournamentController->GetStandings(tournamentId);
+    auto jsonResponse = nlohmann::json::parse(response.body);
+
+    EXPECT_EQ(crow::OK, response.code);
+    EXPECT_EQ("application/json", response.get_header_value("content-type"));
+    ASSERT_EQ(1, jsonResponse.size());
+    EXPECT_EQ(TEAM_A.ToString(), jsonResponse[0]["teamId"]);
+    EXPECT_EQ("Team A", jsonResponse[0]["teamName"]);
+    EXPECT_EQ(3, jsonResponse[0]["wins"]);
+    EXPECT_EQ(1, jsonResponse[0]["losses"]);
+    EXPECT_EQ(0, jsonResponse[0]["ties"]);
+    EXPECT_EQ(17, jsonResponse[0]["netPoints"]);
+}
+
+TEST_F(TournamentControllerTest, GetStandings_NotFound404) {
+    constexpr domain::Uuid tournamentId = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    EXPECT_CALL(*tournamentDelegateMock, GetStandings(tournamentId))
+        .WillOnce(testing::Return(std::unexpected<std::string>("Tournament not found.")));
+
+    crow::response response = tournamentController->GetStandings(tournamentId);
+
+    EXPECT_EQ(crow::NOT_FOUND, response.code);
+}
+
+TEST_F(TournamentControllerTest, GetStandings_InvalidFormat400) {
+    EXPECT_CALL(*tournamentDelegateMock, GetStandings(testing::_)).Times(0);
+    RouteHarness routes(tournamentController, {"/tournaments/<string>/standings"});
+
+    crow::response response = routes.Handle(crow::HTTPMethod::Get, "/tournaments/not-a-uuid/standings");
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+    EXPECT_EQ(domain::INVALID_ID_MESSAGE, response.body);
+}
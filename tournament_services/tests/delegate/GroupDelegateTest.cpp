@@ -7,6 +7,7 @@
 #include <memory>
 #include <vector>
 #include <expected>
+#include <format>
 #include <string>
 
 #include "persistence/repository/TournamentRepository.hpp"
@@ -18,39 +19,90 @@
 #include "domain/Team.hpp"
 #include "domain/Utilities.hpp"
 #include "delegate/GroupDelegate.hpp"
+#include "persistence/repository/IAsyncGroupRepository.hpp"
+#include "persistence/async/QueryResult.hpp"
+
+template<typename T>
+Task<T> readyTask(T value) {
+    co_return value;
+}
+
+namespace {
+    constexpr domain::Uuid TOURNAMENT = *domain::Uuid::Parse("0b9b3f3e-8f4b-4a3e-9c1d-0b7a8e1f2a3b");
+    constexpr domain::Uuid GROUP = *domain::Uuid::Parse("c4e1b8a1-3b7c-4c6e-8d2f-1c5a9b3d4e5f");
+    constexpr domain::Uuid LAST_GROUP = *domain::Uuid::Parse("c4e1b8a1-3b7c-4c6e-8d2f-1c5a9b3d4e60");
+    constexpr domain::Uuid TEAM_1 = *domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000001");
+    constexpr domain::Uuid TEAM_2 = *domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000002");
+    constexpr domain::Uuid TEAM_3 = *domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000003");
+    constexpr domain::Uuid TEAM_XYZ = *domain::Uuid::Parse("3f7c2a1e-5d4b-4c8a-9e6f-2b1d0c9a8e7f");
+    constexpr domain::Uuid GHOST_TEAM = *domain::Uuid::Parse("9a8b7c6d-5e4f-4a3b-8c2d-1e0f9a8b7c6d");
+    constexpr domain::Uuid FINAL_TEAM = *domain::Uuid::Parse("feb3b050-f7b8-4610-808a-1b01b8d61f2e");
+}
 
 // Mocks para todas las dependencias del Delegate
-class TournamentRepositoryMock : public IRepository<domain::Tournament, std::string> {
+class TournamentRepositoryMock : public ITournamentRepository {
 public:
-    MOCK_METHOD((std::shared_ptr<domain::Tournament>), ReadById, (std::string id), (override));
-    MOCK_METHOD(std::string, Create, (const domain::Tournament& entity), (override));
-    MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
-    MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD((std::shared_ptr<domain::Tournament>), ReadById, (domain::Uuid id), (override));
+    MOCK_METHOD(std::optional<std::int64_t>, ReadVersion, (domain::Uuid id), (override));
+    MOCK_METHOD(domain::Uuid, Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(domain::Uuid, Update, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(void, Delete, (domain::Uuid id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadPage, (const std::optional<domain::Uuid>& after, std::size_t limit), (override));
+    MOCK_METHOD(bool, ExportAll, (const std::function<void(std::string_view)>& writeRow, std::size_t limit), (override));
 };
 
 class GroupRepositoryMock : public IGroupRepository {
 public:
-    MOCK_METHOD((std::shared_ptr<domain::Group>), ReadById, (std::string id), (override));
-    MOCK_METHOD(std::string, Create, (const domain::Group& entity), (override));
-    MOCK_METHOD(std::string, Update, (const domain::Group& entity), (override));
-    MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD((std::shared_ptr<domain::Group>), ReadById, (domain::Uuid id), (override));
+    MOCK_METHOD(domain::Uuid, Create, (const domain::Group& entity), (override));
+    MOCK_METHOD(domain::Uuid, Update, (const domain::Group& entity), (override));
+    MOCK_METHOD(void, Delete, (domain::Uuid id), (override));
     MOCK_METHOD((std::vector<std::shared_ptr<domain::Group>>), ReadAll, (), (override));
-    MOCK_METHOD((std::vector<std::shared_ptr<domain::Group>>), FindByTournamentId, (const std::string_view& tournamentId), (override));
-    MOCK_METHOD((std::shared_ptr<domain::Group>), FindByTournamentIdAndGroupId, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
-    MOCK_METHOD((std::shared_ptr<domain::Group>), FindByTournamentIdAndTeamId, (const std::string_view& tournamentId, const std::string_view& teamId), (override));
-    MOCK_METHOD(void, UpdateGroupAddTeam, (std::string_view groupId, const domain::Team& team), (override));
+    MOCK_METHOD((std::vector<std::shared_ptr<domain::Group>>), FindByTournamentId, (const domain::Uuid& tournamentId), (override));
+    MOCK_METHOD((std::shared_ptr<domain::Group>), FindByTournamentIdAndGroupId, (const domain::Uuid& tournamentId, const domain::Uuid& groupId), (override));
+    MOCK_METHOD((std::shared_ptr<domain::Group>), FindByTournamentIdAndTeamId, (const domain::Uuid& tournamentId, const domain::Uuid& teamId), (override));
+    MOCK_METHOD((std::vector<domain::Uuid>), FindGroupedTeamIds, (const domain::Uuid& tournamentId, const std::vector<domain::Uuid>& teamIds), (override));
+    MOCK_METHOD(AddTeamStatus, AddTeamToGroup, (const domain::Uuid& tournamentId, const domain::Uuid& groupId, const domain::Uuid& teamId, std::size_t maxTeams), (override));
 };
 
-class TeamRepositoryMock : public IRepository<domain::Team, std::string> {
+class TeamRepositoryMock : public ITeamRepository {
 public:
-    MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string id), (override));
-    MOCK_METHOD(std::string, Create, (const domain::Team& entity), (override));
-    MOCK_METHOD(std::string, Update, (const domain::Team& entity), (override));
-    MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (domain::Uuid id), (override));
+    MOCK_METHOD(std::optional<std::int64_t>, ReadVersion, (domain::Uuid id), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadByIds, (const std::vector<domain::Uuid>& ids), (override));
+    MOCK_METHOD(BulkImportResult, CreateMany, (const std::vector<domain::Team>& teams), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadPage, (const std::optional<domain::Uuid>& after, std::size_t limit), (override));
+    MOCK_METHOD(bool, ExportAll, (const std::function<void(std::string_view)>& writeRow, std::size_t limit), (override));
+    MOCK_METHOD(domain::Uuid, Create, (const domain::Team& entity), (override));
+    MOCK_METHOD(domain::Uuid, Update, (const domain::Team& entity), (override));
+    MOCK_METHOD(void, Delete, (domain::Uuid id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
 };
 
+class AsyncTournamentRepositoryMock : public IAsyncRepository<domain::Tournament, domain::Uuid> {
+public:
+    MOCK_METHOD((Task<std::shared_ptr<domain::Tournament>>), ReadById, (domain::Uuid id), (override));
+    MOCK_METHOD((Task<domain::Uuid>), Create, (domain::Tournament entity), (override));
+    MOCK_METHOD((Task<domain::Uuid>), Update, (domain::Tournament entity), (override));
+    MOCK_METHOD((Task<void>), Delete, (domain::Uuid id), (override));
+    MOCK_METHOD((Task<std::vector<std::shared_ptr<domain::Tournament>>>), ReadAll, (), (override));
+};
+
+class AsyncGroupRepositoryMock : public IAsyncGroupRepository {
+public:
+    MOCK_METHOD((Task<std::shared_ptr<domain::Group>>), ReadById, (domain::Uuid id), (override));
+    MOCK_METHOD((Task<domain::Uuid>), Create, (domain::Group entity), (override));
+    MOCK_METHOD((Task<domain::Uuid>), Update, (domain::Group entity), (override));
+    MOCK_METHOD((Task<void>), Delete, (domain::Uuid id), (override));
+    MOCK_METHOD((Task<std::vector<std::shared_ptr<domain::Group>>>), ReadAll, (), (override));
+    MOCK_METHOD((Task<std::vector<std::shared_ptr<domain::Group>>>), FindByTournamentId, (domain::Uuid tournamentId), (override));
+    MOCK_METHOD((Task<std::optional<std::string>>), FindJsonByTournamentId, (domain::Uuid tournamentId), (override));
+    MOCK_METHOD((Task<std::shared_ptr<domain::Group>>), FindByTournamentIdAndGroupId, (domain::Uuid tournamentId, domain::Uuid groupId), (override));
+    MOCK_METHOD((Task<std::optional<std::int64_t>>), FindVersion, (domain::Uuid tournamentId, domain::Uuid groupId), (override));
+    MOCK_METHOD((Task<AddTeamStatus>), AddTeamToGroup, (domain::Uuid tournamentId, domain::Uuid groupId, domain::Uuid teamId, std::size_t maxTeams), (override));
+};
+
 class QueueMessageProducerMock : public IQueueMessageProducer {
 public:
     MOCK_METHOD(void, SendMessage, (const std::string_view& message, const std::string_view& routingKey), (override));
@@ -62,6 +114,8 @@ protected:
     std::shared_ptr<GroupRepositoryMock> groupRepoMock;
     std::shared_ptr<TeamRepositoryMock> teamRepoMock;
     std::shared_ptr<QueueMessageProducerMock> producerMock;
+    std::shared_ptr<AsyncTournamentRepositoryMock> asyncTournamentRepoMock;
+    std::shared_ptr<AsyncGroupRepositoryMock> asyncGroupRepoMock;
     std::shared_ptr<GroupDelegate> groupDelegate;
 
     void SetUp() override {
@@ -69,12 +123,17 @@ protected:
         groupRepoMock = std::make_shared<GroupRepositoryMock>();
         teamRepoMock = std::make_shared<TeamRepositoryMock>();
         producerMock = std::make_shared<QueueMessageProducerMock>();
+        asyncTournamentRepoMock = std::make_shared<AsyncTournamentRepositoryMock>();
+        asyncGroupRepoMock = std::make_shared<AsyncGroupRepositoryMock>();
 
         groupDelegate = std::make_shared<GroupDelegate>(
             tournamentRepoMock,
             groupRepoMock,
             teamRepoMock,
-            producerMock
+            producerMock,
+            asyncTournamentRepoMock,
+            asyncGroupRepoMock,
+            std::make_shared<ResponseCache>()
         );
     }
 };
@@ -82,10 +141,10 @@ protected:
 // Pruebas para CreateGroup
 
 TEST_F(GroupDelegateTest, CreateGroup_Success) {
-    const std::string tournamentId = "tour-123";
+    const domain::Uuid tournamentId = TOURNAMENT;
     domain::Group groupPayload;
     groupPayload.Name() = "Group A";
-    const std::string newGroupId = "group-abc";
+    const domain::Uuid newGroupId = GROUP;
 
     auto mockTournament = std::make_shared<domain::Tournament>();
     mockTournament->Id() = tournamentId;
@@ -110,14 +169,14 @@ TEST_F(GroupDelegateTest, CreateGroup_FailsWhenTournamentNotFound) {
         .WillOnce(testing::Return(nullptr));
 
     domain::Group dummyGroup;
-    auto result = groupDelegate->CreateGroup("tour-123", dummyGroup);
+    auto result = groupDelegate->CreateGroup(TOURNAMENT, dummyGroup);
 
     ASSERT_FALSE(result.has_value());
     EXPECT_EQ("Tournament not found.", result.error());
 }
 
 TEST_F(GroupDelegateTest, CreateGroup_FailsWhenMaxGroupsReached) {
-    const std::string tournamentId = "tour-123";
+    const domain::Uuid tournamentId = TOURNAMENT;
     std::vector<std::shared_ptr<domain::Group>> fullGroups(8);
 
     EXPECT_CALL(*tournamentRepoMock, ReadById(tournamentId))
@@ -133,7 +192,7 @@ TEST_F(GroupDelegateTest, CreateGroup_FailsWhenMaxGroupsReached) {
 }
 
 TEST_F(GroupDelegateTest, CreateGroup_FailsOnDuplicateName) {
-    const std::string tournamentId = "tour-123";
+    const domain::Uuid tournamentId = TOURNAMENT;
     domain::Group groupPayload;
     groupPayload.Name() = "Group A";
 
@@ -152,7 +211,7 @@ TEST_F(GroupDelegateTest, CreateGroup_FailsOnDuplicateName) {
 }
 
 TEST_F(GroupDelegateTest, CreateGroup_FailsWithTooManyTeamsInPayload) {
-    const std::string tournamentId = "tour-123";
+    const domain::Uuid tournamentId = TOURNAMENT;
     domain::Group groupPayload;
     groupPayload.Name() = "Group A";
     groupPayload.Teams().resize(5); // Payload con 5 equipos (límite es 4)
@@ -168,21 +227,91 @@ TEST_F(GroupDelegateTest, CreateGroup_FailsWithTooManyTeamsInPayload) {
     EXPECT_NE(std::string::npos, result.error().find("cannot have more than"));
 }
 
+TEST_F(GroupDelegateTest, CreateGroup_ValidatesAllTeamsWithOneLookupEach) {
+    const domain::Uuid tournamentId = TOURNAMENT;
+    domain::Group groupPayload;
+    groupPayload.Name() = "Group A";
+    groupPayload.Teams() = {{TEAM_1, "Team 1"}, {TEAM_2, "Team 2"}, {TEAM_3, "Team 3"}};
+    const std::vector<domain::Uuid> teamIds{TEAM_1, TEAM_2, TEAM_3};
+
+    EXPECT_CALL(*tournamentRepoMock, ReadById(tournamentId))
+        .WillOnce(testing::Return(std::make_shared<domain::Tournament>()));
+    EXPECT_CALL(*groupRepoMock, FindByTournamentId(tournamentId))
+        .Times(2)
+        .WillRepeatedly(testing::Return(std::vector<std::shared_ptr<domain::Group>>{}));
+    EXPECT_CALL(*teamRepoMock, ReadByIds(teamIds))
+        .WillOnce(testing::Return(std::vector{
+            std::make_shared<domain::Team>(domain::Team{TEAM_1, "Team 1"}),
+            std::make_shared<domain::Team>(domain::Team{TEAM_2, "Team 2"}),
+            std::make_shared<domain::Team>(domain::Team{TEAM_3, "Team 3"})}));
+    EXPECT_CALL(*groupRepoMock, FindGroupedTeamIds(tournamentId, teamIds))
+        .WillOnce(testing::Return(std::vector<domain::Uuid>{}));
+    EXPECT_CALL(*groupRepoMock, Create(::testing::_))
+        .WillOnce(testing::Return(GROUP));
+
+    auto result = groupDelegate->CreateGroup(tournamentId, groupPayload);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(GROUP, result.value());
+}
+
+TEST_F(GroupDelegateTest, CreateGroup_FailsWhenOneTeamDoesNotExist) {
+    const domain::Uuid tournamentId = TOURNAMENT;
+    domain::Group groupPayload;
+    groupPayload.Teams() = {{TEAM_1, "Team 1"}, {TEAM_2, "Team 2"}};
+
+    EXPECT_CALL(*tournamentRepoMock, ReadById(tournamentId))
+        .WillOnce(testing::Return(std::make_shared<domain::Tournament>()));
+    EXPECT_CALL(*groupRepoMock, FindByTournamentId(tournamentId))
+        .WillOnce(testing::Return(std::vector<std::shared_ptr<domain::Group>>{}));
+    EXPECT_CALL(*teamRepoMock, ReadByIds(::testing::_))
+        .WillOnce(testing::Return(std::vector{std::make_shared<domain::Team>(domain::Team{TEAM_1, "Team 1"})}));
+    EXPECT_CALL(*groupRepoMock, Create(::testing::_)).Times(0);
+
+    auto result = groupDelegate->CreateGroup(tournamentId, groupPayload);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(std::format("Team with ID {} does not exist.", TEAM_2), result.error());
+}
+
+TEST_F(GroupDelegateTest, CreateGroup_FailsWhenTeamAlreadyGrouped) {
+    const domain::Uuid tournamentId = TOURNAMENT;
+    domain::Group groupPayload;
+    groupPayload.Teams() = {{TEAM_1, "Team 1"}, {TEAM_2, "Team 2"}};
+
+    EXPECT_CALL(*tournamentRepoMock, ReadById(tournamentId))
+        .WillOnce(testing::Return(std::make_shared<domain::Tournament>()));
+    EXPECT_CALL(*groupRepoMock, FindByTournamentId(tournamentId))
+        .WillOnce(testing::Return(std::vector<std::shared_ptr<domain::Group>>{}));
+    EXPECT_CALL(*teamRepoMock, ReadByIds(::testing::_))
+        .WillOnce(testing::Return(std::vector{
+            std::make_shared<domain::Team>(domain::Team{TEAM_1, "Team 1"}),
+            std::make_shared<domain::Team>(domain::Team{TEAM_2, "Team 2"})}));
+    EXPECT_CALL(*groupRepoMock, FindGroupedTeamIds(tournamentId, ::testing::_))
+        .WillOnce(testing::Return(std::vector<domain::Uuid>{TEAM_2}));
+    EXPECT_CALL(*groupRepoMock, Create(::testing::_)).Times(0);
+
+    auto result = groupDelegate->CreateGroup(tournamentId, groupPayload);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ("Team Team 2 is already in another group in this tournament.", result.error());
+}
+
 // Pruebas para GetGroup
 
 TEST_F(GroupDelegateTest, GetGroup_Success) {
-    const std::string tournamentId = "tour-123";
-    const std::string groupId = "group-abc";
+    const domain::Uuid tournamentId = TOURNAMENT;
+    const domain::Uuid groupId = GROUP;
     auto expectedGroup = std::make_shared<domain::Group>();
     expectedGroup->Id() = groupId;
     expectedGroup->Name() = "Group A";
 
-    EXPECT_CALL(*tournamentRepoMock, ReadById(tournamentId))
-        .WillOnce(testing::Return(std::make_shared<domain::Tournament>()));
-    EXPECT_CALL(*groupRepoMock, FindByTournamentIdAndGroupId(tournamentId, groupId))
-        .WillOnce(testing::Return(expectedGroup));
+    EXPECT_CALL(*asyncTournamentRepoMock, ReadById(tournamentId))
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::make_shared<domain::Tournament>()))));
+    EXPECT_CALL(*asyncGroupRepoMock, FindByTournamentIdAndGroupId(tournamentId, groupId))
+        .WillOnce(testing::Return(testing::ByMove(readyTask(expectedGroup))));
 
-    auto result = groupDelegate->GetGroup(tournamentId, groupId);
+    auto result = SyncWait(groupDelegate->GetGroup(tournamentId, groupId));
 
     ASSERT_TRUE(result.has_value());
     EXPECT_EQ(groupId, result.value().Id());
@@ -190,15 +319,15 @@ TEST_F(GroupDelegateTest, GetGroup_Success) {
 }
 
 TEST_F(GroupDelegateTest, GetGroup_FailsWhenNotFound) {
-    const std::string tournamentId = "tour-123";
-    const std::string groupId = "group-abc";
+    const domain::Uuid tournamentId = TOURNAMENT;
+    const domain::Uuid groupId = GROUP;
 
-    EXPECT_CALL(*tournamentRepoMock, ReadById(tournamentId))
-        .WillOnce(testing::Return(std::make_shared<domain::Tournament>()));
-    EXPECT_CALL(*groupRepoMock, FindByTournamentIdAndGroupId(tournamentId, groupId))
-        .WillOnce(testing::Return(nullptr)); // Simulamos que el grupo no se encuentra
+    EXPECT_CALL(*asyncTournamentRepoMock, ReadById(tournamentId))
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::make_shared<domain::Tournament>()))));
+    EXPECT_CALL(*asyncGroupRepoMock, FindByTournamentIdAndGroupId(tournamentId, groupId))
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::shared_ptr<domain::Group>{})))); // Simulamos que el grupo no se encuentra
 
-    auto result = groupDelegate->GetGroup(tournamentId, groupId);
+    auto result = SyncWait(groupDelegate->GetGroup(tournamentId, groupId));
 
     ASSERT_FALSE(result.has_value());
     EXPECT_EQ("Group not found in this tournament.", result.error());
@@ -207,20 +336,13 @@ TEST_F(GroupDelegateTest, GetGroup_FailsWhenNotFound) {
 // Pruebas para AddTeamToGroup
 
 TEST_F(GroupDelegateTest, AddTeamToGroup_Success) {
-    const std::string tournamentId = "tour-123";
-    const std::string groupId = "group-abc";
-    domain::Team teamToAdd{"team-xyz", "Team XYZ"};
+    const domain::Uuid tournamentId = TOURNAMENT;
+    const domain::Uuid groupId = GROUP;
+    domain::Team teamToAdd{TEAM_XYZ, "Team XYZ"};
 
-    auto group = std::make_shared<domain::Group>(); // Un grupo que no está lleno
-
-    EXPECT_CALL(*groupRepoMock, FindByTournamentIdAndGroupId(tournamentId, groupId))
-        .WillOnce(testing::Return(group));
-    EXPECT_CALL(*teamRepoMock, ReadById(teamToAdd.Id))
-        .WillOnce(testing::Return(std::make_shared<domain::Team>()));
-    EXPECT_CALL(*groupRepoMock, FindByTournamentIdAndTeamId(tournamentId, teamToAdd.Id))
-        .WillOnce(testing::Return(nullptr)); // El equipo no está en otro grupo
-    EXPECT_CALL(*groupRepoMock, UpdateGroupAddTeam(groupId, ::testing::_))
-        .Times(1);
+    // Una sola llamada verifica capacidad, existencia y pertenencia
+    EXPECT_CALL(*groupRepoMock, AddTeamToGroup(tournamentId, groupId, teamToAdd.Id, 4))
+        .WillOnce(testing::Return(AddTeamStatus::Added));
     EXPECT_CALL(*groupRepoMock, FindByTournamentId(tournamentId))
         .WillOnce(testing::Return(std::vector<std::shared_ptr<domain::Group>>{}));
 
@@ -229,16 +351,26 @@ TEST_F(GroupDelegateTest, AddTeamToGroup_Success) {
     EXPECT_TRUE(result.has_value());
 }
 
-TEST_F(GroupDelegateTest, AddTeamToGroup_FailsWhenGroupIsFull) {
-    const std::string tournamentId = "tour-123";
-    const std::string groupId = "group-abc";
-    domain::Team dummyTeam{"team-xyz", "Team XYZ"};
+TEST_F(GroupDelegateTest, AddTeamToGroup_FailsWhenGroupNotFound) {
+    const domain::Uuid tournamentId = TOURNAMENT, groupId = GROUP;
+    domain::Team teamToAdd{TEAM_XYZ, "Team XYZ"};
 
-    auto fullGroup = std::make_shared<domain::Group>();
-    fullGroup->Teams().resize(4); // Simulamos un grupo con 4 equipos
+    EXPECT_CALL(*groupRepoMock, AddTeamToGroup(tournamentId, groupId, teamToAdd.Id, ::testing::_))
+        .WillOnce(testing::Return(AddTeamStatus::GroupNotFound));
 
-    EXPECT_CALL(*groupRepoMock, FindByTournamentIdAndGroupId(tournamentId, groupId))
-        .WillOnce(testing::Return(fullGroup));
+    auto result = groupDelegate->AddTeamToGroup(tournamentId, groupId, teamToAdd);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ("Group not found in this tournament.", result.error());
+}
+
+TEST_F(GroupDelegateTest, AddTeamToGroup_FailsWhenGroupIsFull) {
+    const domain::Uuid tournamentId = TOURNAMENT;
+    const domain::Uuid groupId = GROUP;
+    domain::Team dummyTeam{TEAM_XYZ, "Team XYZ"};
+
+    EXPECT_CALL(*groupRepoMock, AddTeamToGroup(tournamentId, groupId, dummyTeam.Id, ::testing::_))
+        .WillOnce(testing::Return(AddTeamStatus::GroupFull));
 
     auto result = groupDelegate->AddTeamToGroup(tournamentId, groupId, dummyTeam);
 
@@ -247,14 +379,12 @@ TEST_F(GroupDelegateTest, AddTeamToGroup_FailsWhenGroupIsFull) {
 }
 
 TEST_F(GroupDelegateTest, AddTeamToGroup_FailsWhenTeamNotFound) {
-    const std::string tournamentId = "tour-123", groupId = "group-abc";
-    domain::Team teamToAdd{"non-existent-team-id", "Ghost Team"};
+    const domain::Uuid tournamentId = TOURNAMENT, groupId = GROUP;
+    domain::Team teamToAdd{GHOST_TEAM, "Ghost Team"};
 
-    EXPECT_CALL(*groupRepoMock, FindByTournamentIdAndGroupId(tournamentId, groupId))
-        .WillOnce(testing::Return(std::make_shared<domain::Group>()));
     // Simulamos que el equipo a añadir no existe en la base de datos
-    EXPECT_CALL(*teamRepoMock, ReadById(teamToAdd.Id))
-        .WillOnce(testing::Return(nullptr));
+    EXPECT_CALL(*groupRepoMock, AddTeamToGroup(tournamentId, groupId, teamToAdd.Id, ::testing::_))
+        .WillOnce(testing::Return(AddTeamStatus::TeamNotFound));
 
     auto result = groupDelegate->AddTeamToGroup(tournamentId, groupId, teamToAdd);
 
@@ -262,15 +392,26 @@ TEST_F(GroupDelegateTest, AddTeamToGroup_FailsWhenTeamNotFound) {
     EXPECT_NE(std::string::npos, result.error().find("does not exist"));
 }
 
+TEST_F(GroupDelegateTest, AddTeamToGroup_FailsWhenTeamAlreadyGrouped) {
+    const domain::Uuid tournamentId = TOURNAMENT, groupId = GROUP;
+    domain::Team teamToAdd{TEAM_XYZ, "Team XYZ"};
+
+    EXPECT_CALL(*groupRepoMock, AddTeamToGroup(tournamentId, groupId, teamToAdd.Id, ::testing::_))
+        .WillOnce(testing::Return(AddTeamStatus::TeamAlreadyGrouped));
+    EXPECT_CALL(*producerMock, SendMessage(::testing::_, ::testing::_)).Times(0);
+
+    auto result = groupDelegate->AddTeamToGroup(tournamentId, groupId, teamToAdd);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ("Team Team XYZ is already in a group in this tournament.", result.error());
+}
+
 // Pruebas para Lógica de Eventos
 
 TEST_F(GroupDelegateTest, EventIsPublished_WhenTournamentBecomesFull) {
-    const std::string tournamentId = "tour-123";
-    const std::string lastGroupId = "group-h";
-    domain::Team finalTeam{"team-final", "The Final Team"};
-
-    auto almostFullGroup = std::make_shared<domain::Group>();
-    almostFullGroup->Teams().resize(3);
+    const domain::Uuid tournamentId = TOURNAMENT;
+    const domain::Uuid lastGroupId = LAST_GROUP;
+    domain::Team finalTeam{FINAL_TEAM, "The Final Team"};
 
     std::vector<std::shared_ptr<domain::Group>> fullyPopulatedGroups(8);
     for(auto& group : fullyPopulatedGroups) {
@@ -278,19 +419,13 @@ TEST_F(GroupDelegateTest, EventIsPublished_WhenTournamentBecomesFull) {
         group->Teams().resize(4); // Ahora TODOS los grupos tienen 4 equipos.
     }
 
-    EXPECT_CALL(*groupRepoMock, FindByTournamentIdAndGroupId(tournamentId, lastGroupId))
-        .WillOnce(testing::Return(almostFullGroup));
-    EXPECT_CALL(*teamRepoMock, ReadById(finalTeam.Id))
-        .WillOnce(testing::Return(std::make_shared<domain::Team>()));
-    EXPECT_CALL(*groupRepoMock, FindByTournamentIdAndTeamId(tournamentId, finalTeam.Id))
-        .WillOnce(testing::Return(nullptr));
-    EXPECT_CALL(*groupRepoMock, UpdateGroupAddTeam(lastGroupId, ::testing::_))
-        .Times(1);
+    EXPECT_CALL(*groupRepoMock, AddTeamToGroup(tournamentId, lastGroupId, finalTeam.Id, ::testing::_))
+        .WillOnce(testing::Return(AddTeamStatus::Added));
 
     // Verificación del Evento
     EXPECT_CALL(*groupRepoMock, FindByTournamentId(tournamentId))
         .WillOnce(testing::Return(fullyPopulatedGroups));
-    EXPECT_CALL(*producerMock, SendMessage(tournamentId, "tournament.ready"))
+    EXPECT_CALL(*producerMock, SendMessage(tournamentId.ToString(), "tournament.ready"))
         .Times(1);
 
     auto result = groupDelegate->AddTeamToGroup(tournamentId, lastGroupId, finalTeam);
@@ -300,19 +435,43 @@ TEST_F(GroupDelegateTest, EventIsPublished_WhenTournamentBecomesFull) {
 
 // Pruebas para Get, Update, Delete (éxito)
 
-TEST_F(GroupDelegateTest, GetGroups_Success) {
-    const std::string tournamentId = "tour-123";
-    EXPECT_CALL(*tournamentRepoMock, ReadById(tournamentId))
-        .WillOnce(testing::Return(std::make_shared<domain::Tournament>()));
-    EXPECT_CALL(*groupRepoMock, FindByTournamentId(tournamentId))
-        .WillOnce(testing::Return(std::vector<std::shared_ptr<domain::Group>>{}));
+TEST_F(GroupDelegateTest, GetGroups_ForwardsTheDatabaseJson) {
+    const domain::Uuid tournamentId = TOURNAMENT;
+    const std::string groups = R"([{"id" : "g-1", "name" : "Group A", "teams" : [], "tournamentId" : "tour-123"}])";
+    EXPECT_CALL(*asyncGroupRepoMock, FindJsonByTournamentId(tournamentId))
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::optional<std::string>{groups}))));
+    EXPECT_CALL(*asyncTournamentRepoMock, ReadById(::testing::_)).Times(0);
+    EXPECT_CALL(*asyncGroupRepoMock, FindByTournamentId(::testing::_)).Times(0);
 
-    auto result = groupDelegate->GetGroups(tournamentId);
-    EXPECT_TRUE(result.has_value());
+    auto result = SyncWait(groupDelegate->GetGroups(tournamentId));
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(groups, result.value());
+}
+
+TEST_F(GroupDelegateTest, GetGroups_FailsWhenTournamentNotFound) {
+    const domain::Uuid tournamentId = TOURNAMENT;
+    EXPECT_CALL(*asyncGroupRepoMock, FindJsonByTournamentId(tournamentId))
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::optional<std::string>{}))));
+
+    auto result = SyncWait(groupDelegate->GetGroups(tournamentId));
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ("Tournament not found.", result.error());
+}
+
+TEST_F(GroupDelegateTest, GetGroups_PropagatesQueryFailure) {
+    const domain::Uuid tournamentId = TOURNAMENT;
+    EXPECT_CALL(*asyncGroupRepoMock, FindJsonByTournamentId(tournamentId))
+        .WillOnce([](domain::Uuid) -> Task<std::optional<std::string>> {
+            throw QueryException("server closed the connection unexpectedly", "08006");
+            co_return std::nullopt;
+        });
+
+    EXPECT_THROW(SyncWait(groupDelegate->GetGroups(tournamentId)), QueryException);
 }
 
 TEST_F(GroupDelegateTest, UpdateGroupName_Success) {
-    const std::string tournamentId = "tour-123", groupId = "group-abc";
+    const domain::Uuid tournamentId = TOURNAMENT, groupId = GROUP;
     domain::Group payload;
     payload.Name() = "New Name";
 
@@ -326,7 +485,7 @@ TEST_F(GroupDelegateTest, UpdateGroupName_Success) {
 }
 
 TEST_F(GroupDelegateTest, DeleteGroup_Success) {
-    const std::string tournamentId = "tour-123", groupId = "group-abc";
+    const domain::Uuid tournamentId = TOURNAMENT, groupId = GROUP;
     EXPECT_CALL(*groupRepoMock, FindByTournamentIdAndGroupId(tournamentId, groupId))
         .WillOnce(testing::Return(std::make_shared<domain::Group>()));
     EXPECT_CALL(*groupRepoMock, Delete(groupId))
@@ -336,9 +495,42 @@ TEST_F(GroupDelegateTest, DeleteGroup_Success) {
     EXPECT_TRUE(result.has_value());
 }
 
+TEST_F(GroupDelegateTest, UpdateGroupName_ConditionsOnThePayloadVersion) {
+    const domain::Uuid tournamentId = TOURNAMENT, groupId = GROUP;
+    domain::Group payload;
+    payload.Name() = "New Name";
+    payload.Version() = 3;
+    auto stored = std::make_shared<domain::Group>();
+    stored->Version() = 5;
+    domain::Group capturedGroup;
+
+    EXPECT_CALL(*groupRepoMock, FindByTournamentIdAndGroupId(tournamentId, groupId))
+        .WillOnce(testing::Return(stored));
+    EXPECT_CALL(*groupRepoMock, Update(::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<0>(&capturedGroup),
+            testing::Throw(domain::VersionMismatchException())));
+
+    auto result = groupDelegate->UpdateGroupName(tournamentId, groupId, payload);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(domain::VersionMismatchException().what(), result.error());
+    EXPECT_EQ(3, capturedGroup.Version());
+}
+
+TEST_F(GroupDelegateTest, GetGroupVersion_ProbesOnlyTheVersion) {
+    const domain::Uuid tournamentId = TOURNAMENT, groupId = GROUP;
+    EXPECT_CALL(*asyncGroupRepoMock, FindVersion(tournamentId, groupId))
+        .WillOnce(testing::Return(testing::ByMove(readyTask(std::optional<std::int64_t>{2}))));
+    EXPECT_CALL(*asyncGroupRepoMock, FindByTournamentIdAndGroupId(::testing::_, ::testing::_))
+        .Times(0);
+
+    EXPECT_EQ(std::optional<std::int64_t>{2}, SyncWait(groupDelegate->GetGroupVersion(tournamentId, groupId)));
+}
+
 // Falla UpdateGroup
 TEST_F(GroupDelegateTest, UpdateGroupName_FailsWhenNotFound) {
-    const std::string tournamentId = "tour-123", groupId = "group-abc";
+    const domain::Uuid tournamentId = TOURNAMENT, groupId = GROUP;
     domain::Group payload;
     payload.Name() = "New Name";
 
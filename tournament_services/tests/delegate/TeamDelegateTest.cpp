@@ -9,17 +9,22 @@
 #include <expected>
 #include <string>
 
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITeamRepository.hpp"
 #include "domain/Team.hpp"
 #include "domain/Utilities.hpp"
 #include "delegate/TeamDelegate.hpp"
 
-class TeamRepositoryMock : public IRepository<domain::Team, std::string> {
+class TeamRepositoryMock : public ITeamRepository {
 public:
-    MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string id), (override));
-    MOCK_METHOD(std::string, Create, (const domain::Team& entity), (override));
-    MOCK_METHOD(std::string, Update, (const domain::Team& entity), (override));
-    MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (domain::Uuid id), (override));
+    MOCK_METHOD(std::optional<std::int64_t>, ReadVersion, (domain::Uuid id), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadByIds, (const std::vector<domain::Uuid>& ids), (override));
+    MOCK_METHOD(BulkImportResult, CreateMany, (const std::vector<domain::Team>& teams), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadPage, (const std::optional<domain::Uuid>& after, std::size_t limit), (override));
+    MOCK_METHOD(bool, ExportAll, (const std::function<void(std::string_view)>& writeRow, std::size_t limit), (override));
+    MOCK_METHOD(domain::Uuid, Create, (const domain::Team& entity), (override));
+    MOCK_METHOD(domain::Uuid, Update, (const domain::Team& entity), (override));
+    MOCK_METHOD(void, Delete, (domain::Uuid id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
 };
 
@@ -30,15 +35,15 @@ protected:
 
     void SetUp() override {
         teamRepositoryMock = std::make_shared<TeamRepositoryMock>();
-        teamDelegate = std::make_shared<TeamDelegate>(teamRepositoryMock);
+        teamDelegate = std::make_shared<TeamDelegate>(teamRepositoryMock, std::make_shared<ResponseCache>());
     }
 };
 
 // Pruebas para SaveTeam
 TEST_F(TeamDelegateTest, SaveTeam_Success) {
-    domain::Team teamToSave{"", "New Team"};
+    domain::Team teamToSave{{}, "New Team"};
     domain::Team capturedTeam;
-    std::string generatedId = "new-uuid-123";
+    constexpr domain::Uuid generatedId = *domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000000");
 
     // Capturamos el argumento para verificarlo y simulamos que devuelve un ID.
     EXPECT_CALL(*teamRepositoryMock, Create(::testing::_))
@@ -56,7 +61,7 @@ TEST_F(TeamDelegateTest, SaveTeam_Success) {
 }
 
 TEST_F(TeamDelegateTest, SaveTeam_FailsOnDuplicate) {
-    domain::Team teamToSave{"", "Existing Team"};
+    domain::Team teamToSave{{}, "Existing Team"};
 
     // Simulamos que el repositorio lanza una excepción de duplicado.
     EXPECT_CALL(*teamRepositoryMock, Create(::testing::_))
@@ -70,7 +75,7 @@ TEST_F(TeamDelegateTest, SaveTeam_FailsOnDuplicate) {
 
 // Pruebas para GetTeam
 TEST_F(TeamDelegateTest, GetTeam_Success) {
-    std::string teamId = "existing-uuid";
+    constexpr domain::Uuid teamId = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
     auto expectedTeam = std::make_shared<domain::Team>(domain::Team{teamId, "Found Team"});
 
     // Simulamos que el repositorio encuentra el equipo y lo devuelve.
@@ -85,7 +90,7 @@ TEST_F(TeamDelegateTest, GetTeam_Success) {
 }
 
 TEST_F(TeamDelegateTest, GetTeam_NotFoundReturnsNull) {
-    std::string teamId = "non-existent-uuid";
+    constexpr domain::Uuid teamId = *domain::Uuid::Parse("9a8b7c6d-5e4f-4a3b-8c2d-1e0f9a8b7c6d");
 
     // Simulamos que el repositorio NO encuentra nada y devuelve nullptr.
     EXPECT_CALL(*teamRepositoryMock, ReadById(teamId))
@@ -99,8 +104,8 @@ TEST_F(TeamDelegateTest, GetTeam_NotFoundReturnsNull) {
 // Pruebas para GetAllTeams
 
 TEST_F(TeamDelegateTest, GetAllTeams_ReturnsList) {
-    auto team1 = std::make_shared<domain::Team>(domain::Team{"id-1", "Team 1"});
-    auto team2 = std::make_shared<domain::Team>(domain::Team{"id-2", "Team 2"});
+    auto team1 = std::make_shared<domain::Team>(domain::Team{*domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000001"), "Team 1"});
+    auto team2 = std::make_shared<domain::Team>(domain::Team{*domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-000000000002"), "Team 2"});
     std::vector<std::shared_ptr<domain::Team>> expectedList = {team1, team2};
 
     // Simulamos que el repositorio devuelve una lista con equipos.
@@ -128,8 +133,8 @@ TEST_F(TeamDelegateTest, GetAllTeams_ReturnsEmptyList) {
 // Pruebas para UpdateTeam
 
 TEST_F(TeamDelegateTest, UpdateTeam_Success) {
-    std::string teamId = "existing-uuid";
-    domain::Team updatePayload{"", "Updated Name"}; // El payload del PATCH no tiene ID
+    constexpr domain::Uuid teamId = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    domain::Team updatePayload{{}, "Updated Name"}; // El payload del PATCH no tiene ID
     domain::Team capturedTeam;
 
     // Simulamos que la actualización en el repo es exitosa.
@@ -149,8 +154,8 @@ TEST_F(TeamDelegateTest, UpdateTeam_Success) {
 }
 
 TEST_F(TeamDelegateTest, UpdateTeam_FailsOnNotFound) {
-    std::string teamId = "non-existent-uuid";
-    domain::Team updatePayload{"", "Updated Name"};
+    constexpr domain::Uuid teamId = *domain::Uuid::Parse("9a8b7c6d-5e4f-4a3b-8c2d-1e0f9a8b7c6d");
+    domain::Team updatePayload{{}, "Updated Name"};
 
     // Simulamos que el repo lanza una excepción porque no encuentra el ID.
     EXPECT_CALL(*teamRepositoryMock, Update(::testing::_))
@@ -162,10 +167,28 @@ TEST_F(TeamDelegateTest, UpdateTeam_FailsOnNotFound) {
     EXPECT_EQ("Entry not found.", result.error()); // El mensaje es el correcto.
 }
 
+TEST_F(TeamDelegateTest, UpdateTeam_StaleVersionIsReported) {
+    constexpr domain::Uuid teamId = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
+    domain::Team updatePayload{{}, "Updated Name", 4};
+    domain::Team capturedTeam;
+
+    // El repo recibe la versión del If-Match y la rechaza porque ya cambió.
+    EXPECT_CALL(*teamRepositoryMock, Update(::testing::_))
+        .WillOnce(testing::DoAll(
+            testing::SaveArg<0>(&capturedTeam),
+            testing::Throw(domain::VersionMismatchException())));
+
+    auto result = teamDelegate->UpdateTeam(teamId, updatePayload);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(domain::VersionMismatchException().what(), result.error());
+    EXPECT_EQ(4, capturedTeam.Version);
+}
+
 // Pruebas para DeleteTeam
 
 TEST_F(TeamDelegateTest, DeleteTeam_Success) {
-    const std::string teamIdToDelete = "existing-uuid";
+    constexpr domain::Uuid teamIdToDelete = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
 
     EXPECT_CALL(*teamRepositoryMock, Delete(teamIdToDelete))
         .WillOnce(testing::Return());
@@ -176,7 +199,7 @@ TEST_F(TeamDelegateTest, DeleteTeam_Success) {
 }
 
 TEST_F(TeamDelegateTest, DeleteTeam_FailsOnNotFound) {
-    const std::string teamIdToDelete = "non-existent-uuid";
+    constexpr domain::Uuid teamIdToDelete = *domain::Uuid::Parse("9a8b7c6d-5e4f-4a3b-8c2d-1e0f9a8b7c6d");
 
     // Simulamos que el repositorio lanza una excepción porque no encuentra el ID.
     EXPECT_CALL(*teamRepositoryMock, Delete(teamIdToDelete))
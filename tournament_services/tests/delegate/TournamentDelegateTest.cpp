@@ -5,7 +5,8 @@
 #include <expected>
 #include <string>
 
-#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITournamentRepository.hpp"
+#include "persistence/repository/IStandingRepository.hpp"
 #include "domain/Tournament.hpp"
 #include "domain/Utilities.hpp"
 #include "delegate/TournamentDelegate.hpp"
@@ -13,14 +14,29 @@
 #include "cms/IQueueMessageProducer.hpp"
 
 
+namespace {
+    constexpr domain::Uuid TEAM_A = *domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-00000000000a");
+    constexpr domain::Uuid TEAM_B = *domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-00000000000b");
+    constexpr domain::Uuid TEAM_C = *domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-00000000000c");
+    constexpr domain::Uuid TEAM_D = *domain::Uuid::Parse("6f1c2b9e-0000-4000-8000-00000000000d");
+}
+
 // Mock for TournamentRepository
-class TournamentRepositoryMock : public IRepository<domain::Tournament, std::string> {
+class TournamentRepositoryMock : public ITournamentRepository {
 public:
-    MOCK_METHOD((std::shared_ptr<domain::Tournament>), ReadById, (std::string id), (override));
-    MOCK_METHOD(std::string, Create, (const domain::Tournament& entity), (override));
-    MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
-    MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD((std::shared_ptr<domain::Tournament>), ReadById, (domain::Uuid id), (override));
+    MOCK_METHOD(std::optional<std::int64_t>, ReadVersion, (domain::Uuid id), (override));
+    MOCK_METHOD(domain::Uuid, Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(domain::Uuid, Update, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(void, Delete, (domain::Uuid id), (override));
     MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadPage, (const std::optional<domain::Uuid>& after, std::size_t limit), (override));
+    MOCK_METHOD(bool, ExportAll, (const std::function<void(std::string_view)>& writeRow, std::size_t limit), (override));
+};
+
+class StandingRepositoryMock : public IStandingRepository {
+public:
+    MOCK_METHOD(std::optional<std::vector<domain::Standing>>, FindByTournamentId, (const domain::Uuid& tournamentId), (override));
 };
 
 class QueueMessageProducerMock : public IQueueMessageProducer {
@@ -33,13 +49,15 @@ protected:
     std::shared_ptr<TournamentRepositoryMock> tournamentRepositoryMock;
     std::shared_ptr<IQueueMessageProducer> queueProducerMock;          // Interface pointer
     std::shared_ptr<QueueMessageProducerMock> queueProducerMockConcrete; // Concrete mock pointer
+    std::shared_ptr<StandingRepositoryMock> standingRepositoryMock;
     std::shared_ptr<TournamentDelegate> tournamentDelegate;
 
     void SetUp() override {
         tournamentRepositoryMock = std::make_shared<TournamentRepositoryMock>();
         queueProducerMockConcrete = std::make_shared<QueueMessageProducerMock>();
         queueProducerMock = queueProducerMockConcrete;  // Both reference same object
-        tournamentDelegate = std::make_shared<TournamentDelegate>(tournamentRepositoryMock, queueProducerMock);
+        standingRepositoryMock = std::make_shared<StandingRepositoryMock>();
+        tournamentDelegate = std::make_shared<TournamentDelegate>(tournamentRepositoryMock, queueProducerMock, standingRepositoryMock, std::make_shared<ResponseCache>());
     }
 };
 
@@ -58,7 +76,7 @@ protected:
 TEST_F(TournamentDelegateTest, CreateTournament_Success) {
     auto tournamentToCreate = std::make_shared<domain::Tournament>();
     tournamentToCreate->Name() = "New Tournament";
-    std::string generatedId = "new-tournament-uuid";
+    constexpr domain::Uuid generatedId = *domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11");
     domain::Tournament capturedTournament;
 
     EXPECT_CALL(*tournamentRepositoryMock, Create(::testing::_))
@@ -67,7 +85,7 @@ TEST_F(TournamentDelegateTest, CreateTournament_Success) {
             testing::Return(generatedId)
         ));
 
-    EXPECT_CALL(*queueProducerMockConcrete, SendMessage(generatedId, "tournament.created"))
+    EXPECT_CALL(*queueProducerMockConcrete, SendMessage(generatedId.ToString(), "tournament.created"))
         .Times(1);
 
     auto result = tournamentDelegate->CreateTournament(tournamentToCreate);
@@ -95,7 +113,7 @@ TEST_F(TournamentDelegateTest, CreateTournament_FailsOnDuplicate) {
 
 // Tests for GetTournament - ALREADY CORRECT
 TEST_F(TournamentDelegateTest, GetTournament_Success) {
-    std::string tournamentId = "existing-uuid";
+    constexpr domain::Uuid tournamentId = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
     auto expectedTournament = std::make_shared<domain::Tournament>();
     expectedTournament->Id() = tournamentId;
     expectedTournament->Name() = "Found Tournament";
@@ -111,7 +129,7 @@ TEST_F(TournamentDelegateTest, GetTournament_Success) {
 }
 
 TEST_F(TournamentDelegateTest, GetTournament_NotFoundReturnsNull) {
-    std::string tournamentId = "non-existent-uuid";
+    constexpr domain::Uuid tournamentId = *domain::Uuid::Parse("9a8b7c6d-5e4f-4a3b-8c2d-1e0f9a8b7c6d");
 
     EXPECT_CALL(*tournamentRepositoryMock, ReadById(tournamentId))
         .WillOnce(testing::Return(nullptr));
@@ -123,11 +141,11 @@ TEST_F(TournamentDelegateTest, GetTournament_NotFoundReturnsNull) {
 
 TEST_F(TournamentDelegateTest, GetAllTournaments_ReturnsList) {
     auto tournament1 = std::make_shared<domain::Tournament>();
-    tournament1->Id() = "id-1";
+    tournament1->Id() = *domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a01");
     tournament1->Name() = "Tournament 1";
 
     auto tournament2 = std::make_shared<domain::Tournament>();
-    tournament2->Id() = "id-2";
+    tournament2->Id() = *domain::Uuid::Parse("0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a02");
     tournament2->Name() = "Tournament 2";
 
     std::vector<std::shared_ptr<domain::Tournament>> expectedList = {tournament1, tournament2};
@@ -154,7 +172,7 @@ TEST_F(TournamentDelegateTest, GetAllTournaments_ReturnsEmptyList) {
 }
 
 TEST_F(TournamentDelegateTest, UpdateTournament_Success) {
-    std::string tournamentId = "existing-uuid";
+    constexpr domain::Uuid tournamentId = *domain::Uuid::Parse("8f1b5b6a-7b8c-4a3e-9c1d-0b7a8e1f2a3b");
     auto updatePayload = std::make_shared<domain::Tournament>();
     updatePayload->Name() = "Updated Name";
     updatePayload->Id() = tournamentId;
@@ -167,7 +185,7 @@ TEST_F(TournamentDelegateTest, UpdateTournament_Success) {
             testing::Return(tournamentId)
         ));
 
-    EXPECT_CALL(*queueProducerMockConcrete, SendMessage(tournamentId, "tournament.updated"))
+    EXPECT_CALL(*queueProducerMockConcrete, SendMessage(tournamentId.ToString(), "tournament.updated"))
         .Times(1);
 
     auto result = tournamentDelegate->UpdateTournament(updatePayload);
@@ -195,12 +213,12 @@ TEST_F(TournamentDelegateTest, UpdateTournament_FailsOnNotFound) {
 }
 
 TEST_F(TournamentDelegateTest, DeleteTournament_Success) {
-    const std::string tournamentId = "tournament-to-delete";
+    constexpr domain::Uuid tournamentId = *domain::Uuid::Parse("feb3b050-f7b8-4610-808a-1b01b8d61f2e");
 
     EXPECT_CALL(*tournamentRepositoryMock, Delete(tournamentId))
         .Times(1);
 
-    EXPECT_CALL(*queueProducerMockConcrete, SendMessage(tournamentId, "tournament.deleted"))
+    EXPECT_CALL(*queueProducerMockConcrete, SendMessage(tournamentId.ToString(), "tournament.deleted"))
         .Times(1);
 
     auto result = tournamentDelegate->DeleteTournament(tournamentId);
@@ -209,7 +227,7 @@ TEST_F(TournamentDelegateTest, DeleteTournament_Success) {
 }
 
 TEST_F(TournamentDelegateTest, DeleteTournament_FailsOnNotFound) {
-    const std::string tournamentId = "non-existent-tournament";
+    constexpr domain::Uuid tournamentId = *domain::Uuid::Parse("9a8b7c6d-5e4f-4a3b-8c2d-1e0f9a8b7c6d");
 
     EXPECT_CALL(*tournamentRepositoryMock, Delete(tournamentId))
     .WillOnce(testing::Throw(domain::NotFoundException()));
@@ -221,4 +239,59 @@ TEST_F(TournamentDelegateTest, DeleteTournament_FailsOnNotFound) {
 
     ASSERT_FALSE(result.has_value());
     EXPECT_NE(std::string::npos, result.error().find("Entry not found"));
-}
\ No newline at end of file
+}
+
+TEST_F(TournamentDelegateTest, GetStandings_ReadsTableWithoutTournamentLookup) {
+    constexpr domain::Uuid tournamentId = *domain::Uuid::Parse("0b9b3f3e-8f4b-4a3e-9c1d-0b7a8e1f2a3b");
+    std::vector<domain::Standing> standings{{TEAM_A, "Team A", 3, 0, 1, 24}, {TEAM_B, "Team B", 0, 3, 1, -24}};
+
+    EXPECT_CALL(*standingRepositoryMock, FindByTournamentId(tournamentId))
+        .WillOnce(testing::Return(std::optional(standings)));
+    EXPECT_CALL(*tournamentRepositoryMock, ReadById(::testing::_))
+        .Times(0);
+
+    auto result = tournamentDelegate->GetStandings(tournamentId);
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(2, result->size());
+    EXPECT_EQ(TEAM_A, result->at(0).TeamId);
+    EXPECT_EQ(24, result->at(0).NetPoints);
+}
+
+TEST_F(TournamentDelegateTest, GetStandings_RanksByWinPercentageAcrossUnequalGames) {
+    constexpr domain::Uuid tournamentId = *domain::Uuid::Parse("0b9b3f3e-8f4b-4a3e-9c1d-0b7a8e1f2a3b");
+    // team-a has more points, team-b the better percentage: 10-6 is .625, 7-3 is .700
+    std::vector<domain::Standing> standings{
+        {TEAM_A, "Team A", 10, 6, 0, 40},
+        {TEAM_C, "Team C", 0, 0, 0, 0},
+        {TEAM_B, "Team B", 7, 3, 0, 12},
+        // 6-2-2 is also .700, fewer wins puts it behind team-b
+        {TEAM_D, "Team D", 6, 2, 2, 30}
+    };
+
+    EXPECT_CALL(*standingRepositoryMock, FindByTournamentId(tournamentId))
+        .WillOnce(testing::Return(std::optional(standings)));
+
+    auto result = tournamentDelegate->GetStandings(tournamentId);
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(4, result->size());
+    EXPECT_EQ(TEAM_B, result->at(0).TeamId);
+    EXPECT_EQ(TEAM_D, result->at(1).TeamId);
+    EXPECT_EQ(TEAM_A, result->at(2).TeamId);
+    EXPECT_EQ(TEAM_C, result->at(3).TeamId);
+}
+
+TEST_F(TournamentDelegateTest, GetStandings_TournamentNotFound) {
+    constexpr domain::Uuid tournamentId = *domain::Uuid::Parse("9a8b7c6d-5e4f-4a3b-8c2d-1e0f9a8b7c6d");
+
+    EXPECT_CALL(*standingRepositoryMock, FindByTournamentId(tournamentId))
+        .WillOnce(testing::Return(std::nullopt));
+    EXPECT_CALL(*tournamentRepositoryMock, ReadById(::testing::_))
+        .Times(0);
+
+    auto result = tournamentDelegate->GetStandings(tournamentId);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ("Tournament not found.", result.error());
+}
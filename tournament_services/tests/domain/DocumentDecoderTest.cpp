@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "domain/DocumentDecoder.hpp"
+#include "domain/Utilities.hpp"
+
+TEST(DocumentDecoderTest, GroupMatchesTheDomDecoding) {
+    const std::string document = R"({"name":"Group A","tournamentId":"0d0e6a42-8d6f-4d8e-9a4c-5f0b7c2f3a11","id":"9b2f4c1a-3e5d-4f6a-8b7c-1d2e3f4a5b6c",
+        "teams":[{"id":"00000000-0000-4000-8000-000000000001","name":"Bears"},{"name":"Lions","id":"00000000-0000-4000-8000-000000000002"}]})";
+
+    domain::Group decoded;
+    domain::decode(document, decoded);
+    const domain::Group expected = nlohmann::json::parse(document);
+
+    EXPECT_EQ(expected.Name(), decoded.Name());
+    EXPECT_EQ(expected.Id(), decoded.Id());
+    EXPECT_EQ(expected.TournamentId(), decoded.TournamentId());
+    ASSERT_EQ(2, decoded.Teams().size());
+    EXPECT_EQ("00000000-0000-4000-8000-000000000001", decoded.Teams()[0].Id.ToString());
+    EXPECT_EQ("Bears", decoded.Teams()[0].Name);
+    EXPECT_EQ("00000000-0000-4000-8000-000000000002", decoded.Teams()[1].Id.ToString());
+    EXPECT_EQ("Lions", decoded.Teams()[1].Name);
+}
+
+TEST(DocumentDecoderTest, TournamentReadsTheNestedFormat) {
+    domain::Tournament tournament;
+    domain::decode(R"({"name":"Cup","format":{"maxTeamsPerGroup":5,"numberOfGroups":3,"type":"ROUND_ROBIN"}})", tournament);
+
+    EXPECT_EQ("Cup", tournament.Name());
+    EXPECT_EQ(5, tournament.Format().MaxTeamsPerGroup());
+    EXPECT_EQ(3, tournament.Format().NumberOfGroups());
+    EXPECT_EQ(domain::TournamentType::ROUND_ROBIN, tournament.Format().Type());
+}
+
+TEST(DocumentDecoderTest, UnknownFieldsAreSkippedWhateverTheirShape) {
+    domain::Team team;
+    domain::decode(R"({"seed":{"name":"not this","id":["x",{"name":"nor this"}]},"tags":["name"],"name":"Bears","rank":3})", team);
+
+    EXPECT_EQ("Bears", team.Name);
+    EXPECT_TRUE(team.Id.IsNil());
+
+    domain::Tournament tournament;
+    domain::decode(R"({"name":"Cup","groups":[{"format":{"numberOfGroups":9}}]})", tournament);
+    EXPECT_EQ(domain::Tournament{}.Format().NumberOfGroups(), tournament.Format().NumberOfGroups());
+}
+
+TEST(DocumentDecoderTest, MalformedDocumentThrowsLikeParse) {
+    domain::Group group;
+    EXPECT_THROW(domain::decode(R"({"name":"Group A",)", group), nlohmann::json::parse_error);
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <unordered_set>
+
+#include "domain/Uuid.hpp"
+
+TEST(UuidTest, ParsesAndFormatsTheCanonicalForm) {
+    const auto uuid = domain::Uuid::Parse("6F1C2B9E-8d6f-4d8e-9a4c-5f0b7c2f3a11");
+
+    ASSERT_TRUE(uuid.has_value());
+    EXPECT_EQ(0x6F, uuid->Bytes()[0]);
+    EXPECT_EQ(0x11, uuid->Bytes()[15]);
+    EXPECT_EQ("6f1c2b9e-8d6f-4d8e-9a4c-5f0b7c2f3a11", uuid->ToString());
+    static_assert(domain::isUuid("00000000-0000-4000-8000-000000000000"));
+}
+
+TEST(UuidTest, RejectsAnythingButFourDashedHexGroups) {
+    EXPECT_FALSE(domain::isUuid(""));
+    EXPECT_FALSE(domain::isUuid("mfasd#*"));
+    EXPECT_FALSE(domain::isUuid("6f1c2b9e8d6f4d8e9a4c5f0b7c2f3a11"));
+    EXPECT_FALSE(domain::isUuid("6f1c2b9e-8d6f-4d8e-9a4c-5f0b7c2f3a1g"));
+    EXPECT_FALSE(domain::isUuid("6f1c2b9e-8d6f-4d8e-9a4c-5f0b7c2f3a11 "));
+    EXPECT_FALSE(domain::isUuid("6f1c2b9e-8d6f-4d8e+9a4c-5f0b7c2f3a11"));
+    EXPECT_FALSE(domain::isUuid(std::string("6f1c2b9e-8d6f-4d8e-9a4c-5f0b7c2f3a1\0", 36)));
+}
+
+TEST(UuidTest, EqualIdsCompareAndHashAlikeWhateverTheirCase) {
+    const auto lower = *domain::Uuid::Parse("6f1c2b9e-8d6f-4d8e-9a4c-5f0b7c2f3a11");
+    const auto upper = *domain::Uuid::Parse("6F1C2B9E-8D6F-4D8E-9A4C-5F0B7C2F3A11");
+    const auto other = *domain::Uuid::Parse("6f1c2b9e-8d6f-4d8e-9a4c-5f0b7c2f3a12");
+
+    EXPECT_EQ(lower, upper);
+    EXPECT_LT(lower, other);
+    EXPECT_EQ(std::hash<domain::Uuid>{}(lower), std::hash<domain::Uuid>{}(upper));
+    const std::unordered_set<domain::Uuid> ids{lower, upper, other};
+    EXPECT_EQ(2, ids.size());
+}